@@ -51,7 +51,11 @@
  * the first and the last time.
  *
  * Access to events (in form of atoms or bins) is provided through the
- * element access operator[].
+ * element access operator[]. As the operator may return a view that is
+ * owned by the container, it should not be used by several threads on the
+ * same container. For concurrent access, each thread allocates its own
+ * event view using the view() method and accesses the events through the
+ * event() method.
  *
  * The size() method gives the number of event atoms or bins that is found
  * in the container. The number() method provides the total number of events
@@ -94,6 +98,10 @@ public:
     GEnergy             emin(void) const { return m_ebounds.emin(); }
     GEnergy             emax(void) const { return m_ebounds.emax(); }
 
+    // Virtual methods for concurrent event access
+    virtual GEvent*       view(void) const;
+    virtual const GEvent* event(const int& index, GEvent* view) const;
+
     // Event iterator
     class iterator {
     friend class GEvents;
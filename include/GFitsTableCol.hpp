@@ -39,6 +39,11 @@
  * @brief Abstract interface for FITS table column
  *
  * This class implements a FITS table column. Vector columns are supported.
+ *
+ * Column data are loaded from the FITS file on first access. By default
+ * the entire column is loaded. Setting a page size using the page() method
+ * limits the data held in memory to a window of rows that is moved through
+ * the column as rows are accessed.
  ***************************************************************************/
 class GFitsTableCol : public GBase {
 
@@ -79,6 +84,8 @@ public:
     int              number(void) const;
     int              length(void) const;
     int              anynul(void) const;
+    void             page(const int& nrows);
+    int              page(void) const;
     std::string      print(void) const;
 
 protected:
@@ -100,6 +107,9 @@ protected:
     mutable int      m_size;     //!< Size of allocated data area (0 if not loaded)
     int              m_anynul;   //!< Number of NULLs encountered
     void*            m_fitsfile; //!< FITS file pointer associated with column
+    int              m_page;     //!< Number of rows per page (0=no paging)
+    mutable int      m_first;    //!< First row of page in memory
+    mutable bool     m_paged;    //!< Only a page of the column is in memory
 
     // Protected pure virtual methods
     virtual std::string ascii_format(void) const = 0;
@@ -115,6 +125,9 @@ protected:
     virtual void        load_column(void);
     virtual void        save_column(void);
     virtual int         offset(const int& row, const int& inx) const;
+    void                load_page(const int& row) const;
+    void                load_rows(const int& first, const int& nrows);
+    bool                pageable(void) const;
 
 protected:
     // Private methods
@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GIntegrand.hpp"
 
@@ -40,6 +41,14 @@
  *
  * This class allows to perform integration using various methods. The
  * integrand is implemented by a derived class of GIntegrand.
+ *
+ * Besides Romberg integration, adaptive Gauss-Kronrod and fixed-order
+ * Gauss-Legendre quadratures are implemented. The integrate() method
+ * dispatches to the method selected using method(). The working arrays
+ * of the integration methods are kept by the object, hence integrations
+ * that are repeatedly performed using the same GIntegral object do not
+ * allocate memory. The number of integrand evaluations is counted and
+ * can be retrieved using calls().
  ***************************************************************************/
 class GIntegral : public GBase {
 
@@ -66,8 +75,16 @@ public:
     const bool&       silent(void) const { return m_silent; }
     void              integrand(GIntegrand* integrand) { m_integrand=integrand; }
     const GIntegrand* integrand(void) const { return m_integrand; }
+    void              method(const std::string& method);
+    std::string       method(void) const;
+    void              order(const int& order);
+    const int&        order(void) const { return m_order; }
+    const int&        calls(void) const { return m_calls; }
+    double            integrate(double a, double b);
     double            romb(double a, double b, int k = 5);
     double            trapzd(double a, double b, int n = 1, double result = 0.0);
+    double            gauss_kronrod(double a, double b);
+    double            gauss_legendre(double a, double b);
     std::string       print(void) const;
 
 protected:
@@ -76,13 +93,26 @@ protected:
     void   copy_members(const GIntegral& integral);
     void   free_members(void);
     double polint(double* xa, double* ya, int n, double x, double *dy);
+    double kronrod(const double& a, const double& b, double* error);
+    void   legendre_nodes(void);
 
     // Protected data area
-    GIntegrand* m_integrand;    //!< Pointer to integrand
-    double      m_eps;          //!< Integration precision
-    int         m_max_iter;     //!< Maximum number of iterations
-    int         m_iter;         //!< Number of iterations used
-    bool        m_silent;       //!< Suppress integration warnings
+    GIntegrand*         m_integrand;    //!< Pointer to integrand
+    double              m_eps;          //!< Integration precision
+    int                 m_max_iter;     //!< Maximum number of iterations
+    int                 m_iter;         //!< Number of iterations used
+    bool                m_silent;       //!< Suppress integration warnings
+    int                 m_method;       //!< Method used by integrate()
+    int                 m_order;        //!< Gauss-Legendre order
+    int                 m_calls;        //!< Number of integrand evaluations
+    std::vector<double> m_gl_x;         //!< Gauss-Legendre abscissae
+    std::vector<double> m_gl_w;         //!< Gauss-Legendre weights
+    std::vector<double> m_wrk_s;        //!< Romberg workspace (results)
+    std::vector<double> m_wrk_h;        //!< Romberg workspace (step sizes)
+    std::vector<double> m_wrk_a;        //!< Kronrod workspace (left bounds)
+    std::vector<double> m_wrk_b;        //!< Kronrod workspace (right bounds)
+    std::vector<double> m_wrk_r;        //!< Kronrod workspace (results)
+    std::vector<double> m_wrk_e;        //!< Kronrod workspace (errors)
 };
 
 #endif /* GINTEGRAL_HPP */
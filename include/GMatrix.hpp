@@ -44,6 +44,9 @@ class GSparseMatrix;
  * This class implements a generic matrix class. This class is a
  * non-spezialized representation of a matrix, and all other matrix storage
  * classes can be converted into that class.
+ *
+ * Matrix multiplications are computed in cache blocks. For large matrices
+ * the columns of the result are distributed over the available threads.
  ***************************************************************************/
 class GMatrix : public GMatrixBase {
 
@@ -111,6 +114,7 @@ private:
     void copy_members(const GMatrix& matrix);
     void free_members(void);
     void alloc_members(const int& rows, const int& cols);
+    void product(const GMatrix& matrix, GMatrix& result) const;
 };
 
 
@@ -139,8 +143,8 @@ GMatrix GMatrix::operator-(const GMatrix& matrix) const
 inline
 GMatrix GMatrix::operator*(const GMatrix& matrix) const
 {
-    GMatrix result = *this;
-    result *= matrix;
+    GMatrix result(m_rows, matrix.m_cols);
+    product(matrix, result);
     return result;
 }
 
@@ -50,7 +50,10 @@ class GObservation;
  * model evaluation: eval() and eval_gradients().
  * The eval() method evaluates the model for a given event and observation.
  * In addition, eval_gradients() also sets the parameter gradients of the
- * model.
+ * model. The eval_gradients_range() method evaluates the model and its
+ * parameter gradients for a range of events of an observation in a single
+ * call. Derived classes may overload this method to share computations
+ * between events.
  *
  * This abstract virtual base class implements the methods that handle the
  * model name and the applicable instruments. It also implements friend
@@ -101,6 +104,12 @@ public:
     void                ids(const std::string& ids);
     bool                isvalid(const std::string& instruments,
                                 const std::string& ids) const;
+    virtual void        eval_gradients_range(const GObservation& obs,
+                                             const int& ibegin,
+                                             const int& iend,
+                                             double* values,
+                                             double* gradients,
+                                             GEvent* view = NULL) const;
 
 protected:
     // Protected methods
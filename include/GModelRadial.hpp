@@ -68,6 +68,9 @@ public:
     virtual double        theta_max(void) const = 0;
     virtual std::string   print(void) const = 0;
 
+    // Overloaded base class methods
+    using GModelSpatial::mc;
+
     // Implemented virtual methods
     virtual double        eval(const GSkyDir& srcDir) const;
     virtual double        eval_gradients(const GSkyDir& srcDir) const;
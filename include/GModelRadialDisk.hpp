@@ -69,6 +69,9 @@ public:
     virtual void              write(GXmlElement& xml) const;
     virtual std::string       print(void) const;
 
+    // Overloaded base class methods
+    using GModelSpatial::mc;
+
     // Other methods
     double radius(void) const { return m_radius.real_value(); }
     void   radius(const double& radius) { m_radius.real_value(radius); }
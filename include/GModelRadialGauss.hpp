@@ -68,6 +68,9 @@ public:
     virtual void               write(GXmlElement& xml) const;
     virtual std::string        print(void) const;
 
+    // Overloaded base class methods
+    using GModelSpatial::mc;
+
     // Other methods
     double  sigma(void) const { return m_sigma.real_value(); }
     void    sigma(const double& sigma) { m_sigma.real_value(sigma); }
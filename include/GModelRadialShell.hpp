@@ -81,6 +81,9 @@ public:
     virtual void               write(GXmlElement& xml) const;
     virtual std::string        print(void) const;
 
+    // Overloaded base class methods
+    using GModelSpatial::mc;
+
     // Other methods
     double  radius(void) const { return m_radius.real_value(); }
     double  width(void) const { return m_width.real_value(); }
@@ -97,6 +100,7 @@ protected:
     void          update(void) const;
     static double f1(double x);
     static double f2(double x);
+    static double f3(double x);
 
     // Protected members
     GModelPar       m_radius;        //!< Inner shell radius (deg)
@@ -66,6 +66,12 @@ class GObservation;
  * energies (method spectral) and then over all times (method temporal).
  * The eval() and eval_gradients() methods call temporal() to perform the
  * nested integrations.
+ * The eval_gradients_range() method evaluates the model for a range of
+ * events and evaluates the spectral and temporal components only once for
+ * consecutive events that share the same energy or time. Optionally, the
+ * IRF values may be taken from an array provided by the
+ * caller, which allows observations to cache the response for sources
+ * with fixed spatial parameters.
  ***************************************************************************/
 class GModelSky : public GModel {
 
@@ -91,6 +97,12 @@ public:
                              const GObservation& obs) const;
     virtual double      eval_gradients(const GEvent& event,
                                        const GObservation& obs) const;
+    virtual void        eval_gradients_range(const GObservation& obs,
+                                             const int& ibegin,
+                                             const int& iend,
+                                             double* values,
+                                             double* gradients,
+                                             GEvent* view = NULL) const;
     virtual double      npred(const GEnergy& obsEng, const GTime& obsTime,
                               const GObservation& obs) const;
     virtual void        read(const GXmlElement& xml);
@@ -100,6 +112,13 @@ public:
     GModelSpatial*      spatial(void) const { return m_spatial; }
     GModelSpectral*     spectral(void) const { return m_spectral; }
     GModelTemporal*     temporal(void) const { return m_temporal; }
+    void                eval_gradients_range(const GObservation& obs,
+                                             const int& ibegin,
+                                             const int& iend,
+                                             double* values,
+                                             double* gradients,
+                                             GEvent* view,
+                                             const double* irfs) const;
     double              value(const GSkyDir& srcDir, const GEnergy& srcEng,
                               const GTime& srcTime);
     GVector             gradients(const GSkyDir& srcDir, const GEnergy& srcEng,
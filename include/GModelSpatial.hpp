@@ -73,7 +73,9 @@ public:
     virtual std::string    print(void) const = 0;
 
     // Methods
-    int size(void) const { return m_pars.size(); }
+    virtual void mc(const int& number, GRan& ran,
+                    std::vector<GSkyDir>& dirs) const;
+    int          size(void) const { return m_pars.size(); }
 
 protected:
     // Protected methods
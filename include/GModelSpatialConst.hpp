@@ -66,6 +66,9 @@ public:
     virtual void                write(GXmlElement& xml) const;
     virtual std::string         print(void) const;
 
+    // Overloaded base class methods
+    using GModelSpatial::mc;
+
 protected:
     // Protected methods
     void init_members(void);
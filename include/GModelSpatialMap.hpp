@@ -65,22 +65,27 @@ public:
     virtual double            eval(const GSkyDir& srcDir) const;
     virtual double            eval_gradients(const GSkyDir& srcDir) const;
     virtual GSkyDir           mc(GRan& ran) const;
+    virtual void              mc(const int& number, GRan& ran,
+                                 std::vector<GSkyDir>& dirs) const;
     virtual void              read(const GXmlElement& xml);
     virtual void              write(GXmlElement& xml) const;
     virtual std::string       print(void) const;
 
 protected:
     // Protected methods
-    void init_members(void);
-    void copy_members(const GModelSpatialMap& model);
-    void free_members(void);
-    void load_map(const std::string& filename);
+    void    init_members(void);
+    void    copy_members(const GModelSpatialMap& model);
+    void    free_members(void);
+    void    load_map(const std::string& filename);
+    void    mc_init(void);
+    GSkyDir mc_draw(GRan& ran) const;
 
     // Protected members
     GModelPar           m_value;        //!< Value
     GSkymap             m_map;          //!< Skymap
     std::string         m_filename;     //!< Name of skymap
-    std::vector<double> m_mc_cache;     //!< Monte Carlo cache
+    std::vector<double> m_mc_prob;      //!< MC acceptance probabilities
+    std::vector<int>    m_mc_alias;     //!< MC alias pixels
 };
 
 #endif /* GMODELSPATIALMAP_HPP */
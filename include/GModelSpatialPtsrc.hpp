@@ -63,6 +63,8 @@ public:
     virtual double              eval(const GSkyDir& srcDir) const;
     virtual double              eval_gradients(const GSkyDir& srcDir) const;
     virtual GSkyDir             mc(GRan& ran) const;
+    virtual void                mc(const int& number, GRan& ran,
+                                   std::vector<GSkyDir>& dirs) const;
     virtual void                read(const GXmlElement& xml);
     virtual void                write(GXmlElement& xml) const;
     virtual std::string         print(void) const;
@@ -74,7 +74,10 @@ public:
     virtual std::string     print(void) const = 0;
 
     // Methods
-    int size(void) const { return m_pars.size(); }
+    virtual void mc(const int& number, const GEnergy& emin,
+                    const GEnergy& emax, GRan& ran,
+                    std::vector<GEnergy>& energies) const;
+    int          size(void) const { return m_pars.size(); }
 
 protected:
     // Protected methods
@@ -75,6 +75,9 @@ public:
     virtual void                   write(GXmlElement& xml) const;
     virtual std::string            print(void) const;
 
+    // Overloaded base class methods
+    using GModelSpectral::mc;
+
     // Other methods
     void   autoscale(void);
     double norm(void) const { return m_norm.real_value(); }
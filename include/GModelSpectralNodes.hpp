@@ -82,6 +82,9 @@ public:
     virtual double               flux(const GEnergy& emin, const GEnergy& emax) const;
     virtual double               eflux(const GEnergy& emin, const GEnergy& emax) const;
     virtual GEnergy              mc(const GEnergy& emin, const GEnergy& emax, GRan& ran) const;
+    virtual void                 mc(const int& number, const GEnergy& emin,
+                                    const GEnergy& emax, GRan& ran,
+                                    std::vector<GEnergy>& energies) const;
     virtual void                 read(const GXmlElement& xml);
     virtual void                 write(GXmlElement& xml) const;
     virtual std::string          print(void) const;
@@ -98,7 +101,9 @@ protected:
     void set_flux_cache(void) const;
     void update_eval_cache(void) const;
     void update_flux_cache(void) const;
-    void mc_update(const GEnergy& emin, const GEnergy& emax) const;
+    int     mc_update(const GEnergy& emin, const GEnergy& emax) const;
+    void    mc_clear(void) const;
+    GEnergy mc_energy(const int& icache, GRan& ran) const;
 
     // Protected members
     std::vector<GModelPar>      m_energies;     //!< Node energies
@@ -120,12 +125,15 @@ protected:
     mutable std::vector<double> m_eflux;        //!< Energy fluxes
     
     // Cached members for MC
-    mutable GEnergy             m_mc_emin;      //!< Minimum energy
-    mutable GEnergy             m_mc_emax;      //!< Maximum energy
-    mutable std::vector<double> m_mc_cum;       //!< Cumulative distribution
-    mutable std::vector<double> m_mc_min;       //!< Lower boundary for MC
-    mutable std::vector<double> m_mc_max;       //!< Upper boundary for MC
-    mutable std::vector<double> m_mc_exp;       //!< Exponent for MC
+    mutable std::vector<GEnergy> m_mc_emin;     //!< Minimum energies
+    mutable std::vector<GEnergy> m_mc_emax;     //!< Maximum energies
+    mutable std::vector<int>     m_mc_begin;    //!< First segment of intervals
+    mutable std::vector<int>     m_mc_end;      //!< End of segments of intervals
+    mutable int                  m_mc_index;    //!< Interval of last call
+    mutable std::vector<double>  m_mc_cum;      //!< Cumulative distribution
+    mutable std::vector<double>  m_mc_min;      //!< Lower boundary for MC
+    mutable std::vector<double>  m_mc_max;      //!< Upper boundary for MC
+    mutable std::vector<double>  m_mc_exp;      //!< Exponent for MC
 };
 
 #endif /* GMODELSPECTRALNODES_HPP */
@@ -70,6 +70,9 @@ public:
     virtual double              flux(const GEnergy& emin, const GEnergy& emax) const;
     virtual double              eflux(const GEnergy& emin, const GEnergy& emax) const;
     virtual GEnergy             mc(const GEnergy& emin, const GEnergy& emax, GRan& ran) const;
+    virtual void                mc(const int& number, const GEnergy& emin,
+                                   const GEnergy& emax, GRan& ran,
+                                   std::vector<GEnergy>& energies) const;
     virtual void                read(const GXmlElement& xml);
     virtual void                write(GXmlElement& xml) const;
     virtual std::string         print(void) const;
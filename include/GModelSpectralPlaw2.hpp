@@ -78,6 +78,9 @@ public:
     virtual void                 write(GXmlElement& xml) const;
     virtual std::string          print(void) const;
 
+    // Overloaded base class methods
+    using GModelSpectral::mc;
+
     // Other methods
     double integral(void) const { return m_integral.real_value(); }
     double index(void) const { return m_index.real_value(); }
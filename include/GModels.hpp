@@ -80,6 +80,11 @@ public:
     void          write(GXml& xml) const;
     double        eval(const GEvent& event, const GObservation& obs) const;
     double        eval_gradients(const GEvent& event, const GObservation& obs) const;
+    void          eval_gradients_range(const GObservation& obs,
+                                       const int& ibegin, const int& iend,
+                                       double* values,
+                                       double* gradients,
+                                       GEvent* view = NULL) const;
     std::string   print(void) const;
 
 protected:
@@ -49,7 +49,11 @@
  * Interpolation can be either performed using the interpolate() method
  * or using the set_value(). In the latter case, the node indices and
  * weighting factors can be recovered using inx_left(), inx_right(),
- * wgt_left() and wgt_right().
+ * wgt_left() and wgt_right(). As set_value() stores the indices and
+ * weighting factors in the node array, a set_value() variant is provided
+ * that returns them to the caller. This variant and the interpolate()
+ * method do not alter the node array and can be used concurrently from
+ * several threads.
  * If the nodes are equally spaced, interpolation is more rapid.
  ***************************************************************************/
 class GNodeArray : public GBase {
@@ -79,6 +83,9 @@ public:
     double        interpolate(const double& value,
                               const std::vector<double>& vector) const;
     void          set_value(const double& value) const;
+    void          set_value(const double& value,
+                            int& inx_left, int& inx_right,
+                            double& wgt_left, double& wgt_right) const;
     const int&    inx_left(void) const { return m_inx_left; }
     const int&    inx_right(void) const { return m_inx_right; }
     const double& wgt_left(void) const { return m_wgt_left; }
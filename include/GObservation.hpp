@@ -50,10 +50,13 @@
  * events, and provides information about the analysis definiton.
  * The method model() returns the probability for an event to be measured
  * with a given instrument direction, a given energy and at a given time,
- * given a source model and an instrument pointing direction.
+ * given a source model and an instrument pointing direction. A second
+ * version of model() returns the probabilities and gradients for a range
+ * of events in a single call, either for all models or for a single model
+ * component.
  * The method npred() returns the total number of expected events within the
  * analysis region for a given source model and a given instrument pointing
- * direction.
+ * direction, again either for all models or for a single model component.
  * The methods a defined as virtual and can be overloaded by derived classes
  * that implement instrument specific observations in order to optimize the
  * execution speed for data analysis.
@@ -86,17 +89,31 @@ public:
     // Virtual methods
     virtual double        model(const GModels& models, const GEvent& event,
                                 GVector* gradient = NULL) const;
+    virtual void          model(const GModels& models, const int& ibegin,
+                                const int& iend, double* values,
+                                double* gradients,
+                                GEvent* view = NULL) const;
     virtual double        npred(const GModels& models, GVector* gradient = NULL) const;
+    virtual void          prepare(const GModels& models);
+
+    // Model component methods
+    void                  model(const GModel& model, const int& ibegin,
+                                const int& iend, double* values,
+                                double* gradients,
+                                GEvent* view = NULL) const;
+    double                npred(const GModel& model, GVector* gradient = NULL) const;
 
     // Implemented methods
     void                  name(const std::string& name);
     void                  id(const std::string& id);
-    void                  events(const GEvents* events);
+    virtual void          events(const GEvents* events);
     void                  statistics(const std::string& statistics);
+    void                  numeric_grad(const bool& numeric);
     const std::string&    name(void) const { return m_name; }
     const std::string&    id(void) const { return m_id; }
     const GEvents*        events(void) const;
     const std::string&    statistics(void) const { return m_statistics; }
+    const bool&           numeric_grad(void) const { return m_numeric_grad; }
 
     // Other methods
     virtual double model_grad(const GModel& model, const GEvent& event, int ipar) const;
@@ -108,6 +125,10 @@ protected:
     void copy_members(const GObservation& obs);
     void free_members(void);
 
+    // Model evaluation for event ranges
+    virtual void model_range(const GModel& model, const int& ibegin,
+                             const int& iend, double* values,
+                             double* gradients, GEvent* view) const;
 
     // Model gradient kernel classes
     class model_func : public GFunction {
@@ -181,6 +202,7 @@ protected:
     std::string m_id;           //!< Observation identifier
     std::string m_statistics;   //!< Optimizer statistics (default=poisson)
     GEvents*    m_events;       //!< Pointer to event container
+    bool        m_numeric_grad; //!< Compute all gradients numerically
 };
 
 #endif /* GOBSERVATION_HPP */
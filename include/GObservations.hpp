@@ -87,6 +87,8 @@ public:
     void           models(const std::string& filename);
     GModels&       models(void) { return m_models; }
     void           optimize(GOptimizer& opt);
+    void           nthreads(const int& nthreads);
+    const int&     nthreads(void) const { return m_nthreads; }
     double         npred(void) const { return m_npred; }
     std::string    print(void) const;
 
@@ -134,7 +136,12 @@ public:
         optimizer& operator= (const optimizer& fct);
 
         // Methods
+        optimizer*     clone(void) const;
         void           eval(const GOptimizerPars& pars);
+        void           nthreads(const int& nthreads);
+        const int&     nthreads(void) const { return m_nthreads; }
+        void           cache(const bool& cache);
+        const bool&    cache(void) const { return m_use_cache; }
         void           poisson_unbinned(const GObservation& obs, const GOptimizerPars& pars);
         void           poisson_unbinned(const GObservation& obs, const GOptimizerPars& pars, GSparseMatrix& covar, GVector& mgrad, double& value, GVector& gradient);
         void           poisson_binned(const GObservation& obs, const GOptimizerPars& pars);
@@ -146,17 +153,98 @@ public:
         GVector*       gradient(void) { return m_gradient; }
         GSparseMatrix* covar(void) { return m_covar; }
     protected:
+        // Per thread workspace
+        class workspace {
+        public:
+            // Constructors and destructors
+            workspace(void);
+            ~workspace(void);
+
+            // Methods
+            void                  resize(const int& npars);
+            GModels&              sync(const GOptimizerPars& pars);
+            void                  attach(const GEvents* events);
+
+            // Members
+            GModels*              model;      //!< Model copy
+            GVector               gradient;   //!< Gradient accumulator
+            GVector               wrk_grad;   //!< Gradient working array
+            std::vector<int>      inx;        //!< Index working array
+            std::vector<double>   values;     //!< Value working array
+            std::vector<double>   mvalues;    //!< Model values of event block
+            std::vector<double>   mgrads;     //!< Model gradients of event block
+            std::vector<double>   dense;      //!< Dense curvature accumulator
+            GSparseMatrix*        covar;      //!< Curvature matrix accumulator
+            GEvent*               view;       //!< Event view of observation
+        private:
+            bool matches(const GModels& models) const;
+            workspace(const workspace& wrk);
+            workspace& operator= (const workspace& wrk);
+        };
+
+        // Model cache of one observation
+        class obs_cache {
+        public:
+            // Constructors and destructors
+            obs_cache(void) : nevents(0), enabled(false), filled(false) {}
+
+            // Members
+            int                   nevents;    //!< Number of events
+            bool                  enabled;    //!< Observation is cached
+            bool                  filled;     //!< Cache holds all events
+            std::vector<double>   values;     //!< Model values [model][event]
+            std::vector<double>   grads;      //!< Model gradients [event][parameter]
+            std::vector<double>   npred;      //!< Npred per model
+            std::vector<double>   npred_grad; //!< Npred gradients [parameter]
+        };
+
+        // Event range kernel
+        typedef void (optimizer::*kernel)(const GObservation& obs,
+                                          const GOptimizerPars& pars,
+                                          obs_cache* cache,
+                                          const int& ibegin, const int& iend,
+                                          GSparseMatrix& covar, GVector& mgrad,
+                                          double& value, double& npred,
+                                          GVector& gradient, workspace& wrk);
+
+        // Protected methods
         void           init_members(void);
         void           copy_members(const optimizer& fct);
         void           free_members(void);
-        double         m_value;       //!< Function value
-        double         m_npred;       //!< Total number of predicted events
-        double         m_minmod;      //!< Minimum model value
-        double         m_minerr;      //!< Minimum error value
-        GVector*       m_gradient;    //!< Pointer to gradient vector
-        GSparseMatrix* m_covar;       //!< Pointer to covariance matrix
-        GObservations* m_this;        //!< Pointer to GObservations object
-        GVector*       m_wrk_grad;    //!< Pointer to working gradient vector
+        void           alloc_workspaces(const int& num);
+        void           eval_observation(const GObservation& obs, const GOptimizerPars& pars, GSparseMatrix& covar, GVector& mgrad, double& value, double& npred, GVector& gradient, workspace& wrk);
+        void           eval_events(kernel fct, const GObservation& obs, const GOptimizerPars& pars, GSparseMatrix& covar, GVector& mgrad, double& value, double& npred, GVector& gradient, workspace& wrk);
+        void           poisson_unbinned_range(const GObservation& obs, const GOptimizerPars& pars, obs_cache* cache, const int& ibegin, const int& iend, GSparseMatrix& covar, GVector& mgrad, double& value, double& npred, GVector& gradient, workspace& wrk);
+        void           poisson_binned_range(const GObservation& obs, const GOptimizerPars& pars, obs_cache* cache, const int& ibegin, const int& iend, GSparseMatrix& covar, GVector& mgrad, double& value, double& npred, GVector& gradient, workspace& wrk);
+        void           gaussian_binned_range(const GObservation& obs, const GOptimizerPars& pars, obs_cache* cache, const int& ibegin, const int& iend, GSparseMatrix& covar, GVector& mgrad, double& value, double& npred, GVector& gradient, workspace& wrk);
+        void           add_dense(GSparseMatrix& covar, const double* dense,
+                                 const int& npars, int* inx,
+                                 double* values) const;
+        void           prepare_cache(const GOptimizerPars& pars);
+        void           finish_cache(void);
+        obs_cache*     find_cache(const GObservation& obs);
+        double*        eval_model(const GObservation& obs, const GOptimizerPars& pars, obs_cache* cache, const int& ibegin, const int& iend, double* values, workspace& wrk);
+        double         eval_npred(const GObservation& obs, const GOptimizerPars& pars, obs_cache* cache, GVector& gradient);
+
+        // Protected members
+        double                  m_value;      //!< Function value
+        double                  m_npred;      //!< Total number of predicted events
+        double                  m_minmod;     //!< Minimum model value
+        double                  m_minerr;     //!< Minimum error value
+        GVector*                m_gradient;   //!< Pointer to gradient vector
+        GSparseMatrix*          m_covar;      //!< Pointer to covariance matrix
+        GObservations*          m_this;       //!< Pointer to GObservations object
+        GObservations*          m_obs_copy;   //!< Owned observation copy (clones only)
+        GVector*                m_wrk_grad;   //!< Pointer to working gradient vector
+        int                     m_nthreads;   //!< Number of threads per observation
+        std::vector<workspace*> m_wrk;        //!< Workspaces per thread or event range
+        bool                    m_use_cache;  //!< Cache model contributions
+        bool                    m_cache_busy; //!< Caches are being updated
+        std::vector<obs_cache>  m_cache;      //!< Model caches per observation
+        std::vector<bool>       m_changed;    //!< Models changed since last evaluation
+        std::vector<double>     m_par_values; //!< Parameter values of last evaluation
+        std::vector<double>     m_par_scales; //!< Parameter scales of last evaluation
+        std::vector<bool>       m_par_free;   //!< Parameter free flags of last evaluation
     };
 
 protected:
@@ -169,6 +257,7 @@ protected:
     std::vector<GObservation*> m_obs;      //!< List of observations
     GModels                    m_models;   //!< Models
     double                     m_npred;    //!< Total number of predicted events
+    int                        m_nthreads; //!< Number of threads per observation
 
 };
 
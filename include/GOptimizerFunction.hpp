@@ -43,6 +43,14 @@
  * The method eval() returns the function value at a given set of parameters
  * that is defined by an instance of the optimizer parameter container class
  * GOptimizerPars.
+ *
+ * Optimizers that do not need the curvature matrix (such as
+ * GOptimizerLBFGS) may switch off its computation using curvature(false).
+ * Functions that support this mode then only compute value and gradient.
+ *
+ * The clone() method allows optimizers to evaluate several parameter sets
+ * concurrently, each on its own copy of the function. Functions that do
+ * not implement clone() return NULL, and are only evaluated serially.
  ***************************************************************************/
 class GOptimizerFunction {
 
@@ -56,10 +64,15 @@ public:
     virtual GOptimizerFunction& operator= (const GOptimizerFunction& fct);
 
     // Virtual methods
+    virtual GOptimizerFunction* clone(void) const;
     virtual void           eval(const GOptimizerPars& pars) = 0;
     virtual double*        value(void) = 0;
     virtual GVector*       gradient(void) = 0;
     virtual GSparseMatrix* covar(void) = 0;
+
+    // Methods
+    void                   curvature(const bool& curvature) { m_curvature=curvature; }
+    const bool&            curvature(void) const { return m_curvature; }
  
 protected:
     // Protected methods
@@ -67,6 +80,9 @@ protected:
     void copy_members(const GOptimizerFunction& fct);
     void free_members(void);
 
+    // Protected members
+    bool m_curvature;   //!< Compute curvature matrix
+
 };
 
 #endif /* GOPTIMIZERFUNCTION_HPP */
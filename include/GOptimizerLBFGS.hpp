@@ -0,0 +1,132 @@
+/***************************************************************************
+ *              GOptimizerLBFGS.hpp  -  L-BFGS optimizer class             *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2012 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GOptimizerLBFGS.hpp
+ * @brief L-BFGS optimizer class interface definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GOPTIMIZERLBFGS_HPP
+#define GOPTIMIZERLBFGS_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <vector>
+#include "GOptimizer.hpp"
+#include "GOptimizerFunction.hpp"
+#include "GVector.hpp"
+#include "GModels.hpp"
+#include "GLog.hpp"
+
+/* __ Definitions ________________________________________________________ */
+#define G_LBFGS_CONVERGED            0
+#define G_LBFGS_STALLED              1
+#define G_LBFGS_SINGULAR             2
+#define G_LBFGS_NOT_POSTIVE_DEFINITE 3
+#define G_LBFGS_BAD_ERRORS           4
+
+
+/***********************************************************************//**
+ * @class GOptimizerLBFGS
+ *
+ * @brief Limited memory BFGS optimizer class interface defintion
+ *
+ * This class implements a limited memory Broyden-Fletcher-Goldfarb-Shanno
+ * (L-BFGS) quasi-Newton optimizer. Contrary to GOptimizerLM, the optimizer
+ * only requires the function value and gradient, and builds an
+ * approximation of the inverse curvature matrix from the last memory()
+ * parameter and gradient changes. It switches off the computation of the
+ * curvature matrix in the optimizer function during the iterations, which
+ * makes it suited for fits with a large number of free parameters.
+ *
+ * Parameter boundaries are handled by projection: trial parameters are
+ * clipped to their valid range and parameters that sit at a boundary with
+ * a gradient pointing outside are excluded from the search direction.
+ *
+ * Parameter errors are computed after convergence from a single evaluation
+ * of the curvature matrix. This can be disabled using compute_errors().
+ ***************************************************************************/
+class GOptimizerLBFGS : public GOptimizer {
+
+public:
+
+    // Constructors and destructors
+    GOptimizerLBFGS(void);
+    GOptimizerLBFGS(GLog& log);
+    GOptimizerLBFGS(const GOptimizerLBFGS& opt);
+    virtual ~GOptimizerLBFGS(void);
+
+    // Operators
+    GOptimizerLBFGS& operator= (const GOptimizerLBFGS& opt);
+    GOptimizerPars&  operator() (GOptimizerFunction& fct, GOptimizerPars& p);
+    GModels&         operator() (GOptimizerFunction& fct, GModels& m);
+
+    // Implemented pure virtual methods
+    virtual void             clear(void);
+    virtual GOptimizerLBFGS* clone(void) const;
+    virtual std::string      print(void) const;
+    virtual double           value(void) const { return m_value; }
+    virtual int              status(void) const { return m_status; }
+    virtual int              iter(void) const { return m_iter; }
+
+    // Methods
+    void   max_iter(const int& n) { m_max_iter=n; }
+    void   max_trials(const int& n) { m_max_trials=n; }
+    void   memory(const int& n) { m_memory=n; }
+    void   eps(const double& eps) { m_eps=eps; }
+    void   compute_errors(const bool& flag) { m_compute_errors=flag; }
+    int    max_iter(void) const { return m_max_iter; }
+    int    max_trials(void) const { return m_max_trials; }
+    int    memory(void) const { return m_memory; }
+    double eps(void) const { return m_eps; }
+    bool   compute_errors(void) const { return m_compute_errors; }
+
+protected:
+    // Protected methods
+    void    init_members(void);
+    void    copy_members(const GOptimizerLBFGS& opt);
+    void    free_members(void);
+    void    optimize(GOptimizerFunction* fct, GOptimizerPars* pars);
+    void    iterate(GOptimizerFunction* fct, GOptimizerPars* pars);
+    GVector direction(const GVector& grad, const std::vector<bool>& active) const;
+    double  line_search(GOptimizerFunction* fct, GOptimizerPars* pars,
+                        const GVector& grad, const GVector& dir,
+                        GVector& new_grad);
+    void    errors(GOptimizerFunction* fct, GOptimizerPars* pars);
+
+    // Protected members
+    int                  m_npars;           //!< Number of parameters
+    int                  m_nfree;           //!< Number of free parameters
+    int                  m_memory;          //!< Number of stored corrections
+    double               m_eps;             //!< Absolute precision
+    int                  m_max_iter;        //!< Maximum number of iterations
+    int                  m_max_trials;      //!< Maximum number of line search trials
+    bool                 m_compute_errors;  //!< Compute parameter errors
+    std::vector<GVector> m_s;               //!< Parameter changes
+    std::vector<GVector> m_y;               //!< Gradient changes
+    std::vector<double>  m_rho;             //!< Inverse curvature of changes
+    double               m_value;           //!< Actual function value
+    int                  m_status;          //!< Fit status
+    int                  m_iter;            //!< Iteration
+    GLog*                m_logger;          //!< Pointer to optional logger
+
+};
+
+#endif /* GOPTIMIZERLBFGS_HPP */
@@ -31,6 +31,8 @@
 #include <vector>
 #include "GOptimizer.hpp"
 #include "GOptimizerFunction.hpp"
+#include "GSymMatrix.hpp"
+#include "GSparseMatrix.hpp"
 #include "GModels.hpp"
 #include "GLog.hpp"
 
@@ -48,6 +50,19 @@
  * @brief Levenberg Marquardt optimizer class interface defintion
  *
  * This method implements an Levenberg Marquardt optimizer.
+ *
+ * Using lambda_trials(n) with n > 1, each iteration solves for n damping
+ * values and evaluates the n trial parameter sets concurrently, accepting
+ * the best one. This reduces the wall-clock time of iterations in which
+ * steps are rejected, at the expense of using n threads per iteration.
+ *
+ * Parameters selected using profile() obtain, in addition to the errors
+ * derived from the curvature matrix, lower and upper profile-likelihood
+ * errors (see error_lower() and error_upper()). These are the distances
+ * from the best fit value at which the function, minimised over all other
+ * parameters, has increased by 0.5. The profiles of the selected
+ * parameters are refitted concurrently on clones of the optimizer
+ * function.
  ***************************************************************************/
 class GOptimizerLM : public GOptimizer {
 
@@ -79,7 +94,10 @@ public:
     void   lambda_start(const double& val) { m_lambda_start=val; }
     void   lambda_inc(const double& val) { m_lambda_inc=val; }
     void   lambda_dec(const double& val) { m_lambda_dec=val; }
+    void   lambda_trials(const int& n) { m_lambda_trials=(n > 1) ? n : 1; }
     void   eps(const double& eps) { m_eps=eps; }
+    void   profile(const int& ipar) { m_profile.push_back(ipar); }
+    void   clear_profile(void) { m_profile.clear(); }
     int    max_iter(void) const { return m_max_iter; }
     int    max_stalls(void) const { return m_max_stall; }
     int    max_boundary_hits(void) const { return m_max_hit; }
@@ -87,17 +105,42 @@ public:
     double lambda_inc(void) const { return m_lambda_inc; }
     double lambda_dec(void) const { return m_lambda_dec; }
     double lambda(void) const { return m_lambda; }
+    int    lambda_trials(void) const { return m_lambda_trials; }
     double eps(void) const { return m_eps; }
+    int    nprofile(void) const { return m_profile.size(); }
+    double error_lower(const int& ipar) const;
+    double error_upper(const int& ipar) const;
 
 protected:
     // Protected methods
-    void   init_members(void);
-    void   copy_members(const GOptimizerLM& opt);
-    void   free_members(void);
-    void   optimize(GOptimizerFunction* fct, GOptimizerPars* pars);
-    void   iteration(GOptimizerFunction* fct, GOptimizerPars* pars);
-    void   errors(GOptimizerFunction* fct, GOptimizerPars* pars);
-    double step_size(GVector* grad, GOptimizerPars* pars);
+    void       init_members(void);
+    void       copy_members(const GOptimizerLM& opt);
+    void       free_members(void);
+    void       optimize(GOptimizerFunction* fct, GOptimizerPars* pars);
+    void       iteration(GOptimizerFunction* fct, GOptimizerPars* pars);
+    void       iteration_trials(GOptimizerFunction* fct, GOptimizerPars* pars);
+    void       update_pars(const GVector& dir, const double& step,
+                           GOptimizerPars* pars);
+    void       remove_zero_curvature(GOptimizerFunction* fct,
+                                     GOptimizerPars* pars);
+    GVector    damped_step(const GSparseMatrix& covar, const GVector& grad,
+                           const double& lambda, GSparseMatrix* factor) const;
+    void       alloc_trials(GOptimizerFunction* fct, GOptimizerPars* pars);
+    void       free_trials(void);
+    void       errors(GOptimizerFunction* fct, GOptimizerPars* pars);
+    void       profile_errors(GOptimizerFunction* fct, GOptimizerPars* pars);
+    double     profile_error(GOptimizerFunction* fct, GOptimizerPars* pars,
+                             const GOptimizerPars& best, const int& ipar,
+                             const double& sign) const;
+    double     profile_value(GOptimizerFunction* fct, GOptimizerPars* pars,
+                             const GOptimizerPars& best, const int& ipar,
+                             const double& value) const;
+    double     step_size(GVector* grad, GOptimizerPars* pars);
+    double     trial_step_size(const GVector& grad,
+                               const GOptimizerPars& pars) const;
+    GSymMatrix dense_covar(const GSparseMatrix& covar) const;
+    double     unit_solve(GSymMatrix* dense, GSparseMatrix* covar,
+                          const bool& use_dense, const int& ipar) const;
 
     // Protected members
     int               m_npars;           //!< Number of parameters
@@ -110,6 +153,7 @@ protected:
     int               m_max_stall;       //!< Maximum number of stalls
     int               m_max_hit;         //!< Maximum number of successive hits
     bool              m_step_adjust;     //!< Adjust step size to boundaries
+    int               m_lambda_trials;   //!< Number of concurrent lambda trials
     std::vector<bool> m_hit_boundary;    //!< Bookkeeping array for boundary hits
     std::vector<int>  m_hit_minimum;     //!< Bookkeeping of successive minimum hits
     std::vector<int>  m_hit_maximum;     //!< Bookkeeping of successive maximum hits
@@ -121,6 +165,13 @@ protected:
     int               m_status;          //!< Fit status
     int               m_iter;            //!< Iteration
     GLog*             m_logger;          //!< Pointer to optional logger
+    GSparseMatrix     m_factor;          //!< Symbolic analysis of last sparse factorisation
+    bool              m_covar_valid;     //!< Curvature matrix matches parameters
+    std::vector<GOptimizerFunction*> m_trial_fct;  //!< Trial function copies
+    std::vector<GOptimizerPars*>     m_trial_pars; //!< Trial parameter copies
+    std::vector<int>    m_profile;       //!< Parameters with profile errors
+    std::vector<double> m_error_lower;   //!< Lower profile errors
+    std::vector<double> m_error_upper;   //!< Upper profile errors
 
 };
 
@@ -31,6 +31,9 @@
 #include <string>
 #include "GBase.hpp"
 
+/* __ Definitions ________________________________________________________ */
+#define G_RAN_LANES 8    //!< Number of streams for filling arrays
+
 
 /***********************************************************************//**
  * @class GRan
@@ -38,6 +41,30 @@
  * @brief Random number generator class
  *
  * This class implements a random number generator.
+ *
+ * Independent streams of random numbers can be derived from a generator
+ * using stream(). The stream with a given index only depends on the seed
+ * of the generator, hence work that is split into a fixed number of
+ * chunks, each using its own stream, produces the same random numbers
+ * whatever the number of threads over which the chunks are distributed.
+ * A typical use is
+ *
+ *     GRan base(ran.int64());
+ *     #pragma omp parallel for
+ *     for (int i = 0; i < nchunks; ++i) {
+ *         GRan stream = base.stream(i);
+ *         ...
+ *     }
+ *
+ * where drawing the seed of @p base from @p ran makes successive uses
+ * of @p ran produce different streams.
+ *
+ * Arrays of random numbers are filled by the methods that take an output
+ * array. They split the generator into G_RAN_LANES streams that are
+ * advanced in lock step, so that the compiler can interleave or vectorise
+ * the updates of the streams. Each call draws one value from the generator
+ * to seed the streams. The results are hence reproducible, but differ from
+ * the values that are obtained by repeated calls of the scalar methods.
  ***************************************************************************/
 class GRan : public GBase {
 
@@ -55,12 +82,19 @@ public:
     void                   clear(void);
     GRan*                  clone(void) const;
     void                   seed(unsigned long long int seed);
+    GRan                   stream(const unsigned long long int& index) const;
     unsigned long int      int32(void);
     unsigned long long int int64(void);
     double                 uniform(void);
     double                 exp(const double& lambda);
     double                 poisson(const double& lambda);
     double                 chisq2(void);
+    void                   uniform(double* values, const int& number);
+    void                   exp(const double& lambda, double* values,
+                               const int& number);
+    void                   normal(double* values, const int& number);
+    void                   poisson(const double* lambda, double* values,
+                                   const int& number);
     std::string            print(void) const;
   
 protected:
@@ -68,6 +102,7 @@ protected:
     void                   init_members(unsigned long long int seed = 41L);
     void                   copy_members(const GRan& ran);
     void                   free_members(void);
+    void                   split(GRan* lanes);
 
     // Protected data members
     unsigned long long int m_seed;  //!< Random number generator seed
@@ -35,8 +35,10 @@
 #include "GSource.hpp"
 #include "GEnergy.hpp"
 #include "GTime.hpp"
+#include "GModelPar.hpp"
 #include "GModelRadial.hpp"
 #include "GIntegrand.hpp"
+#include "GFunction.hpp"
 #include "GMatrix.hpp"
 
 /* __ Forward declarations _______________________________________________ */
@@ -56,6 +58,8 @@ class GObservation;
  * and the true photon arrival time.
  * The npred method returns the integral of the instrument response function
  * over the dataspace. This method is only required for unbinned analysis.
+ * The isreentrant method signals whether the response may be evaluated by
+ * several threads concurrently.
  ***************************************************************************/
 class GResponse : public GBase {
 
@@ -81,9 +85,13 @@ public:
     virtual std::string print(void) const = 0;
 
     // Virtual methods
+    virtual bool   isreentrant(void) const;
     virtual double irf(const GEvent&       event,
                        const GSource&      source,
                        const GObservation& obs) const;
+    virtual double irf_gradients(const GEvent&       event,
+                                 const GSource&      source,
+                                 const GObservation& obs) const;
     virtual double irf_ptsrc(const GEvent&       event,
                              const GSource&      source,
                              const GObservation& obs) const;
@@ -108,6 +116,34 @@ protected:
     void copy_members(const GResponse& rsp);
     void free_members(void);
 
+    // Numerical spatial parameter gradient
+    double irf_grad(const GEvent&       event,
+                    const GSource&      source,
+                    const GObservation& obs,
+                    const int&          ipar) const;
+
+    // Spatial parameter gradient kernel
+    class irf_func : public GFunction {
+    public:
+        irf_func(const GResponse*    rsp,
+                 const GEvent*       event,
+                 const GSource*      source,
+                 const GObservation* obs,
+                 GModelPar*          par) :
+                 m_rsp(rsp),
+                 m_event(event),
+                 m_source(source),
+                 m_obs(obs),
+                 m_par(par) { }
+        double eval(double x);
+    protected:
+        const GResponse*    m_rsp;           //!< Pointer to response
+        const GEvent*       m_event;         //!< Pointer to event
+        const GSource*      m_source;        //!< Pointer to source
+        const GObservation* m_obs;           //!< Pointer to observation
+        GModelPar*          m_par;           //!< Pointer to spatial parameter
+    };
+
     // Npred theta integration kernel
     class npred_kern_theta : public GIntegrand {
     public:
@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GWcs.hpp"
 #include "GSkyDir.hpp"
@@ -93,6 +94,10 @@ public:
     GSkyPixel     dir2xy(const GSkyDir& dir) const;
     double        omega(const GSkyPixel& pix) const;
 
+    // Vector pixel methods
+    std::vector<GSkyDir>   xy2dir(const std::vector<GSkyPixel>& pixels) const;
+    std::vector<GSkyPixel> dir2xy(const std::vector<GSkyDir>& dirs) const;
+
     // Sky direction methods
     double        operator() (const GSkyDir& dir, const int& map = 0) const;
 
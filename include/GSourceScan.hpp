@@ -0,0 +1,104 @@
+/***************************************************************************
+ *                GSourceScan.hpp  -  Source scan class                    *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2012 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GSourceScan.hpp
+ * @brief Source scan class interface definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GSOURCESCAN_HPP
+#define GSOURCESCAN_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <string>
+#include "GBase.hpp"
+#include "GObservations.hpp"
+#include "GOptimizer.hpp"
+#include "GModels.hpp"
+#include "GModelSky.hpp"
+#include "GSkymap.hpp"
+#include "GSkyDir.hpp"
+
+
+/***********************************************************************//**
+ * @class GSourceScan
+ *
+ * @brief Source scan class interface defintion
+ *
+ * This class computes test statistic (TS) maps by fitting a test source
+ * at the position of each pixel of a sky map. The test source is a sky
+ * model with a point source spatial component, and is added to the
+ * models of the observation container. TS is twice the difference between
+ * the log-likelihood of the fit with and without the test source.
+ *
+ * The fits of the different pixels are independent and are distributed
+ * over the available threads. Each thread works on its own copy of the
+ * observations, of the models and of the optimizer, hence the memory
+ * needed for the observations grows with the number of threads. The
+ * optimizer used for the scan should not write into a logger.
+ *
+ * The observation container is not owned by the class, and needs to exist
+ * as long as the scan is used.
+ ***************************************************************************/
+class GSourceScan : public GBase {
+
+public:
+    // Constructors and destructors
+    GSourceScan(void);
+    GSourceScan(GObservations& obs, const GModelSky& source);
+    GSourceScan(const GSourceScan& scan);
+    virtual ~GSourceScan(void);
+
+    // Operators
+    GSourceScan& operator= (const GSourceScan& scan);
+
+    // Methods
+    void         clear(void);
+    GSourceScan* clone(void) const;
+    void         observations(GObservations& obs) { m_obs=&obs; }
+    void         source(const GModelSky& source);
+    void         nthreads(const int& nthreads);
+    const int&   nthreads(void) const { return m_nthreads; }
+    void         tsmap(GSkymap& map, const GOptimizer& opt);
+    double       ts(const GSkyDir& dir, const GOptimizer& opt);
+    double       null_value(void) const { return m_null_value; }
+    int          nfailed(void) const { return m_nfailed; }
+    std::string  print(void) const;
+
+protected:
+    // Protected methods
+    void   init_members(void);
+    void   copy_members(const GSourceScan& scan);
+    void   free_members(void);
+    void   fit_null(const GOptimizer& opt);
+    double fit_source(GObservations* obs, const GSkyDir& dir,
+                      GOptimizer& opt, GModels& models) const;
+
+    // Protected members
+    GObservations* m_obs;          //!< Observations (not owned)
+    GModelSky*     m_source;       //!< Test source template
+    GModels        m_null;         //!< Fitted models without test source
+    double         m_null_value;   //!< Function value without test source
+    int            m_nthreads;     //!< Number of threads (0 = all)
+    int            m_nfailed;      //!< Number of failed fits in last scan
+};
+
+#endif /* GSOURCESCAN_HPP */
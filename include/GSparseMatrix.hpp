@@ -133,9 +133,13 @@ public:
     void    insert_col(const double* values, const int* rows,
                        int number, const int& col);
     void    cholesky_decompose(bool compress = true);
+    void    cholesky_decompose(const GSparseMatrix& factor,
+                               bool compress = true);
+    void    cholesky_symbolic(const GSparseMatrix& factor);
     GVector cholesky_solver(const GVector& vector, bool compress = true);
     void    cholesky_invert(bool compress = true);
     void    set_mem_block(const int& block);
+    void    zero(void);
     void    stack_init(const int& size = 0, const int& entries = 0);
     int     stack_push_column(const GVector& vector, const int& col);
     int     stack_push_column(const double* values, const int* rows,
@@ -153,6 +157,7 @@ private:
     void free_stack_members(void);
     int  get_index(const int& row, const int& col) const;
     void fill_pending(void);
+    void cholesky_factorise(const GSparseSymbolic* reuse, bool compress);
     void alloc_elements(int start, const int& num);
     void free_elements(const int& start, const int& num);
     void remove_zero_row_col(void);
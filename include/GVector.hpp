@@ -42,6 +42,12 @@
  * This class implement a double precision floating point vector class that
  * is intended to be used for numerical computation (it is not ment to
  * replace the std::vector template class).
+ *
+ * Binary operators return a new vector. In inner loops, the in-place
+ * operators and the fused axpy() method should be preferred as they do not
+ * create temporary vectors. The reductions (scalar product, norm() and
+ * sum()) use four independent partial sums, which allows the compiler to
+ * vectorise the loops.
  ***************************************************************************/
 class GVector : public GBase {
 
@@ -112,6 +118,7 @@ public:
     GVector  operator-() const;
 
     // Vector methods
+    GVector&    axpy(const double& a, const GVector& x);
     void        clear(void);
     GVector*    clone(void) const;
     int         size(void) const;
@@ -158,6 +165,18 @@ GVector& GVector::operator-= (const GVector& v)
     return *this;
 }
 
+// Fused scaled vector addition (this += a * x)
+inline
+GVector& GVector::axpy(const double& a, const GVector& x)
+{
+    if (m_num != x.m_num)
+        throw GException::vector_mismatch("GVector::axpy(double,GVector)",
+                                          m_num, x.m_num);
+    for (int i = 0; i < m_num; ++i)
+        m_data[i] += a * x.m_data[i];
+    return *this;
+}
+
 // Scalar assignment operator
 inline
 GVector& GVector::operator= (const double& v)
@@ -285,10 +304,20 @@ double operator* (const GVector& a, const GVector& b)
     if (a.m_num != b.m_num)
         throw GException::vector_mismatch("operator*(GVector, GVector)",
                                           a.m_num, b.m_num);
-    double result = 0.0;
-    for (int i = 0; i < a.m_num; ++i)
-        result += (a.m_data[i] * b.m_data[i]);
-    return result;
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    int    n4 = a.m_num - a.m_num % 4;
+    for (int i = 0; i < n4; i += 4) {
+        s0 += a.m_data[i]   * b.m_data[i];
+        s1 += a.m_data[i+1] * b.m_data[i+1];
+        s2 += a.m_data[i+2] * b.m_data[i+2];
+        s3 += a.m_data[i+3] * b.m_data[i+3];
+    }
+    for (int i = n4; i < a.m_num; ++i)
+        s0 += a.m_data[i] * b.m_data[i];
+    return (s0 + s1) + (s2 + s3);
 }
 
 // Vector * double
@@ -322,9 +351,7 @@ GVector operator/ (const GVector& a, const double& b)
 inline
 double norm(const GVector &v)
 {
-    double result = 0.0;
-    for (int i = 0; i < v.m_num; ++i)
-        result += (v.m_data[i] * v.m_data[i]);
+    double result = v * v;
     result = (result > 0.0) ? std::sqrt(result) : 0.0;
     return result;
 }
@@ -357,10 +384,20 @@ double max(const GVector &v)
 inline
 double sum(const GVector &v)
 {
-    double result = 0.0;
-    for (int i = 0; i < v.m_num; ++i)
-        result += v.m_data[i];
-    return result;
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    int    n4 = v.m_num - v.m_num % 4;
+    for (int i = 0; i < n4; i += 4) {
+        s0 += v.m_data[i];
+        s1 += v.m_data[i+1];
+        s2 += v.m_data[i+2];
+        s3 += v.m_data[i+3];
+    }
+    for (int i = n4; i < v.m_num; ++i)
+        s0 += v.m_data[i];
+    return (s0 + s1) + (s2 + s3);
 }
 
 // Vector permutation
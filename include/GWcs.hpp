@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GFitsHDU.hpp"
 #include "GSkyDir.hpp"
@@ -71,8 +72,10 @@ public:
     virtual std::string print(void) const = 0;
 
     // Virtual methods
-    virtual std::string coordsys(void) const;
-    virtual void        coordsys(const std::string& coordsys);
+    virtual std::string            coordsys(void) const;
+    virtual void                   coordsys(const std::string& coordsys);
+    virtual std::vector<GSkyDir>   xy2dir(const std::vector<GSkyPixel>& pixels) const;
+    virtual std::vector<GSkyPixel> dir2xy(const std::vector<GSkyDir>& dirs) const;
 
 protected:
     // Protected methods
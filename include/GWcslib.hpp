@@ -67,14 +67,16 @@ public:
     virtual std::string print(void) const = 0;
     
     // Implemented virtual methods
-    virtual void        read(const GFitsHDU* hdu);
-    virtual void        write(GFitsHDU* hdu) const;
-    virtual double      omega(const int& pix) const;
-    virtual double      omega(const GSkyPixel& pix) const;
-    virtual GSkyDir     pix2dir(const int& pix) const;
-    virtual int         dir2pix(const GSkyDir& dir) const;
-    virtual GSkyDir     xy2dir(const GSkyPixel& pix) const;
-    virtual GSkyPixel   dir2xy(const GSkyDir& dir) const;
+    virtual void                   read(const GFitsHDU* hdu);
+    virtual void                   write(GFitsHDU* hdu) const;
+    virtual double                 omega(const int& pix) const;
+    virtual double                 omega(const GSkyPixel& pix) const;
+    virtual GSkyDir                pix2dir(const int& pix) const;
+    virtual int                    dir2pix(const GSkyDir& dir) const;
+    virtual GSkyDir                xy2dir(const GSkyPixel& pix) const;
+    virtual GSkyPixel              dir2xy(const GSkyDir& dir) const;
+    virtual std::vector<GSkyDir>   xy2dir(const std::vector<GSkyPixel>& pixels) const;
+    virtual std::vector<GSkyPixel> dir2xy(const std::vector<GSkyDir>& dirs) const;
 
     // Other methods
     void   set(const std::string& coords,
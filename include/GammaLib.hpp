@@ -105,6 +105,7 @@
 /* __ Optimizer module ___________________________________________________ */
 #include "GOptimizer.hpp"
 #include "GOptimizerLM.hpp"
+#include "GOptimizerLBFGS.hpp"
 #include "GOptimizerPars.hpp"
 #include "GOptimizerFunction.hpp"
 
@@ -136,6 +137,7 @@
 #include "GTime.hpp"
 #include "GCaldb.hpp"
 #include "GObservations.hpp"
+#include "GSourceScan.hpp"
 #include "GObservation.hpp"
 #include "GObservationRegistry.hpp"
 #include "GEvents.hpp"
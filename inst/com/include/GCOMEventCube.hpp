@@ -86,6 +86,8 @@ public:
     int                    npsi(void) const { return m_map.ny(); }
     int                    nphi(void) const { return m_map.nmaps(); }
     int                    npix(void) const { return m_map.npix(); }
+    virtual GCOMEventBin*  view(void) const { return new GCOMEventBin; }
+    virtual const GEvent*  event(const int& index, GEvent* view) const;
 
 protected:
     // Protected methods
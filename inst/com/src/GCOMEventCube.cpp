@@ -39,6 +39,7 @@
 #define G_SET_SCATTER_DIRECTIONS    "GCOMEventCube::set_scatter_directions()"
 #define G_SET_ENERGIES                        "GCOMEventCube::set_energies()"
 #define G_SET_TIMES                              "GCOMEventCube::set_times()"
+#define G_EVENT                       "GCOMEventCube::event(int&, GEvent*)"
 #define G_SET_BIN                              "GCOMEventCube::set_bin(int&)"
 
 /* __ Macros _____________________________________________________________ */
@@ -580,6 +581,66 @@ std::string GCOMEventCube::print(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return event bin using an event view
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event bin allocated by view().
+ *
+ * @exception GException::out_of_range
+ *            Event index is outside valid range.
+ * @exception GCOMException::no_dirs
+ *            Sky directions and solid angles vectors have not been set up.
+ *
+ * Copies the attributes of the bin with the specified @p index into the
+ * event bin @p view and returns a pointer to it. As the event bin holds
+ * copies, modifying it does not alter the event cube. If @p view is not an
+ * event bin, the event bin of the cube is used.
+ ***************************************************************************/
+const GEvent* GCOMEventCube::event(const int& index, GEvent* view) const
+{
+    // Get event bin
+    GCOMEventBin* bin = dynamic_cast<GCOMEventBin*>(view);
+
+    // Use event bin of cube if no event bin was provided
+    if (bin == NULL) {
+        return ((*this)[index]);
+    }
+
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_EVENT, index, 0, size()-1);
+    }
+    #endif
+
+    // Check for the existence of sky directions and solid angles
+    if (m_dirs.size() != npix() || m_omega.size() != npix()) {
+        throw GCOMException::no_dirs(G_EVENT);
+    }
+
+    // Get pixel and energy bin indices.
+    int ipix = index % npix();
+    int iphi = index / npix();
+
+    // Set index
+    bin->m_index = index;
+
+    // Copy bin attributes
+    bin->m_dir->dir(m_dirs[ipix]);
+    bin->m_dir->phibar(m_phi[iphi]);
+    *(bin->m_counts) = m_map.pixels()[index];
+    *(bin->m_omega)  = m_omega[ipix];
+    *(bin->m_time)   = m_time;
+    *(bin->m_ontime) = m_ontime;
+    *(bin->m_energy) = m_energy;
+    *(bin->m_ewidth) = m_ewidth;
+
+    // Return event bin
+    return bin;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
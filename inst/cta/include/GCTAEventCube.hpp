@@ -83,6 +83,8 @@ public:
     int                    ny(void) const { return m_map.ny(); }
     int                    npix(void) const { return m_map.npix(); }
     int                    ebins(void) const { return m_map.nmaps(); }
+    virtual GCTAEventBin*  view(void) const { return new GCTAEventBin; }
+    virtual const GEvent*  event(const int& index, GEvent* view) const;
 
 protected:
     // Protected methods
@@ -96,6 +98,7 @@ protected:
     virtual void set_energies(void);
     virtual void set_times(void);
     void         set_bin(const int& index);
+    void         set_bin(const int& index, GCTAEventBin& bin);
 
     // Protected members
     GSkymap                  m_map;        //!< Counts map stored as sky map
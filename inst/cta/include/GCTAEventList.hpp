@@ -43,7 +43,34 @@
  *
  * @brief CTA event atom container class
  *
- * This class is a container class for CTA event atoms.
+ * This class is a container class for CTA event atoms. Events are stored
+ * in columns: the arrival time, the sky direction and the logarithm of the
+ * energy are held in contiguous arrays that are scanned by the likelihood
+ * computation. The auxiliary shower parameters (identifiers, core position,
+ * Hillas parameters, ...) are only read from the FITS file when they are
+ * needed, which is the case if the event list is written or extended by
+ * another list, if events are appended or set, or if an event is accessed
+ * using the non-const access operator. Until then the event list, and any
+ * copy of it, depends on the FITS file from which it was read: the file
+ * must neither be removed nor modified, and a
+ * GCTAException::file_open_error exception is thrown if it is no longer
+ * accessible when the auxiliary parameters are needed. Event lists that
+ * were read from a FITS object that is not attached to a file read the
+ * auxiliary parameters immediately.
+ *
+ * The read() and load() methods optionally take an energy range, Good Time
+ * Intervals and a region of interest. The selection is then applied while
+ * scanning the FITS table, hence only the selected events are held in
+ * memory, and only their auxiliary parameters are read from the file when
+ * needed.
+ *
+ * The access operator returns a pointer to an event atom view that is
+ * filled from the columns on each call, hence the pointer is only valid
+ * until the next access. The view that is returned by the non-const access
+ * operator may be modified, and the modifications are written back into
+ * the event list at the next access. The event() method fills an event
+ * atom that is owned by the caller and may be used by several threads
+ * concurrently.
  ***************************************************************************/
 class GCTAEventList : public GEventList {
 
@@ -61,39 +88,99 @@ public:
     // Implemented pure virtual base class methods
     virtual void           clear(void);
     virtual GCTAEventList* clone(void) const;
-    virtual int            size(void) const { return m_events.size(); }
+    virtual int            size(void) const { return m_time.size(); }
     virtual void           load(const std::string& filename);
     virtual void           save(const std::string& filename, bool clobber = false) const;
     virtual void           read(const GFits& file);
     virtual void           write(GFits& file) const;
-    virtual int            number(void) const { return m_events.size(); }
+    virtual int            number(void) const { return m_time.size(); }
     virtual void           roi(const GRoi& roi);
     virtual const GCTARoi& roi(void) const { return m_roi; }
+    virtual GCTAEventAtom* view(void) const { return new GCTAEventAtom; }
+    virtual const GEvent*  event(const int& index, GEvent* view) const;
     std::string            print(void) const;
 
     // Implement other methods
+    void                   load(const std::string& filename,
+                                const GEbounds& ebounds, const GGti& gti,
+                                const GCTARoi& roi);
+    void                   read(const GFits& file,
+                                const GEbounds& ebounds, const GGti& gti,
+                                const GCTARoi& roi);
     void                   append(const GCTAEventAtom& event);
+    void                   extend(const GCTAEventList& list);
     void                   reserve(const int& number);
+    void                   event(const int& index, GCTAEventAtom& event) const;
+    void                   set(const int& index, const GCTAEventAtom& event);
 
 protected:
     // Protected methods
-    void         init_members(void);
-    void         copy_members(const GCTAEventList& list);
-    void         free_members(void);
-    virtual void set_energies(void) { return; }
-    virtual void set_times(void) { return; }
-    void         read_events(const GFitsTable* hdu);
-    void         read_events_v0(const GFitsTable* hdu);
-    void         read_events_v1(const GFitsTable* hdu);
-    void         read_events_hillas(const GFitsTable* hdu);
-    void         read_ds_ebounds(const GFitsHDU* hdu);
-    void         read_ds_roi(const GFitsHDU* hdu);
-    void         write_events(GFitsBinTable* hdu) const;
-    void         write_ds_keys(GFitsHDU* hdu) const;
+    void           init_members(void);
+    void           copy_members(const GCTAEventList& list);
+    void           free_members(void);
+    virtual void   set_energies(void) { return; }
+    virtual void   set_times(void) { return; }
+    void           fetch_columns(void) const;
+    void           flush_event(void);
+    void           read_events(const GFitsTable* hdu, const GEbounds& ebounds,
+                               const GGti& gti, const GCTARoi& roi);
+    int            table_row(const int& index) const;
+    void           read_columns(const GFitsTable* hdu) const;
+    void           read_events_v0(const GFitsTable* hdu) const;
+    void           read_events_v1(const GFitsTable* hdu) const;
+    void           read_events_hillas(const GFitsTable* hdu) const;
+    void           read_ds_ebounds(const GFitsHDU* hdu);
+    void           read_ds_roi(const GFitsHDU* hdu);
+    void           select_ebounds(const GEbounds& ebounds);
+    void           select_gti(const GGti& gti);
+    void           select_roi(const GCTARoi& roi);
+    void           write_events(GFitsBinTable* hdu) const;
+    void           write_ds_keys(GFitsHDU* hdu) const;
+
+    // Auxiliary information of one event
+    struct event_aux {
+        event_aux(void) : event_id(0), obs_id(0), multip(0), telmask(0),
+                       dir_err(0.0), detx(0.0), dety(0.0), alt(0.0),
+                       az(0.0), corex(0.0), corey(0.0), core_err(0.0),
+                       xmax(0.0), xmax_err(0.0), shwidth(0.0),
+                       shlength(0.0), energy_err(0.0), hil_msw(0.0),
+                       hil_msw_err(0.0), hil_msl(0.0), hil_msl_err(0.0) {}
+        unsigned long event_id;
+        unsigned long obs_id;
+        int           multip;
+        char          telmask;
+        float         dir_err;
+        float         detx;
+        float         dety;
+        float         alt;
+        float         az;
+        float         corex;
+        float         corey;
+        float         core_err;
+        float         xmax;
+        float         xmax_err;
+        float         shwidth;
+        float         shlength;
+        float         energy_err;
+        float         hil_msw;
+        float         hil_msw_err;
+        float         hil_msl;
+        float         hil_msl_err;
+    };
 
     // Protected members
-    GCTARoi                    m_roi;     //!< Region of interest
-    std::vector<GCTAEventAtom> m_events;  //!< Events
+    GCTARoi                             m_roi;           //!< Region of interest
+    std::vector<double>                 m_time;          //!< Event times (MET)
+    std::vector<double>                 m_ra;            //!< Right Ascension (radians)
+    std::vector<double>                 m_dec;           //!< Declination (radians)
+    std::vector<double>                 m_logE;          //!< log10 of event energy (MeV)
+    std::string                         m_filename;      //!< File for auxiliary columns
+    std::vector<int>                    m_rows;          //!< Table rows of events (empty=all rows)
+    mutable bool                        m_has_aux;       //!< Auxiliary columns loaded
+    mutable std::vector<event_aux>      m_aux;           //!< Auxiliary information per event
+    mutable GCTAEventAtom               m_event;         //!< Event view
+    int                                 m_pending;       //!< Index of modifiable event view (-1=none)
+    GCTAEventAtom                       m_pending_event; //!< Modifiable event view
 };
 
 #endif /* GCTAEVENTLIST_HPP */
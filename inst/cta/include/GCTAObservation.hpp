@@ -28,11 +28,14 @@
 #define GCTAOBSERVATION_HPP
 
 /* __ Includes ___________________________________________________________ */
+#include <string>
+#include <vector>
 #include "GObservation.hpp"
 #include "GCTAPointing.hpp"
 #include "GCTAResponse.hpp"
 #include "GTime.hpp"
 #include "GModel.hpp"
+#include "GModelSky.hpp"
 #include "GFitsTable.hpp"
 
 
@@ -42,6 +45,19 @@
  * @brief CTA observation class
  *
  * This class implements a CTA observation.
+ *
+ * For binned analysis, an IRF cache can be enabled using irf_cache(true).
+ * The cache stores, for each sky model with fixed spatial parameters, the
+ * IRF value of every bin of the counts cube. A cache entry is identified by
+ * the source name and the type and real parameter values of its spatial
+ * model, and a new entry is computed when the spatial parameters change.
+ * The cache is cleared when the response, the pointing or the events are
+ * set.
+ *
+ * Cache entries are computed for all bins before they are added, and they
+ * are neither modified nor removed afterwards. The cache is shared between
+ * copies of an observation and is protected by its own lock, hence copies
+ * may be evaluated concurrently.
  ***************************************************************************/
 class GCTAObservation : public GObservation {
 
@@ -69,6 +85,10 @@ public:
     virtual void             write(GXmlElement& xml) const;
     virtual std::string      print(void) const;
 
+    // Overloaded base class methods
+    using GObservation::events;
+    virtual void             events(const GEvents* events);
+
     // Other methods
     void        load_unbinned(const std::string& filename);
     void        load_binned(const std::string& filename);
@@ -86,6 +106,8 @@ public:
     double      dec_obj(void) const { return m_dec_obj; }
     std::string eventfile(void) const { return m_eventfile; }
     void        eventfile(const std::string& filename) { m_eventfile = filename; }
+    void        irf_cache(const bool& cache);
+    bool        irf_cache(void) const { return m_irf_cache; }
 
 protected:
     // Protected methods
@@ -94,6 +116,17 @@ protected:
     void free_members(void);
     void read_attributes(const GFitsHDU* hdu);
     void write_attributes(GFitsHDU* hdu) const;
+    void clear_irf_cache(void);
+
+    // Model evaluation for event ranges
+    virtual void model_range(const GModel& model, const int& ibegin,
+                             const int& iend, double* values,
+                             double* gradients, GEvent* view) const;
+    const double* cached_irfs(const GModelSky& model) const;
+
+    // IRF cache shared between copies of the observation
+    class irf_store;
+    void release_irf_cache(void);
 
     // Npred integration methods
     double npred_temp(const GModel& model) const;
@@ -109,6 +142,8 @@ protected:
     double        m_deadc;        //!< Deadtime correction
     double        m_ra_obj;       //!< Right Ascension of object
     double        m_dec_obj;      //!< Declination of object
+    bool          m_irf_cache;    //!< Use IRF cache for binned analysis
+    irf_store*    m_cache_irfs;   //!< IRF cache (shared between copies)
 };
 
 #endif /* GCTAOBSERVATION_HPP */
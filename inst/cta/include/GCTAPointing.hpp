@@ -42,6 +42,9 @@
  *
  * This class implements a CTA pointing. For the time being it is assumed
  * that the pointing direction is time-independent.
+ *
+ * The rotation matrix is computed whenever the pointing direction is set,
+ * hence a pointing can be shared by several threads.
  ***************************************************************************/
 class GCTAPointing : public GPointing {
 
@@ -72,16 +75,13 @@ protected:
     void init_members(void);
     void copy_members(const GCTAPointing& pnt);
     void free_members(void);
-    void update(void) const;
+    void update(void);
 
     // Protected members
     GSkyDir         m_dir;        //!< Pointing direction in sky coordinates
     double          m_zenith;     //!< Pointing zenith angle
     double          m_azimuth;    //!< Pointing azimuth angle
-
-    // Cached members
-    mutable bool    m_has_cache;  //!< Has transformation cache
-    mutable GMatrix m_Rback;      //!< Rotation matrix
+    GMatrix         m_Rback;      //!< Rotation matrix
 };
 
 #endif /* GCTAPOINTING_HPP */
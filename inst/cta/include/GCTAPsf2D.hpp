@@ -42,6 +42,10 @@
  *
  * This class implements the CTA point spread function response as function
  * of energy and offset angle.
+ *
+ * The Gaussian parameters are computed by each method call and are not
+ * stored in the object, hence a point spread function can be shared by
+ * several threads.
  ***************************************************************************/
 class GCTAPsf2D : public GCTAPsf {
 
@@ -80,31 +84,39 @@ public:
                           const double& zenith = 0.0,
                           const double& azimuth = 0.0,
                           const bool&   etrue = true) const;
+    double      derivative(const double& delta,
+                           const double& logE, 
+                           const double& theta = 0.0, 
+                           const double& phi = 0.0,
+                           const double& zenith = 0.0,
+                           const double& azimuth = 0.0,
+                           const bool&   etrue = true) const;
     std::string print(void) const;
 
 private:
+    // Gaussian parameters for a given energy and offset angle
+    struct gauss_pars {
+        double norm;    //!< Global normalization
+        double norm2;   //!< Gaussian 2 normalization
+        double norm3;   //!< Gaussian 3 normalization
+        double sigma1;  //!< Gaussian 1 sigma
+        double sigma2;  //!< Gaussian 2 sigma
+        double sigma3;  //!< Gaussian 3 sigma
+        double width1;  //!< Gaussian 1 width
+        double width2;  //!< Gaussian 2 width
+        double width3;  //!< Gaussian 3 width
+    };
+
     // Methods
     void init_members(void);
     void copy_members(const GCTAPsf2D& psf);
     void free_members(void);
-    void update(const double& logE, const double& theta) const;
+    void update(const double& logE, const double& theta,
+                gauss_pars& pars) const;
 
     // Members
     std::string       m_filename;   //!< Name of Aeff response file
     GCTAResponseTable m_psf;        //!< PSF response table
-
-    // Precomputation cache
-    mutable double    m_par_logE;   //!< Cache energy
-    mutable double    m_par_theta;  //!< Cache offset angle
-    mutable double    m_norm;       //!< Global normalization
-    mutable double    m_norm2;      //!< Gaussian 2 normalization
-    mutable double    m_norm3;      //!< Gaussian 3 normalization
-    mutable double    m_sigma1;     //!< Gaussian 1 sigma
-    mutable double    m_sigma2;     //!< Gaussian 2 sigma
-    mutable double    m_sigma3;     //!< Gaussian 3 sigma
-    mutable double    m_width1;     //!< Gaussian 1 width
-    mutable double    m_width2;     //!< Gaussian 2 width
-    mutable double    m_width3;     //!< Gaussian 3 width
 };
 
 #endif /* GCTAPSF2D_HPP */
@@ -44,6 +44,10 @@
  * of energy as determined from a performance table. The performance table is
  * an ASCII file that specifies the CTA performance parameters in a simple
  * way.
+ *
+ * The Gaussian parameters are computed by each method call and are not
+ * stored in the object, hence a point spread function can be shared by
+ * several threads.
  ***************************************************************************/
 class GCTAPsfPerfTable : public GCTAPsf {
 
@@ -82,6 +86,13 @@ public:
                                 const double& zenith = 0.0,
                                 const double& azimuth = 0.0,
                                 const bool&   etrue = true) const;
+    double            derivative(const double& delta,
+                                 const double& logE, 
+                                 const double& theta = 0.0, 
+                                 const double& phi = 0.0,
+                                 const double& zenith = 0.0,
+                                 const double& azimuth = 0.0,
+                                 const bool&   etrue = true) const;
     std::string       print(void) const;
 
 private:
@@ -89,7 +100,8 @@ private:
     void init_members(void);
     void copy_members(const GCTAPsfPerfTable& psf);
     void free_members(void);
-    void update(const double& logE) const;
+    void update(const double& logE, double& scale, double& sigma,
+                double& width) const;
 
     // Members
     std::string         m_filename;  //!< Name of Aeff response file
@@ -97,12 +109,6 @@ private:
     std::vector<double> m_r68;       //!< 68% containment radius of PSF in degrees
     std::vector<double> m_r80;       //!< 80% containment radius of PSF in degrees
     std::vector<double> m_sigma;     //!< Sigma value of PSF in radians
-
-    // Precomputation cache
-    mutable double      m_par_logE;  //!< Energy for which precomputation is done
-    mutable double      m_par_scale; //!< Gaussian normalization
-    mutable double      m_par_sigma; //!< Gaussian sigma (radians)
-    mutable double      m_par_width; //!< Gaussian width parameter
 };
 
 #endif /* GCTAPSFPERFTABLE_HPP */
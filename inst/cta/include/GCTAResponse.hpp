@@ -64,12 +64,17 @@
 
 /* __ Forward declaration ________________________________________________ */
 class GCTAObservation;
+class GCTAEventList;
 
 
 /***********************************************************************//**
  * @class GCTAResponse
  *
  * @brief Interface for the CTA instrument response function
+ *
+ * The response components and the pointing do not hold caches that are
+ * updated on access, hence a response can be evaluated concurrently by
+ * several threads.
  ***************************************************************************/
 class GCTAResponse : public GResponse {
 
@@ -96,6 +101,10 @@ public:
     virtual std::string   print(void) const;
 
     // Overload virtual base class methods
+    virtual bool   isreentrant(void) const { return true; }
+    virtual double irf_gradients(const GEvent&       event,
+                                 const GSource&      source,
+                                 const GObservation& obs) const;
     virtual double irf_extended(const GEvent&       event,
                                 const GSource&      source,
                                 const GObservation& obs) const;
@@ -110,11 +119,19 @@ public:
     // Other Methods
     GCTAEventAtom*  mc(const double& area, const GPhoton& photon,
                        const GObservation& obs, GRan& ran) const;
+    bool            mc(const double& area, const GPhoton& photon,
+                       const GObservation& obs, GRan& ran,
+                       GCTAEventAtom& event) const;
+    void            mc(const double& area, const GPhotons& photons,
+                       const GObservation& obs, GRan& ran,
+                       GCTAEventList& events) const;
     void            caldb(const std::string& caldb);
     std::string     caldb(void) const { return m_caldb; }
     void            load(const std::string& rspname);
     void            eps(const double& eps) { m_eps=eps; }
     const double&   eps(void) const { return m_eps; }
+    void            integration(const std::string& method);
+    const std::string& integration(void) const { return m_integration; }
     std::string     rmffile(void) const { return m_rmffile; }
     void            load_aeff(const std::string& filename);
     void            load_psf(const std::string& filename);
@@ -138,6 +155,12 @@ public:
                const double& zenith,
                const double& azimuth,
                const double& srcLogEng) const;
+    double psf_derivative(const double& delta,
+                          const double& theta,
+                          const double& phi,
+                          const double& zenith,
+                          const double& azimuth,
+                          const double& srcLogEng) const;
     double psf_delta_max(const double& theta,
                          const double& phi,
                          const double& zenith,
@@ -165,12 +188,20 @@ private:
     void init_members(void);
     void copy_members(const GCTAResponse& rsp);
     void free_members(void);
+    double irf_ptsrc_gradients(const GEvent&       event,
+                               const GSource&      source,
+                               const GObservation& obs) const;
+    double irf_radial(const GEvent&       event,
+                      const GSource&      source,
+                      const GObservation& obs,
+                      const bool&         grad) const;
 
     // Private data members
     std::string         m_caldb;        //!< Name of or path to the calibration database
     std::string         m_rspname;      //!< Name of the instrument response
     std::string         m_rmffile;      //!< Name of RMF file
     double              m_eps;          //!< Integration precision
+    std::string         m_integration;  //!< IRF integration method
     GCTAAeff*           m_aeff;         //!< Effective area
     GCTAPsf*            m_psf;          //!< Point spread function
     GCTAEdisp*          m_edisp;        //!< Energy dispersion
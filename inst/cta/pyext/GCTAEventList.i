@@ -45,18 +45,27 @@ public:
     // Implemented pure virtual base class methods
     virtual void           clear(void);
     virtual GCTAEventList* clone(void) const;
-    virtual int            size(void) const { return m_events.size(); }
+    virtual int            size(void) const { return m_time.size(); }
     virtual void           load(const std::string& filename);
     virtual void           save(const std::string& filename, bool clobber = false) const;
     virtual void           read(const GFits& file);
     virtual void           write(GFits& file) const;
-    virtual int            number(void) const { return m_events.size(); }
+    virtual int            number(void) const { return m_time.size(); }
     virtual void           roi(const GRoi& roi);
     virtual const GCTARoi& roi(void) const { return m_roi; }
 
     // Implement other methods
+    void                   load(const std::string& filename,
+                                const GEbounds& ebounds, const GGti& gti,
+                                const GCTARoi& roi);
+    void                   read(const GFits& file,
+                                const GEbounds& ebounds, const GGti& gti,
+                                const GCTARoi& roi);
     void                   append(const GCTAEventAtom& event);
+    void                   extend(const GCTAEventList& list);
     void                   reserve(const int& number);
+    void                   event(const int& index, GCTAEventAtom& event) const;
+    void                   set(const int& index, const GCTAEventAtom& event);
 };
 
 
@@ -75,7 +84,7 @@ public:
     }
     void __setitem__(int index, const GCTAEventAtom& val) {
         if (index>=0 && index < self->size())
-            *((*self)[index]) = val;
+            self->set(index, val);
         else
             throw GException::out_of_range("__setitem__(int)", index, self->size());
     }
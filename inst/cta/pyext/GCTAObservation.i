@@ -71,6 +71,8 @@ public:
     double      dec_obj(void) const;
     std::string eventfile(void) const;
     void        eventfile(const std::string& filename);
+    void        irf_cache(const bool& cache);
+    bool        irf_cache(void) const;
 };
 
 
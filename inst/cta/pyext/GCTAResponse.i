@@ -55,6 +55,10 @@ public:
                                 const GObservation& obs) const;
 
     // Overload virtual base class methods
+    virtual bool   isreentrant(void) const;
+    virtual double irf_gradients(const GEvent&       event,
+                                 const GSource&      source,
+                                 const GObservation& obs) const;
     virtual double irf_extended(const GEvent&       event,
                                 const GSource&      source,
                                 const GObservation& obs) const;
@@ -69,11 +73,16 @@ public:
     // Other Methods
     GCTAEventAtom*  mc(const double& area, const GPhoton& photon,
                        const GObservation& obs, GRan& ran) const;
+    void            mc(const double& area, const GPhotons& photons,
+                       const GObservation& obs, GRan& ran,
+                       GCTAEventList& events) const;
     void            caldb(const std::string& caldb);
     std::string     caldb(void) const;
     void            load(const std::string& rspname);
     void            eps(const double& eps);
     const double&   eps(void) const;
+    void            integration(const std::string& method);
+    const std::string& integration(void) const;
     std::string     rmffile(void) const;
     void            load_aeff(const std::string& filename);
     void            load_psf(const std::string& filename);
@@ -97,6 +106,12 @@ public:
                const double& zenith,
                const double& azimuth,
                const double& srcLogEng) const;
+    double psf_derivative(const double& delta,
+                          const double& theta,
+                          const double& phi,
+                          const double& zenith,
+                          const double& azimuth,
+                          const double& srcLogEng) const;
     double psf_delta_max(const double& theta,
                          const double& phi,
                          const double& zenith,
@@ -38,7 +38,7 @@
 #define G_SET_DIRECTIONS                    "GCTAEventCube::set_directions()"
 #define G_SET_ENERGIES                        "GCTAEventCube::set_energies()"
 #define G_SET_TIME                                "GCTAEventCube::set_time()"
-#define G_SET_BIN                              "GCTAEventCube::set_bin(int&)"
+#define G_SET_BIN                "GCTAEventCube::set_bin(int&, GCTAEventBin&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -483,6 +483,34 @@ std::string GCTAEventCube::print(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return event bin using an event view
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event bin allocated by view().
+ *
+ * Sets up the event bin @p view for the specified @p index and returns a
+ * pointer to it. If @p view is not an event bin, the event bin of the cube
+ * is used.
+ ***************************************************************************/
+const GEvent* GCTAEventCube::event(const int& index, GEvent* view) const
+{
+    // Get event bin
+    GCTAEventBin* bin = dynamic_cast<GCTAEventBin*>(view);
+
+    // Use event bin of cube if no event bin was provided
+    if (bin == NULL) {
+        return ((*this)[index]);
+    }
+
+    // Set event bin (circumvent const correctness)
+    (const_cast<GCTAEventCube*>(this))->set_bin(index, *bin);
+
+    // Return event bin
+    return bin;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -647,15 +675,25 @@ void GCTAEventCube::set_directions(void)
     m_dirs.reserve(npix());
     m_omega.reserve(npix());
 
-    // Set pixel directions and solid angles
+    // Set pixels
+    std::vector<GSkyPixel> pixels;
+    pixels.reserve(npix());
     for (int iy = 0; iy < ny(); ++iy) {
         for (int ix = 0; ix < nx(); ++ix) {
-            GSkyPixel pixel = GSkyPixel(double(ix), double(iy));
-            m_dirs.push_back(GCTAInstDir(m_map.xy2dir(pixel)));
-            m_omega.push_back(m_map.omega(pixel));
+            pixels.push_back(GSkyPixel(double(ix), double(iy)));
         }
     }
 
+    // Transform all pixels into sky directions in a single pass
+    std::vector<GSkyDir> dirs = m_map.xy2dir(pixels);
+
+    // Set pixel directions and solid angles
+    int num = pixels.size();
+    for (int i = 0; i < num; ++i) {
+        m_dirs.push_back(GCTAInstDir(dirs[i]));
+        m_omega.push_back(m_map.omega(pixels[i]));
+    }
+
     // Return
     return;
 }
@@ -748,6 +786,33 @@ void GCTAEventCube::set_times(void)
  * as if they were stored in an array.
  ***************************************************************************/
 void GCTAEventCube::set_bin(const int& index)
+{
+    // Set event bin of cube
+    set_bin(index, m_bin);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set event bin
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[out] bin Event bin.
+ *
+ * @exception GException::out_of_range
+ *            Event index is outside valid range.
+ * @exception GCTAException::no_energies
+ *            Energy vectors have not been set up.
+ * @exception GCTAException::no_dirs
+ *            Sky directions and solid angles vectors have not been set up.
+ *
+ * Sets up the pointers of the event bin @p bin so that they point to the
+ * information of the bin with the specified @p index. The method does not
+ * modify the event cube.
+ ***************************************************************************/
+void GCTAEventCube::set_bin(const int& index, GCTAEventBin& bin)
 {
     // Optionally check if the index is valid
     #if defined(G_RANGE_CHECK)
@@ -768,13 +833,13 @@ void GCTAEventCube::set_bin(const int& index)
     int ieng = index / npix();
 
     // Set pointers
-    m_bin.m_counts = &(m_map.pixels()[index]);
-    m_bin.m_energy = &(m_energies[ieng]);
-    m_bin.m_time   = &m_time;
-    m_bin.m_dir    = &(m_dirs[ipix]);
-    m_bin.m_omega  = &(m_omega[ipix]);
-    m_bin.m_ewidth = &(m_ewidth[ieng]);
-    m_bin.m_ontime = &m_ontime;
+    bin.m_counts = &(m_map.pixels()[index]);
+    bin.m_energy = &(m_energies[ieng]);
+    bin.m_time   = &m_time;
+    bin.m_dir    = &(m_dirs[ipix]);
+    bin.m_omega  = &(m_omega[ipix]);
+    bin.m_ewidth = &(m_ewidth[ieng]);
+    bin.m_ontime = &m_ontime;
 
     // Return
     return;
@@ -28,6 +28,8 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <unistd.h>
+#include <cmath>
 #include "GCTAEventList.hpp"
 #include "GCTAException.hpp"
 #include "GTools.hpp"
@@ -41,6 +43,10 @@
 
 /* __ Method name definitions ____________________________________________ */
 #define G_OPERATOR                          "GCTAEventList::operator[](int&)"
+#define G_EVENT            "GCTAEventList::event(int&, GCTAEventAtom&)"
+#define G_SET                    "GCTAEventList::set(int&, GCTAEventAtom&)"
+#define G_FETCH_COLUMNS                  "GCTAEventList::fetch_columns()"
+#define G_READ_COLUMNS          "GCTAEventList::read_columns(GFitsTable*)"
 #define G_ROI                                     "GCTAEventList::roi(GRoi&)"
 #define G_READ_DS_EBOUNDS         "GCTAEventList::read_ds_ebounds(GFitsHDU*)"
 #define G_READ_DS_ROI                 "GCTAEventList::read_ds_roi(GFitsHDU*)"
@@ -48,6 +54,7 @@
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_READ_PAGE 65536       //!< Rows per page for selective event reading
 
 /* __ Debug definitions __________________________________________________ */
 
@@ -145,7 +152,11 @@ GCTAEventList& GCTAEventList::operator=(const GCTAEventList& list)
  * @exception GException::out_of_range
  *            Event index outside valid range.
  *
- * Returns pointer to an event atom.
+ * Returns pointer to an event atom view that is filled from the event
+ * columns and that may be modified. The modifications are written back
+ * into the event list at the next access using this operator, or before
+ * the event list is read, modified, copied or written. The auxiliary event
+ * columns are loaded before the view is returned (see fetch_columns()).
  ***************************************************************************/
 GCTAEventAtom* GCTAEventList::operator[](const int& index)
 {
@@ -155,8 +166,19 @@ GCTAEventAtom* GCTAEventList::operator[](const int& index)
         throw GException::out_of_range(G_OPERATOR, index, 0, size()-1);
     #endif
 
+    // Write back the event view that was returned before
+    flush_event();
+
+    // Make sure that auxiliary columns are present, so that they are
+    // written back unaltered
+    fetch_columns();
+
+    // Fill event view from columns
+    event(index, m_pending_event);
+    m_pending = index;
+
     // Return pointer
-    return (&(m_events[index]));
+    return &m_pending_event;
 }
 
 
@@ -168,7 +190,10 @@ GCTAEventAtom* GCTAEventList::operator[](const int& index)
  * @exception GException::out_of_range
  *            Event index outside valid range.
  *
- * Returns pointer to an event atom.
+ * Returns pointer to an event atom view that is filled from the event
+ * columns. The view is overwritten by the next access, hence the operator
+ * should not be used by several threads on the same event list. Use the
+ * event() method for concurrent access.
  ***************************************************************************/
 const GCTAEventAtom* GCTAEventList::operator[](const int& index) const
 {
@@ -178,8 +203,17 @@ const GCTAEventAtom* GCTAEventList::operator[](const int& index) const
         throw GException::out_of_range(G_OPERATOR, index, 0, size()-1);
     #endif
 
+    // Return the event view that was returned for modification if the
+    // event is accessed again
+    if (index == m_pending) {
+        return &m_pending_event;
+    }
+
+    // Fill event view from columns
+    event(index, m_event);
+
     // Return pointer
-    return (&(m_events[index]));
+    return &m_event;
 }
 
 
@@ -251,6 +285,40 @@ void GCTAEventList::load(const std::string& filename)
 }
 
 
+/***********************************************************************//**
+ * @brief Load selected CTA events from FITS file.
+ *
+ * @param[in] filename Name of FITS file from which events are loaded.
+ * @param[in] ebounds Energy boundaries (no energy selection if empty).
+ * @param[in] gti Good Time Intervals (no time selection if empty).
+ * @param[in] roi Region of interest (no selection if radius is not
+ *                positive).
+ *
+ * Load the CTA events that fall within the energy boundaries, the Good
+ * Time Intervals and the region of interest. Refer to the read() method
+ * for more information.
+ ***************************************************************************/
+void GCTAEventList::load(const std::string& filename,
+                         const GEbounds& ebounds, const GGti& gti,
+                         const GCTARoi& roi)
+{
+    // Clear object
+    clear();
+
+    // Open FITS file
+    GFits file(filename);
+
+    // Read selected events
+    read(file, ebounds, gti, roi);
+
+    // Close FITS file
+    file.close();
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Save CTA events into FITS file.
  *
@@ -292,6 +360,10 @@ void GCTAEventList::save(const std::string& filename, bool clobber) const
  * The method clears the object before reading, thus any information residing
  * in the event list prior to reading will be lost.
  *
+ * Only the event times, directions and energies are read. If the FITS file
+ * is attached to a file on disk, the auxiliary event columns are read later
+ * from that file when they are needed, otherwise they are read immediately.
+ *
  * @todo Ultimately, any events file should have a GTI extension, hence the
  *       extraction of GTIs from TSTART and TSTOP should not be necessary.
  *
@@ -300,15 +372,50 @@ void GCTAEventList::save(const std::string& filename, bool clobber) const
  *       setting of arbitrary time units.
  ***************************************************************************/
 void GCTAEventList::read(const GFits& file)
+{
+    // Read all events
+    read(file, GEbounds(), GGti(), GCTARoi());
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read selected CTA events from FITS file.
+ *
+ * @param[in] file FITS file.
+ * @param[in] ebounds Energy boundaries (no energy selection if empty).
+ * @param[in] gti Good Time Intervals (no time selection if empty).
+ * @param[in] roi Region of interest (no selection if radius is not
+ *                positive).
+ *
+ * Reads the CTA events from a FITS file that fall within the energy
+ * boundaries, the Good Time Intervals and the region of interest. The
+ * selection is applied while scanning the event table, hence events that
+ * do not satisfy the selection are never held in memory. Auxiliary event
+ * columns are later only read for the selected events.
+ *
+ * The energy boundaries, Good Time Intervals and region of interest of the
+ * event list are the intersection of those found in the file with the
+ * selection (see select_ebounds(), select_gti() and select_roi()).
+ *
+ * Refer to read(const GFits&) for more information.
+ ***************************************************************************/
+void GCTAEventList::read(const GFits& file, const GEbounds& ebounds,
+                         const GGti& gti, const GCTARoi& roi)
 {
     // Clear object
     clear();
 
+    // Store filename for reading auxiliary columns on demand
+    m_filename = file.name();
+
     // Get event list HDU
     GFitsTable* events = file.table("EVENTS");
 
-    // Load event data
-    read_events(events);
+    // Load event data that satisfy the selection
+    read_events(events, ebounds, gti, roi);
 
     // Read region of interest from data selection keyword
     read_ds_roi(events);
@@ -345,6 +452,11 @@ void GCTAEventList::read(const GFits& file)
 
     } // endelse: GTI built from TSTART and TSTOP
 
+    // Restrict the information read from the file to the selection
+    select_ebounds(ebounds);
+    select_gti(gti);
+    select_roi(roi);
+
     // Return
     return;
 }
@@ -461,8 +573,53 @@ std::string GCTAEventList::print(void) const
  ***************************************************************************/
 void GCTAEventList::append(const GCTAEventAtom& event)
 {
+    // Make sure that auxiliary columns are present
+    fetch_columns();
+
     // Append event
-    m_events.push_back(event);
+    m_time.push_back(0.0);
+    m_ra.push_back(0.0);
+    m_dec.push_back(0.0);
+    m_logE.push_back(0.0);
+    m_aux.push_back(event_aux());
+
+    // Set event
+    set(size()-1, event);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Append events of another event list
+ *
+ * @param[in] list Event list.
+ *
+ * Appends all events of an event list, including their auxiliary columns,
+ * to the event list. The region of interest of the list is not modified.
+ ***************************************************************************/
+void GCTAEventList::extend(const GCTAEventList& list)
+{
+    // If the list is the event list itself or if it has an event view that
+    // was returned for modification then append a copy
+    if (&list == this || list.m_pending >= 0) {
+        GCTAEventList copy(list);
+        extend(copy);
+        return;
+    }
+
+    // Make sure that auxiliary columns are present
+    fetch_columns();
+    list.fetch_columns();
+
+    // Append events
+    m_time.insert(m_time.end(), list.m_time.begin(), list.m_time.end());
+    m_ra.insert(m_ra.end(), list.m_ra.begin(), list.m_ra.end());
+    m_dec.insert(m_dec.end(), list.m_dec.begin(), list.m_dec.end());
+    m_logE.insert(m_logE.end(), list.m_logE.begin(), list.m_logE.end());
+    m_aux.insert(m_aux.end(), list.m_aux.begin(),
+                     list.m_aux.end());
 
     // Return
     return;
@@ -479,7 +636,168 @@ void GCTAEventList::append(const GCTAEventAtom& event)
 void GCTAEventList::reserve(const int& number)
 {
     // Reserve space
-    m_events.reserve(number);
+    m_time.reserve(number);
+    m_ra.reserve(number);
+    m_dec.reserve(number);
+    m_logE.reserve(number);
+    m_aux.reserve(number);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Get event
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[out] event Event atom.
+ *
+ * @exception GException::out_of_range
+ *            Event index outside valid range.
+ *
+ * Fills the event atom provided by the caller from the event columns. The
+ * method does not modify the event list, hence it may be called
+ * concurrently by several threads on the same event list.
+ *
+ * Auxiliary event information is only filled in if it has already been
+ * loaded; otherwise it is set to zero.
+ ***************************************************************************/
+void GCTAEventList::event(const int& index, GCTAEventAtom& event) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= size())
+        throw GException::out_of_range(G_EVENT, index, 0, size()-1);
+    #endif
+
+    // Use the event view that was returned for modification if it holds
+    // the event
+    if (index == m_pending) {
+        event = m_pending_event;
+        return;
+    }
+
+    // Fill event from columns
+    event.m_time.met(m_time[index]);
+    event.m_dir.radec(m_ra[index], m_dec[index]);
+    event.m_energy.log10MeV(m_logE[index]);
+
+    // Fill auxiliary information. If the auxiliary columns are not loaded
+    // it is set to zero
+    event_aux        none;
+    const event_aux& aux = (m_has_aux) ? m_aux[index] : none;
+    event.m_event_id    = aux.event_id;
+    event.m_obs_id      = aux.obs_id;
+    event.m_multip      = aux.multip;
+    event.m_telmask     = aux.telmask;
+    event.m_dir_err     = aux.dir_err;
+    event.m_detx        = aux.detx;
+    event.m_dety        = aux.dety;
+    event.m_alt         = aux.alt;
+    event.m_az          = aux.az;
+    event.m_corex       = aux.corex;
+    event.m_corey       = aux.corey;
+    event.m_core_err    = aux.core_err;
+    event.m_xmax        = aux.xmax;
+    event.m_xmax_err    = aux.xmax_err;
+    event.m_shwidth     = aux.shwidth;
+    event.m_shlength    = aux.shlength;
+    event.m_energy_err  = aux.energy_err;
+    event.m_hil_msw     = aux.hil_msw;
+    event.m_hil_msw_err = aux.hil_msw_err;
+    event.m_hil_msl     = aux.hil_msl;
+    event.m_hil_msl_err = aux.hil_msl_err;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return event using an event view
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event atom allocated by view().
+ *
+ * @exception GException::out_of_range
+ *            Event index outside valid range.
+ *
+ * Fills the event atom @p view from the event columns and returns a
+ * pointer to it. If @p view is not an event atom, the event view of the
+ * list is used.
+ ***************************************************************************/
+const GEvent* GCTAEventList::event(const int& index, GEvent* view) const
+{
+    // Get event atom
+    GCTAEventAtom* atom = dynamic_cast<GCTAEventAtom*>(view);
+
+    // Use event view of list if no event atom was provided
+    if (atom == NULL) {
+        return ((*this)[index]);
+    }
+
+    // Fill event atom
+    event(index, *atom);
+
+    // Return event atom
+    return atom;
+}
+
+
+/***********************************************************************//**
+ * @brief Set event
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] event Event.
+ *
+ * @exception GException::out_of_range
+ *            Event index outside valid range.
+ *
+ * Replaces the event at the specified index by the event atom.
+ ***************************************************************************/
+void GCTAEventList::set(const int& index, const GCTAEventAtom& event)
+{
+    // Check if the index is valid
+    if (index < 0 || index >= size())
+        throw GException::out_of_range(G_SET, index, 0, size()-1);
+
+    // Write back the event view that was returned for modification, so
+    // that it does not overwrite the event later
+    flush_event();
+
+    // Make sure that auxiliary columns are present
+    fetch_columns();
+
+    // Set event columns
+    m_time[index] = event.m_time.met();
+    m_ra[index]   = event.m_dir.ra();
+    m_dec[index]  = event.m_dir.dec();
+    m_logE[index] = event.m_energy.log10MeV();
+
+    // Set auxiliary columns
+    event_aux& aux  = m_aux[index];
+    aux.event_id    = event.m_event_id;
+    aux.obs_id      = event.m_obs_id;
+    aux.multip      = event.m_multip;
+    aux.telmask     = event.m_telmask;
+    aux.dir_err     = event.m_dir_err;
+    aux.detx        = event.m_detx;
+    aux.dety        = event.m_dety;
+    aux.alt         = event.m_alt;
+    aux.az          = event.m_az;
+    aux.corex       = event.m_corex;
+    aux.corey       = event.m_corey;
+    aux.core_err    = event.m_core_err;
+    aux.xmax        = event.m_xmax;
+    aux.xmax_err    = event.m_xmax_err;
+    aux.shwidth     = event.m_shwidth;
+    aux.shlength    = event.m_shlength;
+    aux.energy_err  = event.m_energy_err;
+    aux.hil_msw     = event.m_hil_msw;
+    aux.hil_msw_err = event.m_hil_msw_err;
+    aux.hil_msl     = event.m_hil_msl;
+    aux.hil_msl_err = event.m_hil_msl_err;
 
     // Return
     return;
@@ -499,7 +817,17 @@ void GCTAEventList::init_members(void)
 {
     // Initialise members
     m_roi.clear();
-    m_events.clear();
+    m_time.clear();
+    m_ra.clear();
+    m_dec.clear();
+    m_logE.clear();
+    m_filename.clear();
+    m_rows.clear();
+    m_has_aux = true;
+    m_aux.clear();
+    m_event.clear();
+    m_pending = -1;
+    m_pending_event.clear();
 
     // Return
     return;
@@ -514,8 +842,21 @@ void GCTAEventList::init_members(void)
 void GCTAEventList::copy_members(const GCTAEventList& list)
 {
     // Copy members
-    m_roi    = list.m_roi;
-    m_events = list.m_events;
+    m_roi         = list.m_roi;
+    m_time        = list.m_time;
+    m_ra          = list.m_ra;
+    m_dec         = list.m_dec;
+    m_logE        = list.m_logE;
+    m_filename    = list.m_filename;
+    m_rows        = list.m_rows;
+    m_has_aux     = list.m_has_aux;
+    m_aux         = list.m_aux;
+
+    // Write the event view that was returned for modification into the
+    // copy
+    if (list.m_pending >= 0) {
+        set(list.m_pending, list.m_pending_event);
+    }
 
     // Return
     return;
@@ -532,19 +873,112 @@ void GCTAEventList::free_members(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Make sure that the auxiliary event columns are loaded
+ *
+ * Reads the auxiliary event columns from the file from which the event
+ * list has been read if this has not been done before. If the event list
+ * was not read from a file, the auxiliary columns are initialised to zero.
+ ***************************************************************************/
+void GCTAEventList::fetch_columns(void) const
+{
+    // Continue only if auxiliary columns are not yet present
+    if (!m_has_aux) {
+
+        // Read columns from file. Throw an exception if the file is no
+        // longer accessible, as the auxiliary columns would be lost
+        // otherwise.
+        if (size() > 0 && !m_filename.empty()) {
+            if (access(m_filename.c_str(), R_OK) != 0) {
+                throw GCTAException::file_open_error(G_FETCH_COLUMNS,
+                      m_filename,
+                      "Auxiliary event columns cannot be read since the"
+                      " event file is no longer accessible.");
+            }
+            GFits       file(m_filename);
+            GFitsTable* table = file.table("EVENTS");
+
+            // If events were selected then load the columns in pages, so
+            // that only the pages that contain selected events are read
+            // from the file. As the table rows of the selected events are
+            // ascending, each page is loaded at most once.
+            if (!m_rows.empty()) {
+                for (int i = 0; i < table->ncols(); ++i) {
+                    (*table)[i].page(G_READ_PAGE);
+                }
+            }
+
+            // Read columns
+            read_columns(table);
+            file.close();
+        }
+
+        // ... otherwise initialise them to zero
+        else {
+            m_aux.assign(size(), event_aux());
+            m_has_aux = true;
+        }
+
+    } // endif: auxiliary columns were not present
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Write back event view that was returned for modification
+ *
+ * Writes the event view that was returned by the non-const access operator
+ * back into the event list, and forgets about the view.
+ ***************************************************************************/
+void GCTAEventList::flush_event(void)
+{
+    // Write back event view if there is one
+    if (m_pending >= 0) {
+        int index = m_pending;
+        m_pending = -1;
+        set(index, m_pending_event);
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Read CTA events from FITS table
  *
  * @param[in] table FITS table pointer.
+ * @param[in] ebounds Energy boundaries (no energy selection if empty).
+ * @param[in] gti Good Time Intervals (no time selection if empty).
+ * @param[in] roi Region of interest (no selection if radius is not
+ *                positive).
+ *
+ * This method reads the event times, directions and energies from a FITS
+ * table HDU into memory. The auxiliary event columns are read immediately
+ * if the event list is not attached to a file, otherwise they are read on
+ * demand by fetch_columns().
  *
- * This method reads the CTA event list from a FITS table HDU into memory.
- * Depending on the columns existing in the file, it either selects v0 or
- * v1 of the event list reader.
+ * If a selection is specified, only events that satisfy the selection are
+ * stored. If the event list is attached to a file, the table of a
+ * privately opened FITS file is then scanned in pages of G_READ_PAGE rows,
+ * so that the columns of the table that is passed to the method are not
+ * modified. The table rows of the selected events are kept so that their
+ * auxiliary columns can be read later.
  ***************************************************************************/
-void GCTAEventList::read_events(const GFitsTable* table)
+void GCTAEventList::read_events(const GFitsTable* table,
+                                const GEbounds& ebounds, const GGti& gti,
+                                const GCTARoi& roi)
 {
     // Clear existing events
-    m_events.clear();
+    m_time.clear();
+    m_ra.clear();
+    m_dec.clear();
+    m_logE.clear();
+    m_rows.clear();
+    m_aux.clear();
+    m_has_aux = true;
 
     // Continue only if HDU is valid
     if (table != NULL) {
@@ -554,7 +988,176 @@ void GCTAEventList::read_events(const GFitsTable* table)
 
         // Continue only if there are events
         if (num > 0) {
-        
+
+            // Determine selection
+            bool select_energy = (ebounds.size() > 0);
+            bool select_time   = (gti.size() > 0);
+            bool select_roi    = (roi.radius() > 0.0);
+            bool select        = (select_energy || select_time || select_roi);
+
+            // If a selection is requested and the event list is attached to
+            // a file then scan the table of a privately opened FITS file in
+            // pages
+            GFits             file;
+            const GFitsTable* scan = table;
+            if (select && !m_filename.empty()) {
+                file.open(m_filename);
+                GFitsTable* events = file.table("EVENTS");
+                (*events)["TIME"].page(G_READ_PAGE);
+                (*events)["RA"].page(G_READ_PAGE);
+                (*events)["DEC"].page(G_READ_PAGE);
+                (*events)["ENERGY"].page(G_READ_PAGE);
+                scan = events;
+            }
+
+            // Get column pointers
+            GFitsTableDoubleCol* ptr_time   = (GFitsTableDoubleCol*)&(*scan)["TIME"];
+            GFitsTableFloatCol*  ptr_ra     = (GFitsTableFloatCol*)&(*scan)["RA"];
+            GFitsTableFloatCol*  ptr_dec    = (GFitsTableFloatCol*)&(*scan)["DEC"];
+            GFitsTableFloatCol*  ptr_energy = (GFitsTableFloatCol*)&(*scan)["ENERGY"];
+
+            // If no selection is requested then copy all data from columns
+            if (!select) {
+
+                // Allocate columns
+                m_time.resize(num);
+                m_ra.resize(num);
+                m_dec.resize(num);
+                m_logE.resize(num);
+
+                // Copy data from columns
+                for (int i = 0; i < num; ++i) {
+                    m_time[i] = (*ptr_time)(i);
+                    m_ra[i]   = (*ptr_ra)(i)  * deg2rad;
+                    m_dec[i]  = (*ptr_dec)(i) * deg2rad;
+                    m_logE[i] = std::log10((*ptr_energy)(i)) + 6.0;
+                }
+
+            } // endif: no selection
+
+            // ... otherwise scan the table and keep only the events that
+            // satisfy the selection
+            else {
+
+                // Get ROI centre and radius
+                GSkyDir centre = roi.centre().dir();
+                double  radius = roi.radius();
+
+                // Loop over table rows
+                for (int i = 0; i < num; ++i) {
+
+                    // Apply energy selection
+                    double energy = (*ptr_energy)(i);
+                    if (select_energy) {
+                        GEnergy eng;
+                        eng.TeV(energy);
+                        if (!ebounds.contains(eng)) {
+                            continue;
+                        }
+                    }
+
+                    // Apply time selection
+                    double met = (*ptr_time)(i);
+                    if (select_time) {
+                        GTime time;
+                        time.met(met);
+                        if (!gti.isin(time)) {
+                            continue;
+                        }
+                    }
+
+                    // Apply ROI selection
+                    double ra  = (*ptr_ra)(i)  * deg2rad;
+                    double dec = (*ptr_dec)(i) * deg2rad;
+                    if (select_roi) {
+                        GSkyDir dir;
+                        dir.radec(ra, dec);
+                        if (centre.dist_deg(dir) > radius) {
+                            continue;
+                        }
+                    }
+
+                    // Store event
+                    m_time.push_back(met);
+                    m_ra.push_back(ra);
+                    m_dec.push_back(dec);
+                    m_logE.push_back(std::log10(energy) + 6.0);
+                    m_rows.push_back(i);
+
+                } // endfor: looped over table rows
+
+            } // endelse: selection was applied
+
+            // Close private FITS file (if any)
+            file.close();
+
+            // Read auxiliary columns now if there is no file from which
+            // they could be read later
+            if (m_filename.empty()) {
+                read_columns(table);
+            }
+            else {
+                m_has_aux = false;
+            }
+
+        } // endif: there were events
+
+    } // endif: HDU was valid
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return table row of event
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ *
+ * Returns the row of the FITS table from which the event has been read.
+ ***************************************************************************/
+int GCTAEventList::table_row(const int& index) const
+{
+    // Return table row
+    return (m_rows.empty() ? index : m_rows[index]);
+}
+
+
+/***********************************************************************//**
+ * @brief Read auxiliary CTA event columns from FITS table
+ *
+ * @param[in] table FITS table pointer.
+ *
+ * @exception GException::invalid_argument
+ *            Number of rows in table differs from number of events.
+ *
+ * This method reads the auxiliary event columns from a FITS table HDU into
+ * memory. Depending on the columns existing in the file, it either selects
+ * v0 or v1 of the event list reader. If events were selected, only the
+ * values of the selected events are kept.
+ ***************************************************************************/
+void GCTAEventList::read_columns(const GFitsTable* table) const
+{
+    // Initialise auxiliary columns
+    m_aux.assign(size(), event_aux());
+    m_has_aux = true;
+
+    // Continue only if HDU is valid
+    if (table != NULL) {
+
+        // Extract number of events in FITS file
+        int num = table->integer("NAXIS2");
+
+        // Make sure that table is consistent with event list
+        if ((m_rows.empty() && num != size()) ||
+            (!m_rows.empty() && num <= m_rows.back()))
+            throw GException::invalid_argument(G_READ_COLUMNS,
+                  "Number of table rows ("+str(num)+") differs from number"
+                  " of events ("+str(size())+").");
+
+        // Continue only if there are events
+        if (size() > 0) {
+
             // Read events for v1
             if (table->hascolumn("SHWIDTH") && table->hascolumn("SHLENGTH")) {
                 read_events_v1(table);
@@ -578,20 +1181,17 @@ void GCTAEventList::read_events(const GFitsTable* table)
 
 
 /***********************************************************************//**
- * @brief Read CTA events from FITS table (version 0)
+ * @brief Read auxiliary CTA event columns from FITS table (version 0)
  *
  * @param[in] table FITS table pointer.
  *
- * This method reads the CTA event list from a FITS table HDU into memory.
- * It is a minimal event reader that is compliant with the initial data
- * format distributed by Karl Kosack. Information that is not present in
- * that format is set to 0.
+ * This method reads the auxiliary CTA event columns from a FITS table HDU
+ * into memory. It is a minimal event reader that is compliant with the
+ * initial data format distributed by Karl Kosack. Information that is not
+ * present in that format is set to 0.
  ***************************************************************************/
-void GCTAEventList::read_events_v0(const GFitsTable* table)
+void GCTAEventList::read_events_v0(const GFitsTable* table) const
 {
-    // Clear existing events
-    m_events.clear();
-
     // Continue only if HDU is valid
     if (table != NULL) {
 
@@ -601,15 +1201,9 @@ void GCTAEventList::read_events_v0(const GFitsTable* table)
         // If there are events then load them
         if (num > 0) {
 
-            // Reserve data
-            m_events.reserve(num);
-
             // Get column pointers
             GFitsTableULongCol*  ptr_eid         = (GFitsTableULongCol*)&(*table)["EVENT_ID"];
-            GFitsTableDoubleCol* ptr_time        = (GFitsTableDoubleCol*)&(*table)["TIME"];
             GFitsTableShortCol*  ptr_multip      = (GFitsTableShortCol*)&(*table)["MULTIP"];
-            GFitsTableFloatCol*  ptr_ra          = (GFitsTableFloatCol*)&(*table)["RA"];
-            GFitsTableFloatCol*  ptr_dec         = (GFitsTableFloatCol*)&(*table)["DEC"];
             GFitsTableFloatCol*  ptr_dir_err     = (GFitsTableFloatCol*)&(*table)["DIR_ERR"];
             GFitsTableFloatCol*  ptr_detx        = (GFitsTableFloatCol*)&(*table)["DETX"];
             GFitsTableFloatCol*  ptr_dety        = (GFitsTableFloatCol*)&(*table)["DETY"];
@@ -620,33 +1214,28 @@ void GCTAEventList::read_events_v0(const GFitsTable* table)
             GFitsTableFloatCol*  ptr_core_err    = (GFitsTableFloatCol*)&(*table)["CORE_ERR"];
             GFitsTableFloatCol*  ptr_xmax        = (GFitsTableFloatCol*)&(*table)["XMAX"];
             GFitsTableFloatCol*  ptr_xmax_err    = (GFitsTableFloatCol*)&(*table)["XMAX_ERR"];
-            GFitsTableFloatCol*  ptr_energy      = (GFitsTableFloatCol*)&(*table)["ENERGY"];
             GFitsTableFloatCol*  ptr_energy_err  = (GFitsTableFloatCol*)&(*table)["ENERGY_ERR"];
 
-            // Copy data from columns into GCTAEventAtom objects
-            GCTAEventAtom event;
-            for (int i = 0; i < num; ++i) {
-                event.m_time.met((*ptr_time)(i));
-                event.m_dir.radec_deg((*ptr_ra)(i), (*ptr_dec)(i));
-                event.m_energy.TeV((*ptr_energy)(i));
-                event.m_event_id    = (*ptr_eid)(i);
-                event.m_obs_id      = 0;
-                event.m_multip      = (*ptr_multip)(i);
-                event.m_telmask     = 0;
-                event.m_dir_err     = (*ptr_dir_err)(i);
-                event.m_detx        = (*ptr_detx)(i);
-                event.m_dety        = (*ptr_dety)(i);
-                event.m_alt         = (*ptr_alt)(i);
-                event.m_az          = (*ptr_az)(i);
-                event.m_corex       = (*ptr_corex)(i);
-                event.m_corey       = (*ptr_corey)(i);
-                event.m_core_err    = (*ptr_core_err)(i);
-                event.m_xmax        = (*ptr_xmax)(i);
-                event.m_xmax_err    = (*ptr_xmax_err)(i);
-                event.m_shwidth     = 0.0;
-                event.m_shlength    = 0.0;
-                event.m_energy_err  = (*ptr_energy_err)(i);
-                m_events.push_back(event);
+            // Copy data from columns into auxiliary columns
+            for (int i = 0; i < size(); ++i) {
+                event_aux& aux = m_aux[i];
+                aux.event_id   = (*ptr_eid)(table_row(i));
+                aux.obs_id     = 0;
+                aux.multip     = (*ptr_multip)(table_row(i));
+                aux.telmask    = 0;
+                aux.dir_err    = (*ptr_dir_err)(table_row(i));
+                aux.detx       = (*ptr_detx)(table_row(i));
+                aux.dety       = (*ptr_dety)(table_row(i));
+                aux.alt        = (*ptr_alt)(table_row(i));
+                aux.az         = (*ptr_az)(table_row(i));
+                aux.corex      = (*ptr_corex)(table_row(i));
+                aux.corey      = (*ptr_corey)(table_row(i));
+                aux.core_err   = (*ptr_core_err)(table_row(i));
+                aux.xmax       = (*ptr_xmax)(table_row(i));
+                aux.xmax_err   = (*ptr_xmax_err)(table_row(i));
+                aux.shwidth    = 0.0;
+                aux.shlength   = 0.0;
+                aux.energy_err = (*ptr_energy_err)(table_row(i));
             }
 
         } // endif: there were events
@@ -659,19 +1248,17 @@ void GCTAEventList::read_events_v0(const GFitsTable* table)
 
 
 /***********************************************************************//**
- * @brief Read CTA events from FITS table (version 1)
+ * @brief Read auxiliary CTA event columns from FITS table (version 1)
  *
  * @param[in] table FITS table pointer.
  *
- * This method reads the CTA event list from a FITS table HDU into memory.
+ * This method reads the auxiliary CTA event columns from a FITS table HDU
+ * into memory.
  *
  * @todo Implement agreed column format
  ***************************************************************************/
-void GCTAEventList::read_events_v1(const GFitsTable* table)
+void GCTAEventList::read_events_v1(const GFitsTable* table) const
 {
-    // Clear existing events
-    m_events.clear();
-
     // Continue only if HDU is valid
     if (table != NULL) {
 
@@ -681,16 +1268,10 @@ void GCTAEventList::read_events_v1(const GFitsTable* table)
         // If there are events then load them
         if (num > 0) {
 
-            // Reserve data
-            m_events.reserve(num);
-
             // Get column pointers
             GFitsTableULongCol*  ptr_eid         = (GFitsTableULongCol*)&(*table)["EVENT_ID"];
             GFitsTableULongCol*  ptr_oid         = (GFitsTableULongCol*)&(*table)["OBS_ID"];
-            GFitsTableDoubleCol* ptr_time        = (GFitsTableDoubleCol*)&(*table)["TIME"];
             GFitsTableShortCol*  ptr_multip      = (GFitsTableShortCol*)&(*table)["MULTIP"];
-            GFitsTableFloatCol*  ptr_ra          = (GFitsTableFloatCol*)&(*table)["RA"];
-            GFitsTableFloatCol*  ptr_dec         = (GFitsTableFloatCol*)&(*table)["DEC"];
             GFitsTableFloatCol*  ptr_dir_err     = (GFitsTableFloatCol*)&(*table)["DIR_ERR"];
             GFitsTableFloatCol*  ptr_detx        = (GFitsTableFloatCol*)&(*table)["DETX"];
             GFitsTableFloatCol*  ptr_dety        = (GFitsTableFloatCol*)&(*table)["DETY"];
@@ -703,33 +1284,28 @@ void GCTAEventList::read_events_v1(const GFitsTable* table)
             GFitsTableFloatCol*  ptr_xmax_err    = (GFitsTableFloatCol*)&(*table)["XMAX_ERR"];
             GFitsTableFloatCol*  ptr_shw         = (GFitsTableFloatCol*)&(*table)["SHWIDTH"];
             GFitsTableFloatCol*  ptr_shl         = (GFitsTableFloatCol*)&(*table)["SHLENGTH"];
-            GFitsTableFloatCol*  ptr_energy      = (GFitsTableFloatCol*)&(*table)["ENERGY"];
             GFitsTableFloatCol*  ptr_energy_err  = (GFitsTableFloatCol*)&(*table)["ENERGY_ERR"];
 
-            // Copy data from columns into GCTAEventAtom objects
-            GCTAEventAtom event;
-            for (int i = 0; i < num; ++i) {
-                event.m_time.met((*ptr_time)(i));
-                event.m_dir.radec_deg((*ptr_ra)(i), (*ptr_dec)(i));
-                event.m_energy.TeV((*ptr_energy)(i));
-                event.m_event_id    = (*ptr_eid)(i);
-                event.m_obs_id      = (*ptr_oid)(i);
-                event.m_multip      = (*ptr_multip)(i);
-                event.m_telmask     = 0;
-                event.m_dir_err     = (*ptr_dir_err)(i);
-                event.m_detx        = (*ptr_detx)(i);
-                event.m_dety        = (*ptr_dety)(i);
-                event.m_alt         = (*ptr_alt)(i);
-                event.m_az          = (*ptr_az)(i);
-                event.m_corex       = (*ptr_corex)(i);
-                event.m_corey       = (*ptr_corey)(i);
-                event.m_core_err    = (*ptr_core_err)(i);
-                event.m_xmax        = (*ptr_xmax)(i);
-                event.m_xmax_err    = (*ptr_xmax_err)(i);
-                event.m_shwidth     = (*ptr_shw)(i);
-                event.m_shlength    = (*ptr_shl)(i);
-                event.m_energy_err  = (*ptr_energy_err)(i);
-                m_events.push_back(event);
+            // Copy data from columns into auxiliary columns
+            for (int i = 0; i < size(); ++i) {
+                event_aux& aux = m_aux[i];
+                aux.event_id   = (*ptr_eid)(table_row(i));
+                aux.obs_id     = (*ptr_oid)(table_row(i));
+                aux.multip     = (*ptr_multip)(table_row(i));
+                aux.telmask    = 0;
+                aux.dir_err    = (*ptr_dir_err)(table_row(i));
+                aux.detx       = (*ptr_detx)(table_row(i));
+                aux.dety       = (*ptr_dety)(table_row(i));
+                aux.alt        = (*ptr_alt)(table_row(i));
+                aux.az         = (*ptr_az)(table_row(i));
+                aux.corex      = (*ptr_corex)(table_row(i));
+                aux.corey      = (*ptr_corey)(table_row(i));
+                aux.core_err   = (*ptr_core_err)(table_row(i));
+                aux.xmax       = (*ptr_xmax)(table_row(i));
+                aux.xmax_err   = (*ptr_xmax_err)(table_row(i));
+                aux.shwidth    = (*ptr_shw)(table_row(i));
+                aux.shlength   = (*ptr_shl)(table_row(i));
+                aux.energy_err = (*ptr_energy_err)(table_row(i));
             }
 
         } // endif: there were events
@@ -751,10 +1327,8 @@ void GCTAEventList::read_events_v1(const GFitsTable* table)
  * HIL_MSL, and HIL_MSL_ERR in the FITS table and extracts the relevant
  * columns from the FITS file. If a column is not found, no action is
  * performed.
- *
- * @todo Verify consistency of event list size
  ***************************************************************************/
-void GCTAEventList::read_events_hillas(const GFitsTable* table)
+void GCTAEventList::read_events_hillas(const GFitsTable* table) const
 {
     // Continue only if HDU is valid
     if (table != NULL) {
@@ -762,9 +1336,6 @@ void GCTAEventList::read_events_hillas(const GFitsTable* table)
         // Extract number of events in FITS file
         int num = table->integer("NAXIS2");
 
-        //TODO: Make sure that dimension is consistent with existing event
-        //      list
-
         // Continue only if there are events
         if (num > 0) {
 
@@ -772,8 +1343,8 @@ void GCTAEventList::read_events_hillas(const GFitsTable* table)
             if (table->hascolumn("HIL_MSW")) {
                 GFitsTableFloatCol* ptr =
                      (GFitsTableFloatCol*)&(*table)["HIL_MSW"];
-                for (int i = 0; i < num; ++i) {
-                    m_events[i].m_hil_msw = (*ptr)(i);
+                for (int i = 0; i < size(); ++i) {
+                    m_aux[i].hil_msw = (*ptr)(table_row(i));
                 }
             }
 
@@ -781,8 +1352,8 @@ void GCTAEventList::read_events_hillas(const GFitsTable* table)
             if (table->hascolumn("HIL_MSW_ERR")) {
                 GFitsTableFloatCol* ptr =
                      (GFitsTableFloatCol*)&(*table)["HIL_MSW_ERR"];
-                for (int i = 0; i < num; ++i) {
-                    m_events[i].m_hil_msw_err = (*ptr)(i);
+                for (int i = 0; i < size(); ++i) {
+                    m_aux[i].hil_msw_err = (*ptr)(table_row(i));
                 }
             }
 
@@ -790,8 +1361,8 @@ void GCTAEventList::read_events_hillas(const GFitsTable* table)
             if (table->hascolumn("HIL_MSL")) {
                 GFitsTableFloatCol* ptr =
                      (GFitsTableFloatCol*)&(*table)["HIL_MSL"];
-                for (int i = 0; i < num; ++i) {
-                    m_events[i].m_hil_msl = (*ptr)(i);
+                for (int i = 0; i < size(); ++i) {
+                    m_aux[i].hil_msl = (*ptr)(table_row(i));
                 }
             }
 
@@ -799,8 +1370,8 @@ void GCTAEventList::read_events_hillas(const GFitsTable* table)
             if (table->hascolumn("HIL_MSL_ERR")) {
                 GFitsTableFloatCol* ptr =
                      (GFitsTableFloatCol*)&(*table)["HIL_MSL_ERR"];
-                for (int i = 0; i < num; ++i) {
-                    m_events[i].m_hil_msl_err = (*ptr)(i);
+                for (int i = 0; i < size(); ++i) {
+                    m_aux[i].hil_msl_err = (*ptr)(table_row(i));
                 }
             }
 
@@ -812,7 +1383,6 @@ void GCTAEventList::read_events_hillas(const GFitsTable* table)
     return;
 }
 
-
 /***********************************************************************//**
  * @brief Read energy boundary data selection keywords
  *
@@ -982,6 +1552,128 @@ void GCTAEventList::read_ds_roi(const GFitsHDU* hdu)
 }
 
 
+/***********************************************************************//**
+ * @brief Restrict energy boundaries to selection
+ *
+ * @param[in] ebounds Energy boundaries of selection (no selection if empty).
+ *
+ * Replaces the energy boundaries by their intersection with the selection.
+ * If no energy boundaries were found in the file, the selection is used.
+ ***************************************************************************/
+void GCTAEventList::select_ebounds(const GEbounds& ebounds)
+{
+    // Continue only if a selection was specified
+    if (ebounds.size() > 0) {
+
+        // If there are energy boundaries then intersect them with the
+        // selection
+        if (m_ebounds.size() > 0) {
+            GEbounds intersection;
+            for (int i = 0; i < m_ebounds.size(); ++i) {
+                for (int k = 0; k < ebounds.size(); ++k) {
+                    GEnergy emin = (m_ebounds.emin(i) > ebounds.emin(k))
+                                   ? m_ebounds.emin(i) : ebounds.emin(k);
+                    GEnergy emax = (m_ebounds.emax(i) < ebounds.emax(k))
+                                   ? m_ebounds.emax(i) : ebounds.emax(k);
+                    if (emax > emin) {
+                        intersection.insert(emin, emax);
+                    }
+                }
+            }
+            m_ebounds = intersection;
+        }
+
+        // ... otherwise use the selection
+        else {
+            m_ebounds = ebounds;
+        }
+
+    } // endif: selection was specified
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Restrict Good Time Intervals to selection
+ *
+ * @param[in] gti Good Time Intervals of selection (no selection if empty).
+ *
+ * Replaces the Good Time Intervals by their intersection with the
+ * selection, so that the ontime of the event list does not exceed the
+ * time that was actually covered by the file.
+ ***************************************************************************/
+void GCTAEventList::select_gti(const GGti& gti)
+{
+    // Continue only if a selection was specified
+    if (gti.size() > 0) {
+
+        // If there are Good Time Intervals then intersect them with the
+        // selection
+        if (m_gti.size() > 0) {
+            GGti intersection;
+            for (int i = 0; i < m_gti.size(); ++i) {
+                for (int k = 0; k < gti.size(); ++k) {
+                    GTime tstart = (m_gti.tstart(i) > gti.tstart(k))
+                                   ? m_gti.tstart(i) : gti.tstart(k);
+                    GTime tstop  = (m_gti.tstop(i) < gti.tstop(k))
+                                   ? m_gti.tstop(i) : gti.tstop(k);
+                    if (tstop > tstart) {
+                        intersection.insert(tstart, tstop);
+                    }
+                }
+            }
+            m_gti = intersection;
+        }
+
+        // ... otherwise use the selection
+        else {
+            m_gti = gti;
+        }
+
+    } // endif: selection was specified
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Restrict region of interest to selection
+ *
+ * @param[in] roi Region of interest of selection (no selection if radius is
+ *                not positive).
+ *
+ * Replaces the region of interest by the selection unless the region of
+ * interest found in the file is fully contained in the selection. As the
+ * intersection of two circles is not a circle, the selection is also used
+ * if both regions overlap only partially, in which case the region of
+ * interest includes sky areas that were not covered by the file.
+ ***************************************************************************/
+void GCTAEventList::select_roi(const GCTARoi& roi)
+{
+    // Continue only if a selection was specified
+    if (roi.radius() > 0.0) {
+
+        // Use the selection unless the region of interest of the file
+        // lies within the selection
+        bool contained = false;
+        if (m_roi.radius() > 0.0) {
+            double dist = roi.centre().dir().dist_deg(m_roi.centre().dir());
+            contained   = (dist + m_roi.radius() <= roi.radius());
+        }
+        if (!contained) {
+            m_roi = roi;
+        }
+
+    } // endif: selection was specified
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Write CTA events into FITS table
  *
@@ -994,6 +1686,14 @@ void GCTAEventList::read_ds_roi(const GFitsHDU* hdu)
  ***************************************************************************/
 void GCTAEventList::write_events(GFitsBinTable* hdu) const
 {
+    // If there is an event view that was returned for modification then
+    // write a copy of the event list that holds the modified event
+    if (m_pending >= 0) {
+        GCTAEventList copy(*this);
+        copy.write_events(hdu);
+        return;
+    }
+
     // Continue only if HDU is valid
     if (hdu != NULL) {
 
@@ -1031,34 +1731,38 @@ void GCTAEventList::write_events(GFitsBinTable* hdu) const
             GFitsTableFloatCol  col_hil_msl     = GFitsTableFloatCol("HIL_MSL", size());
             GFitsTableFloatCol  col_hil_msl_err = GFitsTableFloatCol("HIL_MSL_ERR", size());
 
+            // Make sure that auxiliary columns are present
+            fetch_columns();
+
             // Fill columns
             for (int i = 0; i < size(); ++i) {
-                col_eid(i)         = m_events[i].m_event_id;
-                col_oid(i)         = m_events[i].m_obs_id;
-                col_time(i)        = m_events[i].time().met();
+                const event_aux& aux = m_aux[i];
+                col_eid(i)         = aux.event_id;
+                col_oid(i)         = aux.obs_id;
+                col_time(i)        = m_time[i];
                 col_live(i)        = 0.0;
                 col_multip(i)      = 0;
                 //col_telmask
-                col_ra(i)          = m_events[i].dir().ra_deg();
-                col_dec(i)         = m_events[i].dir().dec_deg();
-                col_direrr(i)      = m_events[i].m_dir_err;
-                col_detx(i)        = m_events[i].m_detx;
-                col_dety(i)        = m_events[i].m_dety;
-                col_alt(i)         = m_events[i].m_alt;
-                col_az(i)          = m_events[i].m_az;
-                col_corex(i)       = m_events[i].m_corex;
-                col_corey(i)       = m_events[i].m_corey;
-                col_core_err(i)    = m_events[i].m_core_err;
-                col_xmax(i)        = m_events[i].m_xmax;
-                col_xmax_err(i)    = m_events[i].m_xmax_err;
-                col_shw(i)         = m_events[i].m_shwidth;
-                col_shl(i)         = m_events[i].m_shlength;
-                col_energy(i)      = m_events[i].energy().TeV();
-                col_energy_err(i)  = m_events[i].m_energy_err;
-                col_hil_msw(i)     = m_events[i].m_hil_msw;
-                col_hil_msw_err(i) = m_events[i].m_hil_msw_err;
-                col_hil_msl(i)     = m_events[i].m_hil_msl;
-                col_hil_msl_err(i) = m_events[i].m_hil_msl_err;
+                col_ra(i)          = m_ra[i]  * rad2deg;
+                col_dec(i)         = m_dec[i] * rad2deg;
+                col_direrr(i)      = aux.dir_err;
+                col_detx(i)        = aux.detx;
+                col_dety(i)        = aux.dety;
+                col_alt(i)         = aux.alt;
+                col_az(i)          = aux.az;
+                col_corex(i)       = aux.corex;
+                col_corey(i)       = aux.corey;
+                col_core_err(i)    = aux.core_err;
+                col_xmax(i)        = aux.xmax;
+                col_xmax_err(i)    = aux.xmax_err;
+                col_shw(i)         = aux.shwidth;
+                col_shl(i)         = aux.shlength;
+                col_energy(i)      = std::pow(10.0, m_logE[i]-6.0);
+                col_energy_err(i)  = aux.energy_err;
+                col_hil_msw(i)     = aux.hil_msw;
+                col_hil_msw_err(i) = aux.hil_msw_err;
+                col_hil_msl(i)     = aux.hil_msl;
+                col_hil_msl_err(i) = aux.hil_msl_err;
             } // endfor: looped over rows
 
             // Append columns to table
@@ -28,6 +28,10 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <vector>
 #include "GException.hpp"
 #include "GTools.hpp"
 #include "GModelRegistry.hpp"
@@ -502,6 +506,14 @@ double GCTAModelRadialAcceptance::npred(const GEnergy&      obsEng,
  * The method also applies a deadtime correction using a Monte Carlo process,
  * taking into account temporal deadtime variations. For this purpose, the
  * method makes use of the time dependent GObservation::deadc method.
+ *
+ * The simulation is split into one chunk per energy boundary and good time
+ * interval, and the chunks are distributed over the threads. Chunk i draws
+ * its random numbers from stream i of a generator that is seeded from
+ * @p ran, and the events of all chunks are appended in chunk order, hence
+ * the simulated events do not depend on the number of threads. Each thread
+ * works on its own copy of the model since the spectral and radial model
+ * components cache sampling information.
  ***************************************************************************/
 GCTAEventList* GCTAModelRadialAcceptance::mc(const GObservation& obs, 
                                              GRan& ran) const
@@ -521,66 +533,106 @@ GCTAEventList* GCTAModelRadialAcceptance::mc(const GObservation& obs,
         // Convert CTA pointing direction in instrument system
         GCTAInstDir pnt_dir(pnt->dir());
 
-        // Loop over all energy boundaries
-        for (int ieng = 0; ieng < obs.events()->ebounds().size(); ++ieng) {
-
-            // Compute the on-axis background rate in model within the
-            // energy boundaries from spectral component (units: cts/s/sr)
-            double flux = spectral()->flux(obs.events()->ebounds().emin(ieng),
-                                           obs.events()->ebounds().emax(ieng));
-
-            // Compute solid angle used for normalization
-            double area = radial()->omega();
-
-            // Derive expecting rate (units: cts/s). Note that the time here
-            // is good time. Deadtime correction will be done later.
-            double rate = flux * area;
-
-            // Debug option: dump rate
-            #if defined(G_DUMP_MC)
-            std::cout << "GCTAModelRadialAcceptance::mc(\"" << name() << "\": ";
-            std::cout << "flux=" << flux << " cts/s/sr, ";
-            std::cout << "area=" << area << " sr, ";
-            std::cout << "rate=" << rate << " cts/s)" << std::endl;
-            #endif
+        // Get energy boundaries and good time intervals
+        const GEbounds& ebounds = obs.events()->ebounds();
+        const GGti&     gti     = obs.events()->gti();
+
+        // Set number of chunks
+        int ngti    = gti.size();
+        int nchunks = ebounds.size() * ngti;
+
+        // Derive generator for chunk streams
+        GRan base(ran.int64());
+
+        // Allocate event lists for all chunks
+        std::vector<GCTAEventList> lists(nchunks);
+
+        // Set number of threads. No more threads than chunks are used since
+        // each thread copies the model.
+        #ifdef _OPENMP
+        int nthreads = (nchunks < omp_get_max_threads()) ? nchunks
+                                                         : omp_get_max_threads();
+        #else
+        int nthreads = 1;
+        #endif
+        if (nthreads < 1) {
+            nthreads = 1;
+        }
 
-            // Loop over all good time intervals
-            for (int itime = 0; itime < obs.events()->gti().size(); ++itime) {
+        // Simulate chunks
+        #pragma omp parallel num_threads(nthreads)
+        {
+            // Allocate model copy for this thread
+            GCTAModelRadialAcceptance* model = clone();
+
+            // Loop over chunks
+            #pragma omp for schedule(dynamic)
+            for (int ichunk = 0; ichunk < nchunks; ++ichunk) {
+
+                // Get energy boundary and good time interval of chunk
+                int ieng  = ichunk / ngti;
+                int itime = ichunk % ngti;
+
+                // Get random number stream and event list of chunk
+                GRan           stream = base.stream(ichunk);
+                GCTAEventList& events = lists[ichunk];
+
+                // Compute the on-axis background rate in model within the
+                // energy boundaries from spectral component (units: cts/s/sr)
+                double flux = model->spectral()->flux(ebounds.emin(ieng),
+                                                      ebounds.emax(ieng));
+
+                // Compute solid angle used for normalization
+                double area = model->radial()->omega();
+
+                // Derive expecting rate (units: cts/s). Note that the time
+                // here is good time. Deadtime correction will be done later.
+                double rate = flux * area;
+
+                // Debug option: dump rate
+                #if defined(G_DUMP_MC)
+                #pragma omp critical(GCTAModelRadialAcceptance_mc)
+                {
+                std::cout << "GCTAModelRadialAcceptance::mc(\"" << name() << "\": ";
+                std::cout << "flux=" << flux << " cts/s/sr, ";
+                std::cout << "area=" << area << " sr, ";
+                std::cout << "rate=" << rate << " cts/s)" << std::endl;
+                }
+                #endif
 
                 // Get event arrival times from temporal model
-                GTimes times = m_temporal->mc(rate,
-                                              obs.events()->gti().tstart(itime),
-                                              obs.events()->gti().tstop(itime), ran);
+                GTimes times = model->temporal()->mc(rate,
+                                                     gti.tstart(itime),
+                                                     gti.tstop(itime),
+                                                     stream);
 
                 // Get number of events
                 int n_events = times.size();
 
                 // Reserve space for events
                 if (n_events > 0) {
-                    list->reserve(n_events);
+                    events.reserve(n_events);
                 }
 
                 // Loop over events
+                GCTAEventAtom event;
                 for (int i = 0; i < n_events; ++i) {
 
                     // Apply deadtime correction
                     double deadc = obs.deadc(times[i]);
                     if (deadc < 1.0) {
-                        if (ran.uniform() > deadc) {
+                        if (stream.uniform() > deadc) {
                             continue;
                         }
                     }
 
                     // Set event direction
-                    GCTAInstDir dir = radial()->mc(pnt_dir, ran);
+                    GCTAInstDir dir = model->radial()->mc(pnt_dir, stream);
 
                     // Set event energy
-                    GEnergy energy = spectral()->mc(obs.events()->ebounds().emin(ieng),
-                                                    obs.events()->ebounds().emax(ieng),
-                                                    ran);
-
-                    // Allocate event
-                    GCTAEventAtom event;
+                    GEnergy energy = model->spectral()->mc(ebounds.emin(ieng),
+                                                           ebounds.emax(ieng),
+                                                           stream);
 
                     // Set event attributes
                     event.dir(dir);
@@ -588,13 +640,26 @@ GCTAEventList* GCTAModelRadialAcceptance::mc(const GObservation& obs,
                     event.time(times[i]);
 
                     // Append event to list
-                    list->append(event);
+                    events.append(event);
 
                 } // endfor: looped over all events
 
-            } // endfor: looped over all GTIs
+            } // endfor: looped over all chunks
+
+            // Free model copy
+            delete model;
 
-        } // endfor: looped over all energy boundaries
+        } // end pragma omp parallel
+
+        // Append events of all chunks in chunk order
+        int nevents = 0;
+        for (int ichunk = 0; ichunk < nchunks; ++ichunk) {
+            nevents += lists[ichunk].size();
+        }
+        list->reserve(nevents);
+        for (int ichunk = 0; ichunk < nchunks; ++ichunk) {
+            list->extend(lists[ichunk]);
+        }
 
     } // endif: model was valid
 
@@ -28,11 +28,17 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <list>
+#include <map>
 #include "GObservationRegistry.hpp"
 #include "GException.hpp"
 #include "GFits.hpp"
 #include "GTools.hpp"
 #include "GModelSpatialPtsrc.hpp"
+#include "GSource.hpp"
 #include "GIntegral.hpp"
 #include "GIntegrand.hpp"
 #include "GCTAException.hpp"
@@ -65,10 +71,80 @@ const GObservationRegistry g_obs_veritas_registry(&g_obs_veritas_seed);
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_IRF_CACHE_MAX 10000000 //!< Maximum number of cached IRF values
 
 /* __ Debug definitions __________________________________________________ */
 
 
+/***********************************************************************//**
+ * @class GCTAObservation::irf_store
+ *
+ * @brief IRF cache of a CTA observation
+ *
+ * The IRF cache holds, for each source name, a list of entries with the IRF
+ * values of all counts cube bins for a given spatial model. Entries are
+ * only added, never modified or removed, hence pointers to their IRF values
+ * stay valid as long as the cache exists.
+ *
+ * The cache is shared between copies of an observation and is reference
+ * counted. All members are protected by the lock of the cache.
+ ***************************************************************************/
+class GCTAObservation::irf_store {
+public:
+    // Cache entry
+    struct entry {
+        std::string         type; //!< Spatial model type
+        std::vector<double> pars; //!< Spatial parameter values
+        std::vector<double> irfs; //!< IRF value per bin
+    };
+
+    // Constructors and destructors
+    irf_store(void) : refs(1), nvalues(0) {
+        #ifdef _OPENMP
+        omp_init_lock(&m_lock);
+        #endif
+    }
+    ~irf_store(void) {
+        #ifdef _OPENMP
+        omp_destroy_lock(&m_lock);
+        #endif
+    }
+
+    // Methods
+    void lock(void) {
+        #ifdef _OPENMP
+        omp_set_lock(&m_lock);
+        #endif
+    }
+    void unlock(void) {
+        #ifdef _OPENMP
+        omp_unset_lock(&m_lock);
+        #endif
+    }
+    const double* find(const std::string& name, const std::string& type,
+                       const std::vector<double>& pars) {
+        std::list<entry>& list = entries[name];
+        for (std::list<entry>::iterator it = list.begin(); it != list.end(); ++it) {
+            if (it->type == type && it->pars == pars) {
+                return &(it->irfs[0]);
+            }
+        }
+        return NULL;
+    }
+
+    // Members
+    int                                     refs;    //!< Number of owners
+    int                                     nvalues; //!< Number of cached values
+    std::map<std::string, std::list<entry> > entries; //!< Entries per source
+private:
+    #ifdef _OPENMP
+    omp_lock_t m_lock; //!< Cache lock
+    #endif
+    irf_store(const irf_store& store);
+    irf_store& operator= (const irf_store& store);
+};
+
+
 /*==========================================================================
  =                                                                         =
  =                        Constructors/destructors                         =
@@ -240,6 +316,9 @@ void GCTAObservation::response(const GResponse& rsp)
     // Clone response function
     m_response = ctarsp->clone();
 
+    // Clear IRF cache
+    clear_irf_cache();
+
     // Return
     return;
 }
@@ -265,6 +344,9 @@ void GCTAObservation::response(const std::string& irfname, std::string caldb)
     // Load instrument response function
     m_response->load(irfname);
 
+    // Clear IRF cache
+    clear_irf_cache();
+
     // Return
     return;
 }
@@ -306,6 +388,29 @@ void GCTAObservation::pointing(const GCTAPointing& pointing)
     // Clone pointing
     m_pointing = pointing.clone();
 
+    // Clear IRF cache
+    clear_irf_cache();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set event container
+ *
+ * @param[in] events Event container.
+ *
+ * Sets the event container and clears the IRF cache.
+ ***************************************************************************/
+void GCTAObservation::events(const GEvents* events)
+{
+    // Set event container
+    this->GObservation::events(events);
+
+    // Clear IRF cache
+    clear_irf_cache();
+
     // Return
     return;
 }
@@ -764,6 +869,9 @@ void GCTAObservation::load_unbinned(const std::string& filename)
     // Store event filename
     m_eventfile = filename;
 
+    // Clear IRF cache
+    clear_irf_cache();
+
     // Return
     return;
 }
@@ -803,6 +911,9 @@ void GCTAObservation::load_binned(const std::string& filename)
     // Store event filename
     m_eventfile = filename;
 
+    // Clear IRF cache
+    clear_irf_cache();
+
     // Return
     return;
 }
@@ -858,6 +969,29 @@ void GCTAObservation::save(const std::string& filename, bool clobber) const
 }
 
 
+/***********************************************************************//**
+ * @brief Enable or disable the IRF cache
+ *
+ * @param[in] cache Use IRF cache?
+ *
+ * Enables or disables the caching of IRF values for binned analysis.
+ * Disabling the cache releases all cached values.
+ ***************************************************************************/
+void GCTAObservation::irf_cache(const bool& cache)
+{
+    // Set flag
+    m_irf_cache = cache;
+
+    // Release cache if it is disabled
+    if (!m_irf_cache) {
+        clear_irf_cache();
+    }
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Private methods                              =
@@ -880,6 +1014,8 @@ void GCTAObservation::init_members(void)
     m_deadc      = 0.0;
     m_ra_obj     = 0.0;
     m_dec_obj    = 0.0;
+    m_irf_cache  = false;
+    m_cache_irfs = new irf_store;
 
     // Return
     return;
@@ -906,6 +1042,16 @@ void GCTAObservation::copy_members(const GCTAObservation& obs)
     m_deadc      = obs.m_deadc;
     m_ra_obj     = obs.m_ra_obj;
     m_dec_obj    = obs.m_dec_obj;
+    m_irf_cache  = obs.m_irf_cache;
+
+    // Share the IRF cache. The base class has already copied the events,
+    // which are identical to those of the original observation, hence the
+    // cached IRF values are valid for the copy.
+    release_irf_cache();
+    m_cache_irfs = obs.m_cache_irfs;
+    m_cache_irfs->lock();
+    m_cache_irfs->refs++;
+    m_cache_irfs->unlock();
 
     // Return
     return;
@@ -921,6 +1067,9 @@ void GCTAObservation::free_members(void)
     if (m_response != NULL) delete m_response;
     if (m_pointing != NULL) delete m_pointing;
 
+    // Release IRF cache
+    release_irf_cache();
+
     // Mark memory as free
     m_response = NULL;
     m_pointing = NULL;
@@ -1082,6 +1231,185 @@ void GCTAObservation::write_attributes(GFitsHDU* hdu) const
 }
 
 
+/***********************************************************************//**
+ * @brief Clear IRF cache
+ *
+ * Detaches the observation from its IRF cache and attaches it to a new,
+ * empty cache. Copies of the observation that share the former cache are
+ * not affected.
+ ***************************************************************************/
+void GCTAObservation::clear_irf_cache(void)
+{
+    // Replace cache by an empty cache
+    release_irf_cache();
+    m_cache_irfs = new irf_store;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Release IRF cache
+ *
+ * Detaches the observation from its IRF cache. The cache is deleted if no
+ * other copy of the observation shares it.
+ ***************************************************************************/
+void GCTAObservation::release_irf_cache(void)
+{
+    // Release cache
+    if (m_cache_irfs != NULL) {
+        m_cache_irfs->lock();
+        int refs = --(m_cache_irfs->refs);
+        m_cache_irfs->unlock();
+        if (refs == 0) {
+            delete m_cache_irfs;
+        }
+        m_cache_irfs = NULL;
+    }
+
+    // Return
+    return;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                      Model range evaluation methods                     =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Evaluate model for a range of events
+ *
+ * @param[in] model Model.
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[out] values Model values (iend-ibegin elements).
+ * @param[out] gradients Parameter gradients ((iend-ibegin)*model.size()
+ *                       elements).
+ * @param[in] view Event view of the events container (may be NULL).
+ *
+ * Evaluates a model for the events [ibegin,iend[. If the IRF cache is
+ * enabled and the model is a sky model with fixed spatial parameters, the
+ * IRF values are taken from the cache, so that only the spectral and
+ * temporal model components need to be evaluated.
+ ***************************************************************************/
+void GCTAObservation::model_range(const GModel& model, const int& ibegin,
+                                  const int& iend, double* values,
+                                  double* gradients, GEvent* view) const
+{
+    // Get IRF cache for sky model (NULL if the model can not be cached)
+    const GModelSky* sky  = (m_irf_cache)
+                            ? dynamic_cast<const GModelSky*>(&model) : NULL;
+    const double*    irfs = (sky != NULL) ? cached_irfs(*sky) : NULL;
+
+    // Evaluate model
+    if (irfs != NULL) {
+        sky->eval_gradients_range(*this, ibegin, iend, values, gradients,
+                                  view, irfs);
+    }
+    else {
+        model.eval_gradients_range(*this, ibegin, iend, values, gradients,
+                                   view);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return IRF cache for sky model
+ *
+ * @param[in] model Sky model.
+ * @return Pointer to IRF values (NULL if the model can not be cached).
+ *
+ * Returns a pointer to the IRF values of the sky model, holding one
+ * element per counts cube bin. NULL is returned if the observation is not
+ * binned, if there is no response, or if the model has no spatial
+ * component or a free spatial parameter.
+ *
+ * Cache entries are identified by the source name, the type and the real
+ * parameter values of the spatial model. If there is no entry yet, the IRF
+ * values are computed for all bins outside the cache lock, using a local
+ * event bin view, and the entry is then added under the cache lock unless
+ * another thread has added it meanwhile. An entry is complete once it is
+ * added, and it is never modified afterwards.
+ *
+ * NULL is also returned if the cache holds already G_IRF_CACHE_MAX values,
+ * in which case the model is evaluated without cache.
+ ***************************************************************************/
+const double* GCTAObservation::cached_irfs(const GModelSky& model) const
+{
+    // Initialise cache pointer
+    const double* irfs = NULL;
+
+    // Continue only for binned observations and sky models with fixed
+    // spatial component
+    const GCTAEventCube* cube    = dynamic_cast<const GCTAEventCube*>(m_events);
+    GModelSpatial*       spatial = model.spatial();
+    if (cube != NULL && cube->size() > 0 && spatial != NULL &&
+        m_response != NULL) {
+
+        // Get spatial parameters. Return NULL if any of them is free.
+        int                 npars = spatial->size();
+        std::vector<double> pars(npars);
+        for (int i = 0; i < npars; ++i) {
+            if ((*spatial)[i].isfree()) {
+                return NULL;
+            }
+            pars[i] = (*spatial)[i].real_value();
+        }
+
+        // Look up cache entry
+        std::string name  = model.name();
+        std::string type  = spatial->type();
+        int         nbins = cube->size();
+        bool        full  = false;
+        m_cache_irfs->lock();
+        irfs = m_cache_irfs->find(name, type, pars);
+        full = (m_cache_irfs->nvalues + nbins > G_IRF_CACHE_MAX);
+        m_cache_irfs->unlock();
+
+        // If there is no entry yet and the cache is not full then compute
+        // the IRF values for all bins and add them to the cache
+        if (irfs == NULL && !full) {
+
+            // Compute IRF values for all bins
+            const GResponse*    rsp = m_response;
+            GCTAEventBin        view;
+            std::vector<double> values(nbins, 0.0);
+            for (int i = 0; i < nbins; ++i) {
+                const GEvent* bin = cube->event(i, &view);
+                GSource source(name, *spatial, bin->energy(), bin->time());
+                values[i] = rsp->irf(*bin, source, *this);
+            }
+
+            // Add entry unless another thread has added it meanwhile
+            m_cache_irfs->lock();
+            irfs = m_cache_irfs->find(name, type, pars);
+            if (irfs == NULL &&
+                m_cache_irfs->nvalues + nbins <= G_IRF_CACHE_MAX) {
+                std::list<irf_store::entry>& list = m_cache_irfs->entries[name];
+                list.push_back(irf_store::entry());
+                list.back().type = type;
+                list.back().pars = pars;
+                list.back().irfs.swap(values);
+                m_cache_irfs->nvalues += nbins;
+                irfs = &(list.back().irfs[0]);
+            }
+            m_cache_irfs->unlock();
+
+        } // endif: entry was computed
+
+    } // endif: model could be cached
+
+    // Return
+    return irfs;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                        Npred integration methods                        =
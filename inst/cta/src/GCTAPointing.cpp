@@ -187,8 +187,8 @@ void GCTAPointing::dir(const GSkyDir& dir)
     // Set sky direction
     m_dir = dir;
 
-    // Invalidate cache
-    m_has_cache = false;
+    // Update rotation matrix
+    update();
 
     // Return
     return;
@@ -200,9 +200,6 @@ void GCTAPointing::dir(const GSkyDir& dir)
 ***************************************************************************/
 const GMatrix& GCTAPointing::rot(void) const
 {
-    // Update cache
-    update();
-
     // Return rotation matrix
     return m_Rback;
 }
@@ -240,9 +237,11 @@ void GCTAPointing::init_members(void)
     m_dir.clear();
     m_zenith    = 0.0;
     m_azimuth   = 0.0;
-    m_has_cache = false;
     m_Rback.clear();
 
+    // Set rotation matrix
+    update();
+
     // Return
     return;
 }
@@ -259,7 +258,6 @@ void GCTAPointing::copy_members(const GCTAPointing& pnt)
     m_dir       = pnt.m_dir;
     m_zenith    = pnt.m_zenith;
     m_azimuth   = pnt.m_azimuth;
-    m_has_cache = pnt.m_has_cache;
     m_Rback     = pnt.m_Rback;
 
     // Return
@@ -278,26 +276,22 @@ void GCTAPointing::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update coordinate transformation cache
+ * @brief Update rotation matrix
+ *
+ * Computes the rotation matrix for the actual pointing direction. The
+ * method is called whenever the pointing direction is set, so that rot()
+ * does not modify the pointing.
  ***************************************************************************/
-void GCTAPointing::update(void) const
+void GCTAPointing::update(void)
 {
-    // Update coordinate transformation cache only if required
-    if (!m_has_cache) {
-
-        // Set up Euler matrices
-        GMatrix Ry;
-        GMatrix Rz;
-        Ry.eulery(m_dir.dec_deg() - 90.0);
-        Rz.eulerz(-m_dir.ra_deg());
-
-        // Compute rotation matrix
-        m_Rback = transpose(Ry * Rz);
-
-        // Signal that we have a valid transformation cache
-        m_has_cache = true;
-
-    } // endif: Update of cache was required
+    // Set up Euler matrices
+    GMatrix Ry;
+    GMatrix Rz;
+    Ry.eulery(m_dir.dec_deg() - 90.0);
+    Rz.eulerz(-m_dir.ra_deg());
+
+    // Compute rotation matrix
+    m_Rback = transpose(Ry * Rz);
 
     // Return
     return;
@@ -178,24 +178,25 @@ double GCTAPsf2D::operator()(const double& delta,
     // Initialise PSF value
     double psf = 0.0;
 
-    // Update the parameter cache
-    update(logE, theta);
+    // Get Gaussian parameters
+    gauss_pars pars;
+    update(logE, theta, pars);
 
     // Continue only if normalization is positive
-    if (m_norm > 0.0) {
+    if (pars.norm > 0.0) {
 
         // Compute distance squared
         double delta2 = delta * delta;
 
         // Compute Psf value
-        psf = std::exp(m_width1 * delta2);
-        if (m_norm2 > 0.0) {
-            psf += std::exp(m_width2 * delta2) * m_norm2;
+        psf = std::exp(pars.width1 * delta2);
+        if (pars.norm2 > 0.0) {
+            psf += std::exp(pars.width2 * delta2) * pars.norm2;
         }
-        if (m_norm3 > 0.0) {
-            psf += std::exp(m_width3 * delta2) * m_norm3;
+        if (pars.norm3 > 0.0) {
+            psf += std::exp(pars.width3 * delta2) * pars.norm3;
         }
-        psf *= m_norm;
+        psf *= pars.norm;
 
     } // endif: normalization was positive
     
@@ -318,21 +319,22 @@ double GCTAPsf2D::mc(GRan&         ran,
                      const double& azimuth,
                      const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE, theta);
+    // Get Gaussian parameters
+    gauss_pars pars;
+    update(logE, theta, pars);
 
     // Select in which Gaussian we are
-    double sigma = m_sigma1;
-    double sum1  = m_sigma1;
-    double sum2  = m_sigma2 * m_norm2;
-    double sum3  = m_sigma3 * m_norm3;
+    double sigma = pars.sigma1;
+    double sum1  = pars.sigma1;
+    double sum2  = pars.sigma2 * pars.norm2;
+    double sum3  = pars.sigma3 * pars.norm3;
     double sum   = sum1 + sum2 + sum3;
     double u     = ran.uniform() * sum;
     if (u >= sum2) {
-        sigma = m_sigma3;
+        sigma = pars.sigma3;
     }
     else if (u >= sum1) {
-        sigma = m_sigma2;
+        sigma = pars.sigma2;
     }
 
     // Now draw from the selected Gaussian
@@ -364,13 +366,14 @@ double GCTAPsf2D::delta_max(const double& logE,
                             const double& azimuth,
                             const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE, theta);
+    // Get Gaussian parameters
+    gauss_pars pars;
+    update(logE, theta, pars);
 
     // Compute maximum sigma
-    double sigma = m_sigma1;
-    if (m_sigma2 > sigma) sigma = m_sigma2;
-    if (m_sigma3 > sigma) sigma = m_sigma3;
+    double sigma = pars.sigma1;
+    if (pars.sigma2 > sigma) sigma = pars.sigma2;
+    if (pars.sigma3 > sigma) sigma = pars.sigma3;
 
     // Compute maximum PSF radius
     double radius = 5.0 * sigma;
@@ -380,6 +383,61 @@ double GCTAPsf2D::delta_max(const double& logE,
 }
 
 
+/***********************************************************************//**
+ * @brief Return derivative of point spread function with respect to
+ *        angular separation (in units of sr^-1 rad^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (rad).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @param[in] phi Azimuth angle in camera system (rad). Not used.
+ * @param[in] zenith Zenith angle in Earth system (rad). Not used.
+ * @param[in] azimuth Azimuth angle in Earth system (rad). Not used.
+ * @param[in] etrue Use true energy (true/false). Not used.
+ *
+ * Returns the derivative of the point spread function, which is the sum
+ * of the derivatives \f$2 b_i \delta \, a_i \exp(b_i \delta^2)\f$ of the
+ * Gaussian components.
+ ***************************************************************************/
+double GCTAPsf2D::derivative(const double& delta,
+                             const double& logE, 
+                             const double& theta, 
+                             const double& phi,
+                             const double& zenith,
+                             const double& azimuth,
+                             const bool&   etrue) const
+{
+    // Initialise PSF derivative
+    double deriv = 0.0;
+
+    // Get Gaussian parameters
+    gauss_pars pars;
+    update(logE, theta, pars);
+
+    // Continue only if normalization is positive
+    if (pars.norm > 0.0) {
+
+        // Compute distance squared
+        double delta2 = delta * delta;
+
+        // Compute PSF derivative
+        deriv = pars.width1 * std::exp(pars.width1 * delta2);
+        if (pars.norm2 > 0.0) {
+            deriv += pars.width2 * std::exp(pars.width2 * delta2) * pars.norm2;
+        }
+        if (pars.norm3 > 0.0) {
+            deriv += pars.width3 * std::exp(pars.width3 * delta2) * pars.norm3;
+        }
+        deriv *= 2.0 * delta * pars.norm;
+
+    } // endif: normalization was positive
+
+    // Return PSF derivative
+    return deriv;
+}
+
+
 /***********************************************************************//**
  * @brief Print point spread function information
  *
@@ -414,17 +472,6 @@ void GCTAPsf2D::init_members(void)
     // Initialise members
     m_filename.clear();
     m_psf.clear();
-    m_par_logE  = -1.0e30;
-    m_par_theta = -1.0;
-    m_norm      = 1.0;
-    m_norm2     = 0.0;
-    m_norm3     = 0.0;
-    m_sigma1    = 0.0;
-    m_sigma2    = 0.0;
-    m_sigma3    = 0.0;
-    m_width1    = 0.0;
-    m_width2    = 0.0;
-    m_width3    = 0.0;
 
     // Return
     return;
@@ -441,17 +488,6 @@ void GCTAPsf2D::copy_members(const GCTAPsf2D& psf)
     // Copy members
     m_filename  = psf.m_filename;
     m_psf       = psf.m_psf;
-    m_par_logE  = psf.m_par_logE;
-    m_par_theta = psf.m_par_theta;
-    m_norm      = psf.m_norm;
-    m_norm2     = psf.m_norm2;
-    m_norm3     = psf.m_norm3;
-    m_sigma1    = psf.m_sigma1;
-    m_sigma2    = psf.m_sigma2;
-    m_sigma3    = psf.m_sigma3;
-    m_width1    = psf.m_width1;
-    m_width2    = psf.m_width2;
-    m_width3    = psf.m_width3;
 
     // Return
     return;
@@ -469,69 +505,64 @@ void GCTAPsf2D::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update PSF parameter cache
+ * @brief Compute Gaussian PSF parameters
  *
  * @param[in] logE Log10 of the true photon energy (TeV).
  * @param[in] theta Offset angle in camera system (rad).
+ * @param[out] pars Gaussian parameters.
  *
- * This method updates the PSF parameter cache.
+ * Computes the Gaussian parameters for a given energy and offset angle.
+ * The parameters are returned to the caller, hence the method can be
+ * called concurrently.
  ***************************************************************************/
-void GCTAPsf2D::update(const double& logE, const double& theta) const
+void GCTAPsf2D::update(const double& logE, const double& theta,
+                       gauss_pars& pars) const
 {
-    // Only compute PSF parameters if arguments have changed
-    if (logE != m_par_logE || theta != m_par_theta) {
-
-        // Save parameters
-        m_par_logE  = logE;
-        m_par_theta = theta;
-
-        // Interpolate response parameters
-        std::vector<double> pars = m_psf(logE, theta);
-
-        // Set Gaussian sigmas
-        m_sigma1 = pars[1];
-        m_sigma2 = pars[3];
-        m_sigma3 = pars[5];
-
-        // Set width parameters
-        double sigma1 = m_sigma1 * m_sigma1;
-        double sigma2 = m_sigma2 * m_sigma2;
-        double sigma3 = m_sigma3 * m_sigma3;
-
-        // Compute Gaussian 1
-        if (sigma1 > 0.0) {
-            m_width1 = -0.5 / sigma1;
-        }
-        else {
-            m_width1 = 0.0;
-        }
-
-        // Compute Gaussian 2
-        if (sigma2 > 0.0) {
-            m_width2 = -0.5 / sigma2;
-            m_norm2  = pars[2];
-        }
-        else {
-            m_width2 = 0.0;
-            m_norm2  = 0.0;
-        }
-
-        // Compute Gaussian 3
-        if (sigma3 > 0.0) {
-            m_width3 = -0.5 / sigma3;
-            m_norm3  = pars[4];
-        }
-        else {
-            m_width3 = 0.0;
-            m_norm3  = 0.0;
-        }
+    // Interpolate response parameters
+    std::vector<double> values = m_psf(logE, theta);
+
+    // Set Gaussian sigmas
+    pars.sigma1 = values[1];
+    pars.sigma2 = values[3];
+    pars.sigma3 = values[5];
+
+    // Set width parameters
+    double sigma1 = pars.sigma1 * pars.sigma1;
+    double sigma2 = pars.sigma2 * pars.sigma2;
+    double sigma3 = pars.sigma3 * pars.sigma3;
+
+    // Compute Gaussian 1
+    if (sigma1 > 0.0) {
+        pars.width1 = -0.5 / sigma1;
+    }
+    else {
+        pars.width1 = 0.0;
+    }
 
-        // Compute global normalization parameter
-        double integral = twopi * (sigma1 + sigma2*m_norm2 + sigma3*m_norm3);
-        m_norm = (integral > 0.0) ? 1.0 / integral : 0.0;
+    // Compute Gaussian 2
+    if (sigma2 > 0.0) {
+        pars.width2 = -0.5 / sigma2;
+        pars.norm2  = values[2];
+    }
+    else {
+        pars.width2 = 0.0;
+        pars.norm2  = 0.0;
+    }
 
+    // Compute Gaussian 3
+    if (sigma3 > 0.0) {
+        pars.width3 = -0.5 / sigma3;
+        pars.norm3  = values[4];
+    }
+    else {
+        pars.width3 = 0.0;
+        pars.norm3  = 0.0;
     }
 
+    // Compute global normalization parameter
+    double integral = twopi * (sigma1 + sigma2*pars.norm2 + sigma3*pars.norm3);
+    pars.norm = (integral > 0.0) ? 1.0 / integral : 0.0;
+
     // Return
     return;
 }
@@ -176,11 +176,14 @@ double GCTAPsfPerfTable::operator()(const double& delta,
                                     const double& azimuth,
                                     const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE);
+    // Get Gaussian parameters
+    double scale;
+    double sigma;
+    double width;
+    update(logE, scale, sigma, width);
 
     // Compute PSF value
-    double psf = m_par_scale * std::exp(m_par_width * delta * delta);
+    double psf = scale * std::exp(width * delta * delta);
     
     // Return PSF
     return psf;
@@ -327,11 +330,14 @@ double GCTAPsfPerfTable::mc(GRan&         ran,
                             const double& azimuth,
                             const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE);
+    // Get Gaussian parameters
+    double scale;
+    double sigma;
+    double width;
+    update(logE, scale, sigma, width);
 
     // Draw offset
-    double delta = m_par_sigma * ran.chisq2();
+    double delta = sigma * ran.chisq2();
     
     // Return PSF offset
     return delta;
@@ -359,17 +365,60 @@ double GCTAPsfPerfTable::delta_max(const double& logE,
                                    const double& azimuth,
                                    const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE);
+    // Get Gaussian parameters
+    double scale;
+    double sigma;
+    double width;
+    update(logE, scale, sigma, width);
 
     // Compute maximum PSF radius
-    double radius = 5.0 * m_par_sigma;
+    double radius = 5.0 * sigma;
     
     // Return maximum PSF radius
     return radius;
 }
 
 
+/***********************************************************************//**
+ * @brief Return derivative of point spread function with respect to
+ *        angular separation (in units of sr^-1 rad^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (rad).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad). Not used.
+ * @param[in] phi Azimuth angle in camera system (rad). Not used.
+ * @param[in] zenith Zenith angle in Earth system (rad). Not used.
+ * @param[in] azimuth Azimuth angle in Earth system (rad). Not used.
+ * @param[in] etrue Use true energy (true/false). Not used.
+ *
+ * Returns the derivative of the Gaussian point spread function
+ * \f$PSF(\delta) = a \exp(b \delta^2)\f$, which is
+ * \f$2 b \delta PSF(\delta)\f$.
+ ***************************************************************************/
+double GCTAPsfPerfTable::derivative(const double& delta,
+                                    const double& logE, 
+                                    const double& theta, 
+                                    const double& phi,
+                                    const double& zenith,
+                                    const double& azimuth,
+                                    const bool&   etrue) const
+{
+    // Get Gaussian parameters
+    double scale;
+    double sigma;
+    double width;
+    update(logE, scale, sigma, width);
+
+    // Compute PSF derivative
+    double psf   = scale * std::exp(width * delta * delta);
+    double deriv = 2.0 * width * delta * psf;
+
+    // Return PSF derivative
+    return deriv;
+}
+
+
 /***********************************************************************//**
  * @brief Print point spread function information
  *
@@ -414,10 +463,6 @@ void GCTAPsfPerfTable::init_members(void)
     m_r68.clear();
     m_r80.clear();
     m_sigma.clear();
-    m_par_logE  = -1.0e30;
-    m_par_scale = 1.0;
-    m_par_sigma = 0.0;
-    m_par_width = 0.0;
 
     // Return
     return;
@@ -437,10 +482,6 @@ void GCTAPsfPerfTable::copy_members(const GCTAPsfPerfTable& psf)
     m_r68       = psf.m_r68;
     m_r80       = psf.m_r80;
     m_sigma     = psf.m_sigma;
-    m_par_logE  = psf.m_par_logE;
-    m_par_scale = psf.m_par_scale;
-    m_par_sigma = psf.m_par_sigma;
-    m_par_width = psf.m_par_width;
 
     // Return
     return;
@@ -458,31 +499,28 @@ void GCTAPsfPerfTable::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update PSF parameter cache
+ * @brief Compute Gaussian PSF parameters
  *
  * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[out] scale Gaussian normalization.
+ * @param[out] sigma Gaussian sigma (radians).
+ * @param[out] width Gaussian width parameter.
  *
- * This method updates the PSF parameter cache. As the performance table PSF
- * only depends on energy, the only parameter on which the cache values
- * depend is the energy.
+ * Computes the Gaussian parameters for a given energy. The parameters are
+ * returned to the caller, hence the method can be called concurrently.
  ***************************************************************************/
-void GCTAPsfPerfTable::update(const double& logE) const
+void GCTAPsfPerfTable::update(const double& logE,
+                              double&       scale,
+                              double&       sigma,
+                              double&       width) const
 {
-    // Only compute PSF parameters if arguments have changed
-    if (logE != m_par_logE) {
-
-        // Save energy
-        m_par_logE = logE;
-    
-        // Determine Gaussian sigma in radians
-        m_par_sigma = m_logE.interpolate(logE, m_sigma);
-
-        // Derive width=-0.5/(sigma*sigma) and scale=1/(twopi*sigma*sigma)
-        double sigma2 = m_par_sigma * m_par_sigma;
-        m_par_scale   =  1.0 / (twopi * sigma2);
-        m_par_width   = -0.5 / sigma2;
+    // Determine Gaussian sigma in radians
+    sigma = m_logE.interpolate(logE, m_sigma);
 
-    }
+    // Derive width=-0.5/(sigma*sigma) and scale=1/(twopi*sigma*sigma)
+    double sigma2 = sigma * sigma;
+    scale         =  1.0 / (twopi * sigma2);
+    width         = -0.5 / sigma2;
 
     // Return
     return;
@@ -28,6 +28,9 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <cmath>
 #include <vector>
 #include <string>
@@ -40,6 +43,7 @@
 #include "GCTAResponse_helpers.hpp"
 #include "GCTAPointing.hpp"
 #include "GCTAEventList.hpp"
+#include "GCTAEventAtom.hpp"
 #include "GCTARoi.hpp"
 #include "GCTAException.hpp"
 #include "GCTASupport.hpp"
@@ -50,6 +54,10 @@
 #include "GCTAPsf2D.hpp"
 #include "GCTAPsfVector.hpp"
 #include "GCTAPsfPerfTable.hpp"
+#include "GModelSpatialPtsrc.hpp"
+#include "GModelRadialGauss.hpp"
+#include "GModelRadialDisk.hpp"
+#include "GModelRadialShell.hpp"
 
 /* __ Method name definitions ____________________________________________ */
 #define G_CALDB                           "GCTAResponse::caldb(std::string&)"
@@ -58,8 +66,16 @@
 #define G_NPRED             "GCTAResponse::npred(GSkyDir&, GEnergy&, GTime&,"\
                                                             " GObservation&)"
 #define G_MC            "GCTAResponse::mc(double&,GPhoton&,GPointing&,GRan&)"
+#define G_MC_EVENT         "GCTAResponse::mc(double&,GPhoton&,GObservation&,"\
+                                                     "GRan&,GCTAEventAtom&)"
 #define G_IRF_EXTENDED      "GCTAResponse::irf_extended(GInstDir&, GEnergy&,"\
            " GTime&, GModelExtendedSource&, GEnergy&, GTime&, GObservation&)"
+#define G_IRF_GRADIENTS  "GCTAResponse::irf_gradients(GEvent&, GSource&,"\
+                                                            " GObservation&)"
+#define G_IRF_PTSRC_GRADIENTS         "GCTAResponse::irf_ptsrc_gradients("\
+                                       "GEvent&, GSource&, GObservation&)"
+#define G_IRF_RADIAL       "GCTAResponse::irf_radial(GEvent&, GSource&,"\
+                                                     " GObservation&, bool&)"
 #define G_IRF_DIFFUSE     "GCTAResponse::irf_diffuse(GCTAInstDir&, GEnergy&,"\
          " GTime&, GModelDiffuseSource&, GEnergy&, GTime&, GCTAObservation&)"
 #define G_NPRED_EXTENDED                      "GCTAResponse::npred_extended("\
@@ -71,6 +87,8 @@
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_GRAD_THETA_STEP 1.0e-6    //!< Offset angle step for Aeff derivative
+#define G_MC_BLOCK            10000    //!< Number of photons per MC block
 
 /* __ Debug definitions __________________________________________________ */
 //#define G_DEBUG_READ_ARF                         //!< Debug read_arf method
@@ -460,11 +478,42 @@ double GCTAResponse::npred(const GPhoton&      photon,
  * @param[in] obs Observation.
  * @param[in] ran Random number generator.
  *
+ * Simulates a CTA event using the response function from an incident photon.
+ * If the event is not detected a NULL pointer is returned. The event is
+ * allocated on the heap and needs to be deleted by the caller; use the
+ * mc() method that takes an event reference to avoid the allocation.
+ ***************************************************************************/
+GCTAEventAtom* GCTAResponse::mc(const double& area, const GPhoton& photon,
+                                const GObservation& obs, GRan& ran) const
+{
+    // Initialise event
+    GCTAEventAtom* event = NULL;
+
+    // Simulate event
+    GCTAEventAtom atom;
+    if (mc(area, photon, obs, ran, atom)) {
+        event = new GCTAEventAtom(atom);
+    }
+
+    // Return event
+    return event;
+}
+
+
+/***********************************************************************//**
+ * @brief Simulate event from photon into existing event
+ *
+ * @param[in] area Simulation surface area.
+ * @param[in] photon Photon.
+ * @param[in] obs Observation.
+ * @param[in] ran Random number generator.
+ * @param[out] event Simulated event (only set if the photon was detected).
+ * @return True if the photon was detected.
+ *
  * @exception GCTAException::no_pointing
  *            No CTA pointing found in observation.
  *
  * Simulates a CTA event using the response function from an incident photon.
- * If the event is not detected a NULL pointer is returned.
  *
  * The method also applies a deadtime correction using a Monte Carlo process,
  * taking into account temporal deadtime variations. For this purpose, the
@@ -473,16 +522,17 @@ double GCTAResponse::npred(const GPhoton&      photon,
  * @todo Set polar angle phi of photon in camera system
  * @todo Implement energy dispersion
  ***************************************************************************/
-GCTAEventAtom* GCTAResponse::mc(const double& area, const GPhoton& photon,
-                                const GObservation& obs, GRan& ran) const
+bool GCTAResponse::mc(const double& area, const GPhoton& photon,
+                      const GObservation& obs, GRan& ran,
+                      GCTAEventAtom& event) const
 {
-    // Initialise event
-    GCTAEventAtom* event = NULL;
+    // Initialise detection flag
+    bool detected = false;
 
     // Get pointer on CTA pointing
     GCTAPointing* pnt = dynamic_cast<GCTAPointing*>(obs.pointing());
     if (pnt == NULL) {
-        throw GCTAException::no_pointing(G_MC);
+        throw GCTAException::no_pointing(G_MC_EVENT);
     }
 
     // Get pointing direction zenith angle and azimuth [radians]
@@ -519,20 +569,115 @@ GCTAEventAtom* GCTAResponse::mc(const double& area, const GPhoton& photon,
             GCTAInstDir inst_dir;
             inst_dir.dir(sky_dir);
 
-            // Allocate event
-            event = new GCTAEventAtom;
-
             // Set event attributes
-            event->dir(inst_dir);
-            event->energy(photon.energy());
-            event->time(photon.time());
+            event.dir(inst_dir);
+            event.energy(photon.energy());
+            event.time(photon.time());
+
+            // Signal detection
+            detected = true;
 
         } // endif: detector was alive
 
     } // endif: event was detected
 
-    // Return event
-    return event;
+    // Return detection flag
+    return detected;
+}
+
+
+/***********************************************************************//**
+ * @brief Simulate events from photons
+ *
+ * @param[in] area Simulation surface area.
+ * @param[in] photons Photons.
+ * @param[in] obs Observation.
+ * @param[in] ran Random number generator.
+ * @param[in,out] events Event list to which detected events are appended.
+ *
+ * Simulates CTA events for a list of incident photons and appends the
+ * detected events to an event list.
+ *
+ * The photons are split into blocks of G_MC_BLOCK photons that are
+ * distributed over the threads. Block i draws its random numbers from
+ * stream i of a generator that is seeded from @p ran, and the events of
+ * all blocks are appended in block order. The result hence does not
+ * depend on the number of threads. Each thread uses its own copy of the
+ * response since the PSF caches its parameters. The random number
+ * generator @p ran is advanced by one draw, so that successive calls
+ * produce different events.
+ ***************************************************************************/
+void GCTAResponse::mc(const double& area, const GPhotons& photons,
+                      const GObservation& obs, GRan& ran,
+                      GCTAEventList& events) const
+{
+    // Get number of photons and blocks
+    int nphotons = photons.size();
+    int nblocks  = (nphotons + G_MC_BLOCK - 1) / G_MC_BLOCK;
+
+    // Derive generator for block streams
+    GRan base(ran.int64());
+
+    // Allocate event lists for all blocks
+    std::vector<GCTAEventList> lists(nblocks);
+
+    // Set number of threads. No more threads than blocks are used since
+    // each thread copies the response.
+    #ifdef _OPENMP
+    int nthreads = (nblocks < omp_get_max_threads()) ? nblocks
+                                                     : omp_get_max_threads();
+    #else
+    int nthreads = 1;
+    #endif
+    if (nthreads < 1) {
+        nthreads = 1;
+    }
+
+    // Simulate blocks
+    #pragma omp parallel num_threads(nthreads)
+    {
+        // Allocate response copy for this thread
+        GCTAResponse* rsp = clone();
+
+        // Loop over blocks
+        #pragma omp for schedule(dynamic)
+        for (int iblock = 0; iblock < nblocks; ++iblock) {
+
+            // Get block range and random number stream
+            int           ibegin = iblock * G_MC_BLOCK;
+            int           iend   = (ibegin + G_MC_BLOCK < nphotons)
+                                   ? ibegin + G_MC_BLOCK : nphotons;
+            GRan          stream = base.stream(iblock);
+            GCTAEventList& list  = lists[iblock];
+            GCTAEventAtom event;
+
+            // Simulate events
+            list.reserve(iend - ibegin);
+            for (int i = ibegin; i < iend; ++i) {
+                if (rsp->mc(area, photons[i], obs, stream, event)) {
+                    list.append(event);
+                }
+            }
+
+        } // endfor: looped over blocks
+
+        // Free response copy
+        delete rsp;
+
+    } // end pragma omp parallel
+
+    // Append events of all blocks in block order
+    int nevents = events.size();
+    for (int iblock = 0; iblock < nblocks; ++iblock) {
+        nevents += lists[iblock].size();
+    }
+    events.reserve(nevents);
+    for (int iblock = 0; iblock < nblocks; ++iblock) {
+        events.extend(lists[iblock]);
+    }
+
+    // Return
+    return;
 }
 
 
@@ -723,6 +868,30 @@ void GCTAResponse::load_psf(const std::string& filename)
 }
 
 
+/***********************************************************************//**
+ * @brief Set integration method for IRF computation
+ *
+ * @param[in] method Integration method.
+ *
+ * @exception GException::invalid_argument
+ *            Invalid integration method specified.
+ *
+ * Sets the numerical integration method that is used for the computation
+ * of the radial and diffuse model IRFs (see GIntegral::method() for the
+ * available methods). By default, Romberg integration is used.
+ ***************************************************************************/
+void GCTAResponse::integration(const std::string& method)
+{
+    // Check and set method
+    GIntegral integral;
+    integral.method(method);
+    m_integration = integral.method();
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Set offset angle dependence (degrees)
  *
@@ -797,6 +966,7 @@ std::string GCTAResponse::print(void) const
     result.append("\n"+parformat("Calibration database")+m_caldb);
     result.append("\n"+parformat("Response name")+m_rspname);
     result.append("\n"+parformat("RMF file name")+m_rmffile);
+    result.append("\n"+parformat("IRF integration method")+m_integration);
 
     // Append effective area information
     if (m_aeff != NULL) {
@@ -819,6 +989,68 @@ std::string GCTAResponse::print(void) const
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Return value of instrument response function and spatial
+ *        parameter gradients
+ *
+ * @param[in] event Observed event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ *
+ * Returns the instrument response function for a given event, source and
+ * observation and sets the gradients of the instrument response function
+ * with respect to the free spatial model parameters.
+ *
+ * The gradients are computed analytically for point sources (with respect
+ * to Right Ascension and Declination) and for the shape parameters of
+ * the Gaussian, disk and shell models. All other free spatial parameters
+ * that have the hasgrad() flag set are derived numerically using
+ * GResponse::irf_grad().
+ ***************************************************************************/
+double GCTAResponse::irf_gradients(const GEvent&       event,
+                                   const GSource&      source,
+                                   const GObservation& obs) const
+{
+    // Initialise IRF value
+    double irf = 0.0;
+
+    // Get spatial model
+    const GModelSpatial* model = source.model();
+
+    // Analytic gradients for point sources
+    if (dynamic_cast<const GModelSpatialPtsrc*>(model) != NULL) {
+        irf = irf_ptsrc_gradients(event, source, obs);
+    }
+
+    // Analytic shape gradients for radial models
+    else if (dynamic_cast<const GModelRadialGauss*>(model) != NULL ||
+             dynamic_cast<const GModelRadialDisk*>(model)  != NULL ||
+             dynamic_cast<const GModelRadialShell*>(model) != NULL) {
+
+        // Compute IRF and shape parameter gradients
+        irf = irf_radial(event, source, obs, true) * obs.deadc(source.time());
+
+        // Compute numerical gradients for the model position
+        GModelSpatial* ptr = const_cast<GModelSpatial*>(model);
+        for (int i = 0; i < 2; ++i) {
+            GModelPar& par = (*ptr)[i];
+            if (par.isfree() && par.hasgrad()) {
+                par.gradient(irf_grad(event, source, obs, i));
+            }
+        }
+
+    }
+
+    // Numerical gradients for all other models
+    else {
+        irf = GResponse::irf_gradients(event, source, obs);
+    }
+
+    // Return IRF value
+    return irf;
+}
+
+
 /***********************************************************************//**
  * @brief Return value of extended source instrument response function
  *
@@ -860,135 +1092,8 @@ double GCTAResponse::irf_extended(const GEvent&       event,
                                   const GSource&      source,
                                   const GObservation& obs) const
 {
-    // Get pointer on CTA observation
-    const GCTAObservation* ctaobs = dynamic_cast<const GCTAObservation*>(&obs);
-    if (ctaobs == NULL) {
-        throw GCTAException::bad_observation_type(G_IRF_EXTENDED);
-    }
-
-    // Get pointer on CTA pointing
-    const GCTAPointing *pnt = ctaobs->pointing();
-    if (pnt == NULL) {
-        throw GCTAException::no_pointing(G_IRF_EXTENDED);
-    }
-
-    // Get pointer on CTA instrument direction
-    const GCTAInstDir* dir = dynamic_cast<const GCTAInstDir*>(&(event.dir()));
-    if (dir == NULL) {
-        throw GCTAException::bad_instdir_type(G_IRF_EXTENDED);
-    }
-
-    // Get pointer on radial model
-    const GModelRadial* model = dynamic_cast<const GModelRadial*>(source.model());
-    if (model == NULL) {
-        throw GCTAException::bad_model_type(G_IRF_EXTENDED);
-    }
-
-    // Get event attributes
-    const GSkyDir& obsDir = dir->dir();
-    const GEnergy& obsEng = event.energy();
-
-    // Get source attributes
-    const GSkyDir& centre = model->dir();
-    const GEnergy& srcEng = source.energy();
-
-    // Get pointing direction zenith angle and azimuth [radians]
-    double zenith  = pnt->zenith();
-    double azimuth = pnt->azimuth();
-
-    // Determine angular distance between measured photon direction and model
-    // centre [radians]
-    double zeta = centre.dist(dir->dir());
-
-    // Determine angular distance between measured photon direction and
-    // pointing direction [radians]
-    double eta = pnt->dir().dist(dir->dir());
-
-    // Determine angular distance between model centre and pointing direction
-    // [radians]
-    double lambda = centre.dist(pnt->dir());
-
-    // Compute azimuth angle of pointing in model system [radians]
-    // Will be comprised in interval [0,pi]
-    double omega0 = 0.0;
-    double denom  = std::sin(lambda) * std::sin(zeta);
-    if (denom != 0.0) {
-        double arg = (std::cos(eta) - std::cos(lambda) * std::cos(zeta))/denom;
-        omega0     = arccos(arg);
-    }
-
-    // Get log10(E/TeV) of true and measured photon energies
-    double srcLogEng = srcEng.log10TeV();
-    double obsLogEng = obsEng.log10TeV();
-
-    // Assign the observed theta angle (eta) as the true theta angle
-    // between the source and the pointing directions. This is a (not
-    // too bad) approximation which helps to speed up computations.
-    // If we want to do this correctly, however, we would need to move
-    // the psf_dummy_sigma down to the integration kernel, and we would
-    // need to make sure that psf_delta_max really gives the absolute
-    // maximum (this is certainly less critical)
-    double theta = eta;
-    double phi   = 0.0; //TODO: Implement Phi dependence
-
-    // Get maximum PSF and source radius in radians.
-    double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
-    double src_max   = model->theta_max();
-
-    // Set radial model zenith angle range
-    double rho_min = (zeta > delta_max) ? zeta - delta_max : 0.0;
-    double rho_max = zeta + delta_max;
-    if (rho_max > src_max) {
-        rho_max = src_max;
-    }
-
-    // Initialise IRF value
-    double irf = 0.0;
-
-    // Perform zenith angle integration if interval is valid
-    if (rho_max > rho_min) {
-
-        // Setup integration kernel
-        cta_irf_radial_kern_rho integrand(this,
-                                          model,
-                                          zenith,
-                                          azimuth,
-                                          srcLogEng,
-                                          obsLogEng,
-                                          zeta,
-                                          lambda,
-                                          omega0,
-                                          delta_max);
-
-        // Integrate over zenith angle
-        GIntegral integral(&integrand);
-        integral.eps(m_eps);
-        irf = integral.romb(rho_min, rho_max);
-
-        // Compile option: Check for NaN/Inf
-        #if defined(G_NAN_CHECK)
-        if (isnotanumber(irf) || isinfinite(irf)) {
-            std::cout << "*** ERROR: GCTAResponse::irf_extended:";
-            std::cout << " NaN/Inf encountered";
-            std::cout << " (irf=" << irf;
-            std::cout << ", rho_min=" << rho_min;
-            std::cout << ", rho_max=" << rho_max;
-            std::cout << ", omega0=" << omega0 << ")";
-            std::cout << std::endl;
-        }
-        #endif
-    }
-
-    // Compile option: Show integration results
-    #if defined(G_DEBUG_IRF_EXTENDED)
-    std::cout << "GCTAResponse::irf_extended:";
-    std::cout << " rho_min=" << rho_min;
-    std::cout << " rho_max=" << rho_max;
-    std::cout << " irf=" << irf << std::endl;
-    #endif
-
-    // Return IRF value
-    return irf;
+    // Return IRF value without gradients
+    return (irf_radial(event, source, obs, false));
 }
 
 
@@ -1108,7 +1213,8 @@ double GCTAResponse::irf_diffuse(const GEvent&       event,
         // Integrate over zenith angle
         GIntegral integral(&integrand);
         integral.eps(1.0e-2);
-        irf = integral.romb(0.0, delta_max);
+        integral.method(m_integration);
+        irf = integral.integrate(0.0, delta_max);
 
         // Compile option: Check for NaN/Inf
         #if defined(G_NAN_CHECK)
@@ -1489,6 +1595,38 @@ double GCTAResponse::psf(const double& delta,
 }
 
 
+/***********************************************************************//**
+ * @brief Return derivative of point spread function with respect to
+ *        angular separation (in units of sr^-1 radians^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (radians).
+ * @param[in] theta Radial offset angle in camera (radians).
+ * @param[in] phi Polar angle in camera (radians).
+ * @param[in] zenith Zenith angle of telescope pointing (radians).
+ * @param[in] azimuth Azimuth angle of telescope pointing (radians).
+ * @param[in] srcLogEng Log10 of true photon energy (E/TeV).
+ *
+ * If no point spread function is defined, 0.0 is returned.
+ ***************************************************************************/
+double GCTAResponse::psf_derivative(const double& delta,
+                                    const double& theta,
+                                    const double& phi,
+                                    const double& zenith,
+                                    const double& azimuth,
+                                    const double& srcLogEng) const
+{
+    // Compute PSF derivative
+    double derivative = (m_psf != NULL)
+                        ? m_psf->derivative(delta, srcLogEng, theta, phi,
+                                            zenith, azimuth)
+                        : 0.0;
+
+    // Return PSF derivative
+    return derivative;
+}
+
+
 /***********************************************************************//**
  * @brief Return maximum angular separation (in radians)
  *
@@ -1716,10 +1854,11 @@ void GCTAResponse::init_members(void)
     m_caldb.clear();
     m_rspname.clear();
     m_rmffile.clear();
-    m_eps   = 1.0e-5; // Precision for Romberg integration
-    m_aeff  = NULL;
-    m_psf   = NULL;
-    m_edisp = NULL;
+    m_eps         = 1.0e-5; // Precision for Romberg integration
+    m_integration = "ROMBERG";
+    m_aeff        = NULL;
+    m_psf         = NULL;
+    m_edisp       = NULL;
     
     // Return
     return;
@@ -1734,10 +1873,11 @@ void GCTAResponse::init_members(void)
 void GCTAResponse::copy_members(const GCTAResponse& rsp)
 {
     // Copy members
-    m_caldb   = rsp.m_caldb;
-    m_rspname = rsp.m_rspname;
-    m_rmffile = rsp.m_rmffile;
-    m_eps     = rsp.m_eps;
+    m_caldb       = rsp.m_caldb;
+    m_rspname     = rsp.m_rspname;
+    m_rmffile     = rsp.m_rmffile;
+    m_eps         = rsp.m_eps;
+    m_integration = rsp.m_integration;
 
     // Clone members
     m_aeff  = (rsp.m_aeff  != NULL) ? rsp.m_aeff->clone()  : NULL;
@@ -1767,3 +1907,465 @@ void GCTAResponse::free_members(void)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Return value of point source instrument response function and
+ *        position gradients
+ *
+ * @param[in] event Observed event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ *
+ * @exception GCTAException::bad_observation_type
+ *            Observation is not a CTA observations.
+ * @exception GCTAException::no_pointing
+ *            No valid CTA pointing found.
+ * @exception GCTAException::bad_instdir_type
+ *            Instrument direction is not a valid CTA instrument direction.
+ *
+ * Computes the point source instrument response function, including the
+ * deadtime correction, and sets the gradients with respect to the free
+ * source position parameters. The response depends on the source position
+ * through the angular separation \f$\delta\f$ between source and measured
+ * event direction and through the offset angle \f$\theta\f$ between source
+ * and pointing direction:
+ * \f[\frac{\partial IRF}{\partial x} =
+ *    A_{\rm eff}(\theta) \frac{\partial PSF}{\partial \delta}
+ *    \frac{\partial \delta}{\partial x} +
+ *    \frac{\partial (A_{\rm eff} PSF)}{\partial \theta}
+ *    \frac{\partial \theta}{\partial x}\f]
+ * The PSF derivative is computed analytically, the offset angle
+ * derivative by a finite difference of step G_GRAD_THETA_STEP.
+ * Energy dispersion is not taken into account for the gradients.
+ ***************************************************************************/
+double GCTAResponse::irf_ptsrc_gradients(const GEvent&       event,
+                                         const GSource&      source,
+                                         const GObservation& obs) const
+{
+    // Get pointer on CTA observation
+    const GCTAObservation* ctaobs = dynamic_cast<const GCTAObservation*>(&obs);
+    if (ctaobs == NULL) {
+        throw GCTAException::bad_observation_type(G_IRF_PTSRC_GRADIENTS);
+    }
+
+    // Get pointer on CTA pointing
+    const GCTAPointing *pnt = ctaobs->pointing();
+    if (pnt == NULL) {
+        throw GCTAException::no_pointing(G_IRF_PTSRC_GRADIENTS);
+    }
+
+    // Get pointer on CTA instrument direction
+    const GCTAInstDir* dir = dynamic_cast<const GCTAInstDir*>(&(event.dir()));
+    if (dir == NULL) {
+        throw GCTAException::bad_instdir_type(G_IRF_PTSRC_GRADIENTS);
+    }
+
+    // Get non-const pointer on point source model (circumvent const
+    // correctness)
+    GModelSpatialPtsrc* model =
+        const_cast<GModelSpatialPtsrc*>(dynamic_cast<const GModelSpatialPtsrc*>(source.model()));
+
+    // Get directions
+    GSkyDir        srcDir = model->dir();
+    const GSkyDir& obsDir = dir->dir();
+    const GSkyDir& pntDir = pnt->dir();
+
+    // Get pointing direction zenith angle and azimuth [radians]
+    double zenith  = pnt->zenith();
+    double azimuth = pnt->azimuth();
+
+    // Get radial offset and polar angles of true photon in camera [radians]
+    double theta = pntDir.dist(srcDir);
+    double phi   = 0.0; //TODO: Implement Phi dependence
+
+    // Get log10(E/TeV) of true photon energy
+    double srcLogEng = source.energy().log10TeV();
+
+    // Determine angular separation between true and measured photon
+    // direction in radians
+    double delta = obsDir.dist(srcDir);
+
+    // Get maximum angular separation for which PSF is significant
+    double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
+
+    // Initialise IRF value and gradients
+    double irf   = 0.0;
+    double g_ra  = 0.0;
+    double g_dec = 0.0;
+
+    // Compute only if we're sufficiently close to PSF
+    if (delta <= delta_max) {
+
+        // Compute effective area and PSF
+        double aeff_val = aeff(theta, phi, zenith, azimuth, srcLogEng);
+        double psf_val  = psf(delta, theta, phi, zenith, azimuth, srcLogEng);
+        irf             = aeff_val * psf_val;
+
+        // Multiply-in energy dispersion
+        if (hasedisp() && irf > 0.0) {
+            double obsLogEng = event.energy().log10TeV();
+            irf *= edisp(obsLogEng, theta, phi, zenith, azimuth, srcLogEng);
+        }
+
+        // Compute derivative with respect to delta
+        double dirf_ddelta = aeff_val * psf_derivative(delta, theta, phi,
+                                                       zenith, azimuth,
+                                                       srcLogEng);
+
+        // Compute derivative with respect to theta
+        double h           = G_GRAD_THETA_STEP;
+        double theta_lo    = (theta > h) ? theta - h : theta;
+        double theta_hi    = theta + h;
+        double f_lo        = aeff(theta_lo, phi, zenith, azimuth, srcLogEng) *
+                             psf(delta, theta_lo, phi, zenith, azimuth, srcLogEng);
+        double f_hi        = aeff(theta_hi, phi, zenith, azimuth, srcLogEng) *
+                             psf(delta, theta_hi, phi, zenith, azimuth, srcLogEng);
+        double dirf_dtheta = (f_hi - f_lo) / (theta_hi - theta_lo);
+
+        // Precompute trigonometric functions of source direction
+        double cos_dec = std::cos(srcDir.dec());
+        double sin_dec = std::sin(srcDir.dec());
+
+        // Compute factors dIRF/dcos(delta) and dIRF/dcos(theta)
+        double sin_delta = std::sin(delta);
+        double sin_theta = std::sin(theta);
+        double f_delta   = (sin_delta > 0.0) ? -dirf_ddelta / sin_delta : 0.0;
+        double f_theta   = (sin_theta > 0.0) ? -dirf_dtheta / sin_theta : 0.0;
+
+        // Add delta contribution
+        double dra       = srcDir.ra() - obsDir.ra();
+        double cos_dec_t = std::cos(obsDir.dec());
+        double sin_dec_t = std::sin(obsDir.dec());
+        g_ra  += f_delta * (-cos_dec * cos_dec_t * std::sin(dra));
+        g_dec += f_delta * (cos_dec * sin_dec_t -
+                            sin_dec * cos_dec_t * std::cos(dra));
+
+        // Add theta contribution
+        dra       = srcDir.ra() - pntDir.ra();
+        cos_dec_t = std::cos(pntDir.dec());
+        sin_dec_t = std::sin(pntDir.dec());
+        g_ra  += f_theta * (-cos_dec * cos_dec_t * std::sin(dra));
+        g_dec += f_theta * (cos_dec * sin_dec_t -
+                            sin_dec * cos_dec_t * std::cos(dra));
+
+    } // endif: we were sufficiently close to PSF
+
+    // Apply deadtime correction
+    double deadc = obs.deadc(source.time());
+    irf         *= deadc;
+
+    // Set gradients (parameters are in degrees)
+    GModelPar& ra  = (*model)[0];
+    GModelPar& dec = (*model)[1];
+    if (ra.isfree() && ra.hasgrad()) {
+        ra.gradient(g_ra * deg2rad * ra.scale() * deadc);
+    }
+    if (dec.isfree() && dec.hasgrad()) {
+        dec.gradient(g_dec * deg2rad * dec.scale() * deadc);
+    }
+
+    // Return IRF value
+    return irf;
+}
+
+
+/***********************************************************************//**
+ * @brief Return value of radial source instrument response function and
+ *        optionally the shape parameter gradients
+ *
+ * @param[in] event Observed event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @param[in] grad Compute shape parameter gradients?
+ *
+ * @exception GCTAException::bad_observation_type
+ *            Specified observation is not a CTA observations.
+ * @exception GCTAException::no_pointing
+ *            No valid CTA pointing found.
+ * @exception GCTAException::bad_instdir_type
+ *            Instrument direction is not a valid CTA instrument direction.
+ * @exception GCTAException::bad_model_type
+ *            Model is not a radial model.
+ *
+ * Computes the radial source instrument response function (see
+ * irf_extended()). If @p grad is true, the gradients with respect to the
+ * Gaussian width, the disk radius, and the shell radius and width are
+ * set for all free parameters. The derivative of the model is integrated
+ * using the same zenith angle kernel as the IRF. For the disk and the
+ * shell, the edges of the profile lead to an additional term that is
+ * computed from the azimuthally integrated IRF at the edge. The gradients
+ * include the deadtime correction, the IRF value does not.
+ ***************************************************************************/
+double GCTAResponse::irf_radial(const GEvent&       event,
+                                const GSource&      source,
+                                const GObservation& obs,
+                                const bool&         grad) const
+{
+    // Get pointer on CTA observation
+    const GCTAObservation* ctaobs = dynamic_cast<const GCTAObservation*>(&obs);
+    if (ctaobs == NULL) {
+        throw GCTAException::bad_observation_type(G_IRF_RADIAL);
+    }
+
+    // Get pointer on CTA pointing
+    const GCTAPointing *pnt = ctaobs->pointing();
+    if (pnt == NULL) {
+        throw GCTAException::no_pointing(G_IRF_RADIAL);
+    }
+
+    // Get pointer on CTA instrument direction
+    const GCTAInstDir* dir = dynamic_cast<const GCTAInstDir*>(&(event.dir()));
+    if (dir == NULL) {
+        throw GCTAException::bad_instdir_type(G_IRF_RADIAL);
+    }
+
+    // Get pointer on radial model
+    const GModelRadial* model = dynamic_cast<const GModelRadial*>(source.model());
+    if (model == NULL) {
+        throw GCTAException::bad_model_type(G_IRF_RADIAL);
+    }
+
+    // Get event attributes
+    const GSkyDir& obsDir = dir->dir();
+    const GEnergy& obsEng = event.energy();
+
+    // Get source attributes
+    const GSkyDir& centre = model->dir();
+    const GEnergy& srcEng = source.energy();
+
+    // Get pointing direction zenith angle and azimuth [radians]
+    double zenith  = pnt->zenith();
+    double azimuth = pnt->azimuth();
+
+    // Determine angular distance between measured photon direction and model
+    // centre [radians]
+    double zeta = centre.dist(dir->dir());
+
+    // Determine angular distance between measured photon direction and
+    // pointing direction [radians]
+    double eta = pnt->dir().dist(dir->dir());
+
+    // Determine angular distance between model centre and pointing direction
+    // [radians]
+    double lambda = centre.dist(pnt->dir());
+
+    // Compute azimuth angle of pointing in model system [radians]
+    // Will be comprised in interval [0,pi]
+    double omega0 = 0.0;
+    double denom  = std::sin(lambda) * std::sin(zeta);
+    if (denom != 0.0) {
+        double arg = (std::cos(eta) - std::cos(lambda) * std::cos(zeta))/denom;
+        omega0     = arccos(arg);
+    }
+
+    // Get log10(E/TeV) of true and measured photon energies
+    double srcLogEng = srcEng.log10TeV();
+    double obsLogEng = obsEng.log10TeV();
+
+    // Assign the observed theta angle (eta) as the true theta angle
+    // between the source and the pointing directions. This is a (not
+    // too bad) approximation which helps to speed up computations.
+    // If we want to do this correctly, however, we would need to move
+    // the psf_dummy_sigma down to the integration kernel, and we would
+    // need to make sure that psf_delta_max really gives the absolute
+    // maximum (this is certainly less critical)
+    double theta = eta;
+    double phi   = 0.0; //TODO: Implement Phi dependence
+
+    // Get maximum PSF and source radius in radians.
+    double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
+    double src_max   = model->theta_max();
+
+    // Set radial model zenith angle range
+    double rho_min = (zeta > delta_max) ? zeta - delta_max : 0.0;
+    double rho_max = zeta + delta_max;
+    if (rho_max > src_max) {
+        rho_max = src_max;
+    }
+
+    // Initialise IRF value and shape parameter gradients (per radian)
+    double irf     = 0.0;
+    double g_shape = 0.0;  // Gaussian sigma, disk or shell radius
+    double g_width = 0.0;  // Shell width
+
+    // Perform zenith angle integration if interval is valid
+    if (rho_max > rho_min) {
+
+        // Setup integration kernel
+        cta_irf_radial_kern_rho integrand(this,
+                                          model,
+                                          zenith,
+                                          azimuth,
+                                          srcLogEng,
+                                          obsLogEng,
+                                          zeta,
+                                          lambda,
+                                          omega0,
+                                          delta_max);
+
+        // Integrate over zenith angle
+        GIntegral integral(&integrand);
+        integral.eps(m_eps);
+        integral.method(m_integration);
+        irf = integral.integrate(rho_min, rho_max);
+
+        // Compile option: Check for NaN/Inf
+        #if defined(G_NAN_CHECK)
+        if (isnotanumber(irf) || isinfinite(irf)) {
+            std::cout << "*** ERROR: GCTAResponse::irf_radial:";
+            std::cout << " NaN/Inf encountered";
+            std::cout << " (irf=" << irf;
+            std::cout << ", rho_min=" << rho_min;
+            std::cout << ", rho_max=" << rho_max;
+            std::cout << ", omega0=" << omega0 << ")";
+            std::cout << std::endl;
+        }
+        #endif
+
+        // Compute shape parameter gradients
+        if (grad) {
+
+            // Gaussian: dM/dsigma = M * (rho^2/sigma^3 - 2/sigma). The
+            // boundary term due to the truncation of the model at
+            // theta_max() is neglected.
+            const GModelRadialGauss* gauss =
+                  dynamic_cast<const GModelRadialGauss*>(model);
+            if (gauss != NULL && (*gauss)["Sigma"].isfree()) {
+                double sigma = gauss->sigma() * deg2rad;
+                if (sigma > 0.0) {
+                    cta_irf_radial_kern_rho2 moment(&integrand);
+                    GIntegral integral2(&moment);
+                    integral2.eps(m_eps);
+                    integral2.method(m_integration);
+                    double j2 = integral2.integrate(rho_min, rho_max);
+                    g_shape   = j2 / (sigma*sigma*sigma) - 2.0 * irf / sigma;
+                }
+            }
+
+            // Disk: derivative of the normalisation plus the edge term
+            const GModelRadialDisk* disk =
+                  dynamic_cast<const GModelRadialDisk*>(model);
+            if (disk != NULL && (*disk)["Radius"].isfree()) {
+                double radius = disk->radius() * deg2rad;
+                if (radius > 0.0) {
+                    double norm = model->eval(0.0);
+                    g_shape     = -std::sin(radius) / (1.0 - std::cos(radius)) *
+                                  irf + norm * integrand.azimuthal(radius);
+                }
+            }
+
+            // Shell: derivatives of the normalisation and of the profile
+            // with respect to the inner and outer shell radius
+            const GModelRadialShell* shell =
+                  dynamic_cast<const GModelRadialShell*>(model);
+            if (shell != NULL && ((*shell)["Radius"].isfree() ||
+                                  (*shell)["Width"].isfree())) {
+
+                // Get shell radii (radians) and profile normalisation
+                bool   small_angle = shell->small_angle();
+                double theta_in    = shell->radius() * deg2rad;
+                double theta_out   = (shell->radius() + shell->width()) * deg2rad;
+                double denom       = (small_angle)
+                                     ? theta_out - theta_in
+                                     : std::sin(theta_out) - std::sin(theta_in);
+
+                // Continue only if shell is valid
+                if (denom > 0.0) {
+
+                    // Compute normalisation
+                    double norm = model->eval(0.0) / denom;
+
+                    // Loop over outer and inner edge
+                    double edge[2]   = {theta_out, theta_in};
+                    double g_edge[2] = {0.0, 0.0};
+                    for (int k = 0; k < 2; ++k) {
+
+                        // Get edge radius
+                        double r = edge[k];
+                        if (r <= 0.0) {
+                            continue;
+                        }
+
+                        // Compute derivative of shell volume (see
+                        // GModelRadialShell::f3)
+                        double dvolume;
+                        if (small_angle) {
+                            dvolume = twopi * r * r;
+                        }
+                        else {
+                            double sin_r = std::sin(r);
+                            dvolume      = pi * sin_r * std::cos(r) *
+                                           std::log((1.0+sin_r)/(1.0-sin_r));
+                        }
+
+                        // Compute integral over profile derivative
+                        double integral_edge = 0.0;
+                        double rho_up        = (zeta + delta_max < r)
+                                               ? zeta + delta_max : r;
+                        if (rho_up > rho_min) {
+                            double arg_min = (small_angle)
+                                             ? rho_min / r
+                                             : std::sin(rho_min) / std::sin(r);
+                            double arg_max = (small_angle)
+                                             ? rho_up / r
+                                             : std::sin(rho_up) / std::sin(r);
+                            if (arg_min > 1.0) arg_min = 1.0;
+                            if (arg_max > 1.0) arg_max = 1.0;
+                            cta_irf_radial_kern_edge kern(&integrand, r, small_angle);
+                            GIntegral integral_e(&kern);
+                            integral_e.eps(m_eps);
+                            integral_e.method(m_integration);
+                            integral_edge = integral_e.integrate(std::asin(arg_min),
+                                                                 std::asin(arg_max));
+                        }
+
+                        // Set gradient with respect to edge radius
+                        g_edge[k] = norm * (integral_edge - dvolume * irf);
+
+                    } // endfor: looped over edges
+
+                    // Set shell gradients (the inner edge enters with an
+                    // opposite sign)
+                    g_shape = g_edge[0] - g_edge[1];
+                    g_width = g_edge[0];
+
+                } // endif: shell was valid
+
+            } // endif: model was a shell with free parameters
+
+        } // endif: gradients were requested
+
+    } // endif: integration interval was valid
+
+    // Set shape parameter gradients
+    if (grad) {
+
+        // Get non-const pointer on model (circumvent const correctness)
+        GModelSpatial* ptr = const_cast<GModelSpatial*>(source.model());
+
+        // Set gradient factor (includes deadtime correction)
+        double fact = deg2rad * obs.deadc(source.time());
+
+        // Set gradients
+        for (int i = 2; i < ptr->size(); ++i) {
+            GModelPar& par = (*ptr)[i];
+            if (par.isfree() && par.hasgrad()) {
+                double g = (par.name() == "Width") ? g_width : g_shape;
+                par.gradient(g * fact * par.scale());
+            }
+        }
+
+    } // endif: gradients were requested
+
+    // Compile option: Show integration results
+    #if defined(G_DEBUG_IRF_RADIAL)
+    std::cout << "GCTAResponse::irf_radial:";
+    std::cout << " rho_min=" << rho_min;
+    std::cout << " rho_max=" << rho_max;
+    std::cout << " irf=" << irf << std::endl;
+    #endif
+
+    // Return IRF value
+    return irf;
+}
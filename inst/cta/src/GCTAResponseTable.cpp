@@ -215,13 +215,15 @@ std::vector<double> GCTAResponseTable::operator()(const double& arg) const
     // Initialise result vector
     std::vector<double> result(num);
     
-    // Set indices and weighting factors for interpolation
-    update(arg);
+    // Get indices and weighting factors for interpolation
+    int    inx[2];
+    double wgt[2];
+    update(arg, inx, wgt);
 
     // Perform 1D interpolation
     for (int i = 0; i < num; ++i) {
-        result[i] = m_wgt_left  * m_pars[i][m_inx_left] +
-                    m_wgt_right * m_pars[i][m_inx_right];
+        result[i] = wgt[0] * m_pars[i][inx[0]] +
+                    wgt[1] * m_pars[i][inx[1]];
     }
     
     // Return result vector
@@ -263,15 +265,17 @@ std::vector<double> GCTAResponseTable::operator()(const double& arg1,
     // Initialise result vector
     std::vector<double> result(num);
 
-    // Set indices and weighting factors for interpolation
-    update(arg1, arg2);
+    // Get indices and weighting factors for interpolation
+    int    inx[4];
+    double wgt[4];
+    update(arg1, arg2, inx, wgt);
 
     // Perform 2D interpolation
     for (int i = 0; i < num; ++i) {
-        result[i] = m_wgt1 * m_pars[i][m_inx1] +
-                    m_wgt2 * m_pars[i][m_inx2] +
-                    m_wgt3 * m_pars[i][m_inx3] +
-                    m_wgt4 * m_pars[i][m_inx4];
+        result[i] = wgt[0] * m_pars[i][inx[0]] +
+                    wgt[1] * m_pars[i][inx[1]] +
+                    wgt[2] * m_pars[i][inx[2]] +
+                    wgt[3] * m_pars[i][inx[3]];
     }
     
     // Return result vector
@@ -306,12 +310,14 @@ double GCTAResponseTable::operator()(const int& index, const double& arg) const
     }
     #endif
     
-    // Set indices and weighting factors for interpolation
-    update(arg);
+    // Get indices and weighting factors for interpolation
+    int    inx[2];
+    double wgt[2];
+    update(arg, inx, wgt);
 
     // Perform 1D interpolation
-    double result = m_wgt_left  * m_pars[index][m_inx_left] +
-                    m_wgt_right * m_pars[index][m_inx_right];
+    double result = wgt[0] * m_pars[index][inx[0]] +
+                    wgt[1] * m_pars[index][inx[1]];
     
     // Return result
     return result;
@@ -347,14 +353,16 @@ double GCTAResponseTable::operator()(const int& index, const double& arg1,
     }
     #endif
 
-    // Set indices and weighting factors for interpolation
-    update(arg1, arg2);
+    // Get indices and weighting factors for interpolation
+    int    inx[4];
+    double wgt[4];
+    update(arg1, arg2, inx, wgt);
 
     // Perform 2D interpolation
-    double result = m_wgt1 * m_pars[index][m_inx1] +
-                    m_wgt2 * m_pars[index][m_inx2] +
-                    m_wgt3 * m_pars[index][m_inx3] +
-                    m_wgt4 * m_pars[index][m_inx4];
+    double result = wgt[0] * m_pars[index][inx[0]] +
+                    wgt[1] * m_pars[index][inx[1]] +
+                    wgt[2] * m_pars[index][inx[2]] +
+                    wgt[3] * m_pars[index][inx[3]];
     
     // Return result
     return result;
@@ -836,20 +844,6 @@ void GCTAResponseTable::init_members(void)
     m_axis_nodes.clear();
     m_pars.clear();
 
-    // Initialise cache
-    m_inx_left  = 0;
-    m_inx_right = 0;
-    m_wgt_left  = 0.0;
-    m_wgt_right = 0.0;
-    m_inx1      = 0;
-    m_inx2      = 0;
-    m_inx3      = 0;
-    m_inx4      = 0;
-    m_wgt1      = 0.0;
-    m_wgt2      = 0.0;
-    m_wgt3      = 0.0;
-    m_wgt4      = 0.0;
-
     // Return
     return;
 }
@@ -876,20 +870,6 @@ void GCTAResponseTable::copy_members(const GCTAResponseTable& table)
     m_axis_nodes  = table.m_axis_nodes;
     m_pars        = table.m_pars;
 
-    // Copy cache
-    m_inx_left  = table.m_inx_left;
-    m_inx_right = table.m_inx_right;
-    m_wgt_left  = table.m_wgt_left;
-    m_wgt_right = table.m_wgt_right;
-    m_inx1      = table.m_inx1;
-    m_inx2      = table.m_inx2;
-    m_inx3      = table.m_inx3;
-    m_inx4      = table.m_inx4;
-    m_wgt1      = table.m_wgt1;
-    m_wgt2      = table.m_wgt2;
-    m_wgt3      = table.m_wgt3;
-    m_wgt4      = table.m_wgt4;
-
     // Return
     return;
 }
@@ -1210,77 +1190,76 @@ void GCTAResponseTable::read_pars(const GFitsTable* hdu)
 
 
 /***********************************************************************//**
- * @brief Update 1D cache
+ * @brief Compute 1D interpolation indices and weights
  *
  * @param[in] arg Argument.
+ * @param[out] inx Indices of the 2 data values [2].
+ * @param[out] wgt Weights of the 2 data values [2].
  *
- * Updates the 1D interpolation cache. The interpolation cache is composed
- * of two indices and weights that define 2 data values of the 2D table
- * that are used for linear interpolation.
+ * Computes the two indices and weights that define the 2 data values of
+ * the 1D table that are used for linear interpolation. The indices and
+ * weights are returned in the caller provided arrays, hence the method
+ * does not modify the table.
  *
  * @todo Write down formula
- *
- * @todo Makes GNodeArray::set_value method const and use mutable members
  ***************************************************************************/
-void GCTAResponseTable::update(const double& arg) const
+void GCTAResponseTable::update(const double& arg, int* inx, double* wgt) const
 {
-    // Get pointer to node array (circumvent const correctness)
-    GNodeArray* nodes = const_cast<GNodeArray*>(&(m_axis_nodes[0]));
-
-    // Set value for node array
-    nodes->set_value(arg);
+    // Get indices and weighting factors for interpolation
+    m_axis_nodes[0].set_value(arg, inx[0], inx[1], wgt[0], wgt[1]);
 
-    // Set indices and weighting factors for interpolation
-    m_inx_left  = nodes->inx_left();
-    m_inx_right = nodes->inx_right();
-    m_wgt_left  = nodes->wgt_left();
-    m_wgt_right = nodes->wgt_right();
-    
     // Return
     return;
 }
 
 
 /***********************************************************************//**
- * @brief Update 2D cache
+ * @brief Compute 2D interpolation indices and weights
  *
  * @param[in] arg1 Argument for first axis.
  * @param[in] arg2 Argument for second axis.
+ * @param[out] inx Indices of the 4 data values [4].
+ * @param[out] wgt Weights of the 4 data values [4].
  *
- * Updates the 2D interpolation cache. The interpolation cache is composed
- * of four indices and weights that define 4 data values of the 2D table
- * that are used for bilinear interpolation.
+ * Computes the four indices and weights that define the 4 data values of
+ * the 2D table that are used for bilinear interpolation. The indices are
+ * ordered upper left, lower left, upper right and lower right. The indices
+ * and weights are returned in the caller provided arrays, hence the method
+ * does not modify the table.
  *
  * @todo Write down formula
- *
- * @todo Makes GNodeArray::set_value method const and use mutable members
  ***************************************************************************/
-void GCTAResponseTable::update(const double& arg1, const double& arg2) const
+void GCTAResponseTable::update(const double& arg1, const double& arg2,
+                               int* inx, double* wgt) const
 {
-    // Get pointers to node arrays (circumvent const correctness)
-    GNodeArray* nodes1 = const_cast<GNodeArray*>(&(m_axis_nodes[0]));
-    GNodeArray* nodes2 = const_cast<GNodeArray*>(&(m_axis_nodes[1]));
-
-    // Set values for node arrays
-    nodes1->set_value(arg1);
-    nodes2->set_value(arg2);
+    // Get indices and weighting factors for both axes
+    int    inx1_left;
+    int    inx1_right;
+    double wgt1_left;
+    double wgt1_right;
+    int    inx2_left;
+    int    inx2_right;
+    double wgt2_left;
+    double wgt2_right;
+    m_axis_nodes[0].set_value(arg1, inx1_left, inx1_right, wgt1_left, wgt1_right);
+    m_axis_nodes[1].set_value(arg2, inx2_left, inx2_right, wgt2_left, wgt2_right);
 
     // Compute offsets
     int size1        = axis(0);
-    int offset_left  = nodes2->inx_left()  * size1;
-    int offset_right = nodes2->inx_right() * size1;
+    int offset_left  = inx2_left  * size1;
+    int offset_right = inx2_right * size1;
 
     // Set indices for bi-linear interpolation
-    m_inx1 = nodes1->inx_left()  + offset_left;
-    m_inx2 = nodes1->inx_left()  + offset_right;
-    m_inx3 = nodes1->inx_right() + offset_left;
-    m_inx4 = nodes1->inx_right() + offset_right;
+    inx[0] = inx1_left  + offset_left;
+    inx[1] = inx1_left  + offset_right;
+    inx[2] = inx1_right + offset_left;
+    inx[3] = inx1_right + offset_right;
 
     // Set weighting factors for bi-linear interpolation
-    m_wgt1 = nodes1->wgt_left()  * nodes2->wgt_left();
-    m_wgt2 = nodes1->wgt_left()  * nodes2->wgt_right();
-    m_wgt3 = nodes1->wgt_right() * nodes2->wgt_left();
-    m_wgt4 = nodes1->wgt_right() * nodes2->wgt_right();
+    wgt[0] = wgt1_left  * wgt2_left;
+    wgt[1] = wgt1_left  * wgt2_right;
+    wgt[2] = wgt1_right * wgt2_left;
+    wgt[3] = wgt1_right * wgt2_right;
     
     // Return
     return;
@@ -126,6 +126,52 @@ double cta_npsf_kern_rad_azsym::eval(double delta)
  * \f$IRF(\rho, \omega)\f$ is the instrument response function.
  ***************************************************************************/
 double cta_irf_radial_kern_rho::eval(double rho)
+{
+    // Initialise result
+    double irf = 0.0;
+
+    // Evaluate sky model M(rho)
+    double model = m_model->eval(rho);
+
+    // Continue only if model is non-zero
+    if (model != 0.0) {
+
+        // Multiply model with azimuthally integrated IRF
+        irf = model * azimuthal(rho);
+
+        // Compile option: Check for NaN/Inf
+        #if defined(G_NAN_CHECK)
+        if (isnotanumber(irf) || isinfinite(irf)) {
+            std::cout << "*** ERROR: cta_irf_radial_kern_rho";
+            std::cout << "(rho=" << rho << "):";
+            std::cout << " NaN/Inf encountered";
+            std::cout << " (irf=" << irf;
+            std::cout << ", model=" << model << ")";
+            std::cout << std::endl;
+        }
+        #endif
+
+    } // endif: model was non-zero
+
+    // Return result
+    return irf;
+}
+
+
+/***********************************************************************//**
+ * @brief Azimuthal integral of IRF for radial model zenith angle
+ *        integration
+ *
+ * @param[in] rho Zenith angle with respect to model centre [radians].
+ *
+ * Computes
+ * \f[A(\rho) = \sin \rho \int_{\omega_{\rm min}}^{\omega_{\rm max}}
+ *              IRF(\rho, \omega) d\omega\f],
+ * i.e. the zenith angle kernel without the source model, so that
+ * \f$K(\rho) = M(\rho) A(\rho)\f$. The method is also used for the
+ * computation of the spatial parameter gradients.
+ ***************************************************************************/
+double cta_irf_radial_kern_rho::azimuthal(double rho)
 {
     // Compute half length of arc that lies within PSF validity circle
     // (in radians)
@@ -146,9 +192,6 @@ double cta_irf_radial_kern_rho::eval(double rho)
         double omega_min = -domega;
         double omega_max = +domega;
 
-        // Evaluate sky model M(rho)
-        double model = m_model->eval(rho);
-
         // Precompute cosine and sine terms for azimuthal integration
         double cos_rho = std::cos(rho);
         double sin_rho = std::sin(rho);
@@ -172,24 +215,9 @@ double cta_irf_radial_kern_rho::eval(double rho)
                                             cos_ph,
                                             sin_ph);
 
-        // Integrate over phi
-        GIntegral integral(&integrand);
-        integral.eps(m_rsp->eps());
-        irf = integral.romb(omega_min, omega_max) * model * sin_rho;
-
-        // Compile option: Check for NaN/Inf
-        #if defined(G_NAN_CHECK)
-        if (isnotanumber(irf) || isinfinite(irf)) {
-            std::cout << "*** ERROR: cta_irf_radial_kern_rho";
-            std::cout << "(rho=" << rho << "):";
-            std::cout << " NaN/Inf encountered";
-            std::cout << " (irf=" << irf;
-            std::cout << ", domega=" << domega;
-            std::cout << ", model=" << model;
-            std::cout << ", sin_rho=" << sin_rho << ")";
-            std::cout << std::endl;
-        }
-        #endif
+        // Integrate over omega using the kernel's integral workspace
+        m_integral.integrand(&integrand);
+        irf = m_integral.integrate(omega_min, omega_max) * sin_rho;
 
     } // endif: arc length was positive
 
@@ -264,6 +292,47 @@ double cta_irf_radial_kern_omega::eval(double omega)
 }
 
 
+/***********************************************************************//**
+ * @brief Kernel for radial profile edge derivative integration of IRF
+ *
+ * @param[in] t Substitution variable (radians).
+ *
+ * This method evaluates the kernel for the integral
+ * \f[E(r) = \int_{\rho_{\rm min}}^{\rho_{\rm max}}
+ *    \frac{\partial S(\rho, r)}{\partial r} A(\rho) d\rho\f]
+ * where \f$S(\rho, r)=\sqrt{r^2-\rho^2}\f$ (or
+ * \f$\sqrt{\sin^2 r - \sin^2 \rho}\f$ in the general case) is the
+ * profile of a uniformly emitting sphere of radius \f$r\f$ (see
+ * GModelRadialShell), \f$\rho_{\rm max} \le r\f$, and \f$A(\rho)\f$ is
+ * the azimuthally integrated IRF (see cta_irf_radial_kern_rho::azimuthal).
+ *
+ * The derivative of the profile diverges for \f$\rho \to r\f$, which is
+ * removed by the substitution \f$\rho = r \sin t\f$ (or
+ * \f$\sin \rho = \sin r \sin t\f$ in the general case), leading to the
+ * kernels \f$r A(\rho)\f$ and \f$\sin r \cos r A(\rho) / \cos \rho\f$,
+ * respectively.
+ ***************************************************************************/
+double cta_irf_radial_kern_edge::eval(double t)
+{
+    // Initialise result
+    double value = 0.0;
+
+    // Compute kernel
+    if (m_small_angle) {
+        double rho = m_radius * std::sin(t);
+        value      = m_radius * m_kern->azimuthal(rho);
+    }
+    else {
+        double rho = std::asin(m_sin_radius * std::sin(t));
+        value      = m_sin_radius * m_cos_radius * m_kern->azimuthal(rho) /
+                     std::cos(rho);
+    }
+
+    // Return result
+    return value;
+}
+
+
 /***********************************************************************//**
  * @brief Kernel for zenith angle Npred integration or radial model
  *
@@ -447,10 +516,9 @@ double cta_irf_diffuse_kern_theta::eval(double theta)
                                                sin_ph,
                                                cos_ph);
 
-            // Integrate over phi
-            GIntegral integral(&integrand);
-            integral.eps(1.0e-2);
-            irf = integral.romb(0.0, twopi) * psf * sin_theta;
+            // Integrate over phi using the kernel's integral workspace
+            m_integral.integrand(&integrand);
+            irf = m_integral.integrate(0.0, twopi) * psf * sin_theta;
 
             // Compile option: Check for NaN/Inf
             #if defined(G_NAN_CHECK)
@@ -36,6 +36,7 @@
 #include "GTime.hpp"
 #include "GModelRadial.hpp"
 #include "GIntegrand.hpp"
+#include "GIntegral.hpp"
 
 /* __ Type definitions ___________________________________________________ */
 
@@ -115,8 +116,11 @@ public:
                             m_sin_lambda(std::sin(lambda)),
                             m_omega0(omega0),
                             m_delta_max(delta_max),
-                            m_cos_delta_max(std::cos(delta_max)) { }
+                            m_cos_delta_max(std::cos(delta_max)) {
+                            m_integral.eps(rsp->eps());
+                            m_integral.method(rsp->integration()); }
     double eval(double rho);
+    double azimuthal(double rho);
 protected:
     const GCTAResponse* m_rsp;           //!< Pointer to CTA response
     const GModelRadial* m_model;         //!< Pointer to radial model
@@ -133,6 +137,7 @@ protected:
     double              m_omega0;        //!< Azimuth of pointing in model system
     double              m_delta_max;     //!< Maximum PSF radius
     double              m_cos_delta_max; //!< Cosine of maximum PSF radius
+    GIntegral           m_integral;      //!< Azimuthal integral (workspace)
 };
 
 
@@ -187,6 +192,47 @@ protected:
 };
 
 
+/***********************************************************************//**
+ * @class cta_irf_radial_kern_rho2
+ *
+ * @brief Kernel for second moment of radial model zenith angle integration
+ *        of IRF
+ ***************************************************************************/
+class cta_irf_radial_kern_rho2 : public GIntegrand {
+public:
+    cta_irf_radial_kern_rho2(cta_irf_radial_kern_rho* kern) :
+                             m_kern(kern) { }
+    double eval(double rho) { return (rho * rho * m_kern->eval(rho)); }
+protected:
+    cta_irf_radial_kern_rho* m_kern;     //!< Zenith angle integration kernel
+};
+
+
+/***********************************************************************//**
+ * @class cta_irf_radial_kern_edge
+ *
+ * @brief Kernel for radial profile edge derivative integration of IRF
+ ***************************************************************************/
+class cta_irf_radial_kern_edge : public GIntegrand {
+public:
+    cta_irf_radial_kern_edge(cta_irf_radial_kern_rho* kern,
+                             double                   radius,
+                             bool                     small_angle) :
+                             m_kern(kern),
+                             m_radius(radius),
+                             m_sin_radius(std::sin(radius)),
+                             m_cos_radius(std::cos(radius)),
+                             m_small_angle(small_angle) { }
+    double eval(double t);
+protected:
+    cta_irf_radial_kern_rho* m_kern;        //!< Zenith angle integration kernel
+    double                   m_radius;      //!< Edge radius
+    double                   m_sin_radius;  //!< Sine of edge radius
+    double                   m_cos_radius;  //!< Cosine of edge radius
+    bool                     m_small_angle; //!< Use small angle approximation
+};
+
+
 /***********************************************************************//**
  * @class cta_npred_radial_kern_theta
  *
@@ -294,7 +340,9 @@ public:
                                m_obsLogEng(obsLogEng),
                                m_rot(rot),
                                m_sin_eta(std::sin(eta)),
-                               m_cos_eta(std::cos(eta)) { }
+                               m_cos_eta(std::cos(eta)) {
+                               m_integral.eps(1.0e-2);
+                               m_integral.method(rsp->integration()); }
     double eval(double theta);
 protected:
     const GCTAResponse*  m_rsp;        //!< Pointer to CTA response
@@ -312,6 +360,7 @@ protected:
     double               m_cos_eta;    //!< Cosine of angular distance between
                                        //   observed photon direction and
                                        //   camera centre
+    GIntegral            m_integral;   //!< Azimuthal integral (workspace)
 };
 
 
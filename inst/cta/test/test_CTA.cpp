@@ -31,7 +31,12 @@
 #include <stdlib.h>
 #include <iostream>
 #include <unistd.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "GCTALib.hpp"
+#include "GCTAAeffPerfTable.hpp"
+#include "GCTAPsfPerfTable.hpp"
 #include "GTools.hpp"
 #include "test_CTA.hpp"
 
@@ -66,6 +71,8 @@ void TestGCTAResponse::set(void)
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_npsf), "Test integrated PSF");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_irf_diffuse), "Test diffuse IRF");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_npred_diffuse), "Test diffuse IRF integration");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_irf_gradients), "Test IRF spatial gradients");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_irf_integration), "Test IRF integration methods");
 
     // Return
     return;
@@ -82,7 +89,10 @@ void TestGCTAObservation::set(void)
 
     // Append tests to test suite
     append(static_cast<pfunction>(&TestGCTAObservation::test_unbinned_obs), "Test unbinned observations");
+    append(static_cast<pfunction>(&TestGCTAObservation::test_event_list), "Test event list");
+    append(static_cast<pfunction>(&TestGCTAObservation::test_event_list_selection), "Test event list selection");
     append(static_cast<pfunction>(&TestGCTAObservation::test_binned_obs), "Test binned observation");
+    append(static_cast<pfunction>(&TestGCTAObservation::test_simulation_threads), "Test simulation with several threads");
 
     // Return
     return;
@@ -100,6 +110,8 @@ void TestGCTAOptimize::set(void)
     // Append tests to test suite
     append(static_cast<pfunction>(&TestGCTAOptimize::test_unbinned_optimizer), "Test unbinned optimizer");
     append(static_cast<pfunction>(&TestGCTAOptimize::test_binned_optimizer), "Test binned optimizer");
+    append(static_cast<pfunction>(&TestGCTAOptimize::test_event_parallel), "Test event-level parallelism");
+    append(static_cast<pfunction>(&TestGCTAOptimize::test_source_scan), "Test parallel source scan");
 
     // Return
     return;
@@ -369,6 +381,159 @@ void TestGCTAResponse::test_response_npred_diffuse(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test CTA IRF spatial parameter gradients
+ *
+ * Compares the spatial parameter gradients returned by
+ * GCTAResponse::irf_gradients for a point source, a Gaussian, a disk and
+ * a shell model to numerical derivatives of GCTAResponse::irf. The
+ * response is set up directly from the performance table.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_irf_gradients(void)
+{
+    // Setup CTA response
+    const std::string filename = cta_caldb+"/"+cta_irf+".dat";
+    GCTAResponse rsp;
+    rsp.aeff(new GCTAAeffPerfTable(filename));
+    rsp.psf(new GCTAPsfPerfTable(filename));
+    rsp.eps(1.0e-7);
+    const GResponse& response = rsp;
+
+    // Setup observation
+    GSkyDir pntdir;
+    pntdir.radec_deg(83.63, 22.01);
+    GCTAObservation obs;
+    obs.pointing(GCTAPointing(pntdir));
+    obs.deadc(0.95);
+
+    // Setup event
+    GCTAInstDir   dir;
+    GEnergy       energy;
+    GCTAEventAtom event;
+    dir.radec_deg(83.85, 22.12);
+    energy.TeV(1.0);
+    event.dir(dir);
+    event.energy(energy);
+
+    // Setup spatial models
+    GSkyDir centre;
+    centre.radec_deg(83.75, 22.05);
+    std::vector<GModelSpatial*> models;
+    models.push_back(new GModelSpatialPtsrc(centre));
+    models.push_back(new GModelRadialGauss(centre, 0.15));
+    models.push_back(new GModelRadialDisk(centre, 0.2));
+    models.push_back(new GModelRadialShell(centre, 0.1, 0.1));
+    models.push_back(new GModelRadialShell(centre, 0.1, 0.1, false));
+
+    // Loop over models
+    for (int k = 0; k < (int)models.size(); ++k) {
+
+        // Setup source. As the source holds a copy of the spatial model,
+        // parameters are manipulated through the source.
+        GSource        source("Test", *(models[k]), energy, GTime());
+        GModelSpatial& model = const_cast<GModelSpatial&>(*source.model());
+        for (int i = 0; i < model.size(); ++i) {
+            model[i].free();
+        }
+
+        // Compute IRF and gradients
+        double irf  = response.irf(event, source, obs);
+        double irfg = rsp.irf_gradients(event, source, obs);
+        test_value(irfg, irf, 1.0e-6*irf, "IRF value");
+
+        // Compare gradients to numerical derivatives
+        for (int i = 0; i < model.size(); ++i) {
+            GModelPar& par = model[i];
+            if (!par.isfree() || !par.hasgrad()) {
+                continue;
+            }
+            double gradient = par.gradient();
+            double value    = par.value();
+            double h        = 1.0e-3;
+            par.value(value + h);
+            double irf_p = response.irf(event, source, obs);
+            par.value(value - h);
+            double irf_m = response.irf(event, source, obs);
+            par.value(value);
+            double numeric = (irf_p - irf_m) / (2.0 * h);
+            test_value(gradient, numeric, 2.0e-3*std::abs(numeric)+1.0e-6*irf,
+                       "IRF gradient for \""+par.name()+"\" of model "+
+                       str(k));
+        }
+
+    } // endfor: looped over models
+
+    // Free models
+    for (int k = 0; k < (int)models.size(); ++k) {
+        delete models[k];
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test CTA IRF integration methods
+ *
+ * Verifies that the radial model IRF computed using Gauss-Kronrod
+ * integration agrees with the IRF computed using Romberg integration.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_irf_integration(void)
+{
+    // Setup CTA response
+    const std::string filename = cta_caldb+"/"+cta_irf+".dat";
+    GCTAResponse rsp;
+    rsp.aeff(new GCTAAeffPerfTable(filename));
+    rsp.psf(new GCTAPsfPerfTable(filename));
+    const GResponse& response = rsp;
+
+    // Setup observation
+    GSkyDir pntdir;
+    pntdir.radec_deg(83.63, 22.01);
+    GCTAObservation obs;
+    obs.pointing(GCTAPointing(pntdir));
+    obs.deadc(0.95);
+
+    // Setup event
+    GCTAInstDir   dir;
+    GEnergy       energy;
+    GCTAEventAtom event;
+    dir.radec_deg(83.85, 22.12);
+    energy.TeV(1.0);
+    event.dir(dir);
+    event.energy(energy);
+
+    // Setup source
+    GSkyDir centre;
+    centre.radec_deg(83.75, 22.05);
+    GSource source("Test", GModelRadialGauss(centre, 0.15), energy, GTime());
+
+    // Compute IRF using Romberg and Gauss-Kronrod integration
+    double irf_romb = response.irf(event, source, obs);
+    rsp.integration("gauss-kronrod");
+    test_assert(rsp.integration() == "GAUSS-KRONROD", "Integration method");
+    double irf_gk = response.irf(event, source, obs);
+    test_value(irf_gk, irf_romb, 1.0e-4*irf_romb, "Gauss-Kronrod IRF");
+
+    // Check invalid method
+    test_try("Invalid integration method");
+    try {
+        rsp.integration("simpson");
+        test_try_failure();
+    }
+    catch (GException::invalid_argument &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test CTA response handling
  ***************************************************************************/
@@ -458,6 +623,247 @@ void TestGCTAObservation::test_unbinned_obs(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test event list handling
+ *
+ * Verifies that events appended to a CTA event list are returned unchanged
+ * by the event access operator, also after copying the list and after
+ * replacing events.
+ ***************************************************************************/
+void TestGCTAObservation::test_event_list(void)
+{
+    // Build event list
+    GCTAEventList list;
+    list.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        GCTAInstDir dir;
+        GEnergy     energy;
+        GTime       time;
+        dir.radec_deg(83.6331+0.01*i, 22.0145-0.01*i);
+        energy.TeV(0.1+0.5*i);
+        time.met(10.0*i);
+        GCTAEventAtom event;
+        event.dir(dir);
+        event.energy(energy);
+        event.time(time);
+        list.append(event);
+    }
+    test_value(list.size(), 100, 1.0e-20, "Test event list size");
+
+    // Check events
+    const GCTAEventList copy = list;
+    for (int i = 0; i < 100; i += 33) {
+        const GCTAEventAtom* event = copy[i];
+        test_value(event->dir().ra_deg(), 83.6331+0.01*i, 1.0e-10, "Test event Right Ascension");
+        test_value(event->dir().dec_deg(), 22.0145-0.01*i, 1.0e-10, "Test event Declination");
+        test_value(event->energy().TeV(), 0.1+0.5*i, 1.0e-10, "Test event energy");
+        test_value(event->time().met(), 10.0*i, 1.0e-10, "Test event time");
+    }
+
+    // Replace event
+    GCTAEventAtom event = *(list[10]);
+    GEnergy       energy;
+    energy.TeV(42.0);
+    event.energy(energy);
+    list.set(10, event);
+    test_value(list[10]->energy().TeV(), 42.0, 1.0e-10, "Test event replacement");
+    test_value(copy[10]->energy().TeV(), 5.1, 1.0e-10, "Test event list copy");
+
+    // Modify events through the access operator. The modification of the
+    // last accessed event is not yet written back, but needs to be visible
+    // in the event list and its copies.
+    energy.TeV(43.0);
+    list[20]->energy(energy);
+    energy.TeV(44.0);
+    list[30]->energy(energy);
+    const GCTAEventList& ref      = list;
+    const GCTAEventList  modified = list;
+    GCTAEventAtom        atom;
+    list.event(30, atom);
+    test_value(ref[20]->energy().TeV(), 43.0, 1.0e-10, "Test written back event modification");
+    test_value(ref[30]->energy().TeV(), 44.0, 1.0e-10, "Test pending event modification");
+    test_value(atom.energy().TeV(), 44.0, 1.0e-10, "Test pending event modification access");
+    test_value(modified[30]->energy().TeV(), 44.0, 1.0e-10, "Test pending event modification copy");
+    test_value(list[31]->energy().TeV(), 0.1+0.5*31, 1.0e-10, "Test unmodified event");
+    test_value(ref[30]->energy().TeV(), 44.0, 1.0e-10, "Test written back event modification");
+
+    // Get events into caller-owned atoms from several threads
+    std::vector<double> energies(list.size(), 0.0);
+    #pragma omp parallel for
+    for (int i = 0; i < list.size(); ++i) {
+        GCTAEventAtom atom;
+        list.event(i, atom);
+        energies[i] = atom.energy().TeV();
+    }
+    test_value(energies[10], 42.0, 1.0e-10, "Test event access");
+    test_value(energies[99], 0.1+0.5*99, 1.0e-10, "Test event access");
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test selective reading of event list
+ ***************************************************************************/
+void TestGCTAObservation::test_event_list_selection(void)
+{
+    // Set selection
+    GEnergy  emin;
+    GEnergy  emax;
+    emin.TeV(0.5);
+    emax.TeV(5.0);
+    GEbounds ebounds;
+    ebounds.append(emin, emax);
+    GCTARoi     roi;
+    GCTAInstDir centre;
+    centre.radec_deg(83.6331, 22.0145);
+    roi.centre(centre);
+    roi.radius(1.0);
+
+    // Load all events and selected events
+    test_try("Load selected events");
+    try {
+        GCTAEventList all;
+        GCTAEventList selected;
+        all.load(cta_events);
+        selected.load(cta_events, ebounds, GGti(), roi);
+
+        // Count events that satisfy the selection
+        int num = 0;
+        for (int i = 0; i < all.size(); ++i) {
+            const GCTAEventAtom* event = all[i];
+            if (ebounds.contains(event->energy()) &&
+                centre.dist_deg(event->dir()) <= roi.radius()) {
+                num++;
+            }
+        }
+        test_value(selected.size(), num, "Test number of selected events");
+        test_assert(selected.size() < all.size(), "Test that events were rejected");
+
+        // Check selected events
+        for (int i = 0; i < selected.size(); ++i) {
+            const GCTAEventAtom* event = selected[i];
+            test_assert(ebounds.contains(event->energy()),
+                        "Test energy of selected event "+str(i));
+            test_assert(centre.dist_deg(event->dir()) <= roi.radius(),
+                        "Test direction of selected event "+str(i));
+        }
+
+        // Check selection information
+        test_value(selected.roi().radius(), 1.0, 1.0e-10, "Test ROI radius");
+        test_value(selected.ebounds().emin().TeV(), 0.5, 1.0e-10, "Test minimum energy");
+        test_value(selected.ebounds().emax().TeV(), 5.0, 1.0e-10, "Test maximum energy");
+
+        // Check that a selection wider than the file does not extend the
+        // energy boundaries and region of interest of the file
+        GEnergy  ewide;
+        ewide.TeV(500.0);
+        GEbounds ebounds_wide;
+        ebounds_wide.append(emin, ewide);
+        GCTARoi roi_wide = roi;
+        roi_wide.radius(20.0);
+        GCTAEventList wide;
+        wide.load(cta_events, ebounds_wide, GGti(), roi_wide);
+        test_value(wide.roi().radius(), 10.0, 1.0e-10, "Test ROI radius of wide selection");
+        test_value(wide.ebounds().emin().TeV(), 0.5, 1.0e-10, "Test minimum energy of wide selection");
+        test_value(wide.ebounds().emax().TeV(), 100.0, 1.0e-10, "Test maximum energy of wide selection");
+
+        // Replicate the events so that the event table spans several pages
+        // of the selective reader and write them into a file
+        GCTAEventList large;
+        while (large.size() <= 70000) {
+            large.extend(all);
+        }
+        large.save("test_cta_events_large.fits", true);
+
+        // Load selected events from that file and write them (including
+        // their auxiliary columns) into another file
+        GCTAEventList large_selected;
+        large_selected.load("test_cta_events_large.fits", ebounds, GGti(), roi);
+        large_selected.save("test_cta_events_selected.fits", true);
+
+        // Determine the table rows of the events that satisfy the selection
+        std::vector<int> rows;
+        for (int i = 0; i < large.size(); ++i) {
+            const GCTAEventAtom* event = large[i];
+            if (ebounds.contains(event->energy()) &&
+                centre.dist_deg(event->dir()) <= roi.radius()) {
+                rows.push_back(i);
+            }
+        }
+        test_value(large_selected.size(), (int)rows.size(),
+                   "Test number of selected events in large table");
+
+        // Check that the selected events carry the auxiliary information
+        // of their table rows
+        GFits fits_large("test_cta_events_large.fits");
+        GFits fits_selected("test_cta_events_selected.fits");
+        const GFitsTable* table_large    = fits_large.table("EVENTS");
+        const GFitsTable* table_selected = fits_selected.table("EVENTS");
+        const GFitsTableCol& eid_large    = (*table_large)["EVENT_ID"];
+        const GFitsTableCol& eid_selected = (*table_selected)["EVENT_ID"];
+        const GFitsTableCol& detx_large    = (*table_large)["DETX"];
+        const GFitsTableCol& detx_selected = (*table_selected)["DETX"];
+        int nbad = 0;
+        for (int i = 0; i < large_selected.size() && i < (int)rows.size(); ++i) {
+            if (eid_selected.integer(i) != eid_large.integer(rows[i]) ||
+                detx_selected.real(i)   != detx_large.real(rows[i])) {
+                nbad++;
+            }
+        }
+        test_value(nbad, 0, "Test auxiliary columns of selected events");
+
+        // Check that reading selected events from a FITS file does not
+        // modify the page size of its columns
+        GCTAEventList from_fits;
+        from_fits.read(fits_large, ebounds, GGti(), roi);
+        test_value(from_fits.size(), (int)rows.size(),
+                   "Test number of selected events read from FITS file");
+        int npaged = 0;
+        for (int i = 0; i < table_large->ncols(); ++i) {
+            if ((*table_large)[i].page() != 0) {
+                npaged++;
+            }
+        }
+        test_value(npaged, 0, "Test that columns of FITS file are not paged");
+
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Check that the auxiliary columns of an event list are read from its
+    // file when they are needed, and that an exception is thrown if the
+    // file has been removed before
+    test_try("Test auxiliary columns of removed event file");
+    try {
+        GCTAEventList all;
+        all.load(cta_events);
+        all.save("test_cta_events_aux.fits", true);
+        GCTAEventList lazy;
+        GCTAEventList fetched;
+        lazy.load("test_cta_events_aux.fits");
+        fetched.load("test_cta_events_aux.fits");
+        fetched.append(*(all[0]));
+        unlink("test_cta_events_aux.fits");
+        fetched.save("test_cta_events_fetched.fits", true);
+        lazy.save("test_cta_events_lazy.fits", true);
+        test_try_failure("Expected GCTAException::file_open_error exception.");
+    }
+    catch (GCTAException::file_open_error &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test binned observation handling
  ***************************************************************************/
@@ -498,6 +904,96 @@ void TestGCTAObservation::test_binned_obs(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test simulation with several threads
+ *
+ * Verifies that the simulation of CTA events from a sky model and from a
+ * background model gives identical events for one and for several threads.
+ ***************************************************************************/
+void TestGCTAObservation::test_simulation_threads(void)
+{
+    // Save number of threads
+    #ifdef _OPENMP
+    int max_threads = omp_get_max_threads();
+    #endif
+
+    // Simulate events
+    test_try("Simulate events with one and several threads");
+    try {
+
+        // Load observation and models
+        GCTAObservation run;
+        run.load_unbinned(cta_events);
+        run.response(cta_irf,cta_caldb);
+        GModels models(cta_model_xml);
+        const GModelSky* crab = dynamic_cast<const GModelSky*>(models[0]);
+        const GCTAModelRadialAcceptance* bgd =
+              dynamic_cast<const GCTAModelRadialAcceptance*>(models[1]);
+        test_assert(crab != NULL, "Check sky model");
+        test_assert(bgd != NULL, "Check background model");
+
+        // Set simulation region
+        GSkyDir dir;
+        GEnergy emin;
+        GEnergy emax;
+        GTime   tmin;
+        GTime   tmax;
+        dir.radec_deg(83.6331, 22.0145);
+        emin.TeV(0.1);
+        emax.TeV(100.0);
+        tmin.met(0.0);
+        tmax.met(3600.0);
+        double area = 5.0e10;
+
+        // Simulate events with one and with four threads
+        GCTAEventList lists[2];
+        int           nthreads[2] = {1, 4};
+        for (int k = 0; k < 2; ++k) {
+            #ifdef _OPENMP
+            omp_set_num_threads(nthreads[k]);
+            #endif
+            GRan ran;
+            ran.seed(1);
+            GPhotons photons = crab->mc(area, dir, 5.0, emin, emax,
+                                        tmin, tmax, ran);
+            run.response()->mc(area, photons, run, ran, lists[k]);
+            GCTAEventList* background = bgd->mc(run, ran);
+            lists[k].extend(*background);
+            delete background;
+        }
+
+        // Compare events
+        test_assert(lists[0].size() > 0, "Check that events were simulated");
+        test_value(lists[1].size(), lists[0].size(),
+                   "Check number of simulated events");
+        int nbad = 0;
+        for (int i = 0; i < lists[0].size() && i < lists[1].size(); ++i) {
+            const GCTAEventAtom* ref   = lists[0][i];
+            GCTAEventAtom        event = *(lists[1][i]);
+            if (event.energy() != ref->energy() ||
+                event.time()   != ref->time()   ||
+                event.dir().dist_deg(ref->dir()) > 1.0e-8) {
+                nbad++;
+            }
+        }
+        test_value(nbad, 0, "Check simulated events");
+
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Restore number of threads
+    #ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+    #endif
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test unbinned optimizer
  ***************************************************************************/
@@ -616,12 +1112,144 @@ void TestGCTAOptimize::test_binned_optimizer(void)
         test_try_failure(e);
     }
 
+    // Perform LM optimization using the IRF cache
+    test_try("Perform LM optimization using IRF cache");
+    try {
+        GObservations obs_cache;
+        run.irf_cache(true);
+        obs_cache.append(run);
+        obs_cache.models(cta_model_xml);
+        GOptimizerLM opt;
+        opt.max_iter(100);
+        obs_cache.optimize(opt);
+        test_try_success();
+        for (int i = 0, j = 0; i < obs_cache.models().size(); ++i) {
+            GModel* model = obs_cache.models()[i];
+            for (int k = 0; k < model->size(); ++k) {
+                GModelPar& par  = (*model)[k];
+                std::string msg = "Verify cached optimization result for " + par.print();
+                test_value(par.real_value(), fit_results[j++], 5.0e-5, msg);
+                test_value(par.real_error(), fit_results[j++], 5.0e-5, msg);
+            }
+        }
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
     // Exit test
     return;
 
 }
 
 
+/***********************************************************************//**
+ * @brief Test event-level parallelism on a counts cube
+ *
+ * Verifies that distributing the bins of a CTA counts cube over several
+ * threads gives the same likelihood, gradient and curvature as the serial
+ * evaluation.
+ ***************************************************************************/
+void TestGCTAOptimize::test_event_parallel(void)
+{
+    // Load binned CTA observation
+    GObservations   obs;
+    GCTAObservation run;
+    run.load_binned(cta_cntmap);
+    run.response(cta_irf,cta_caldb);
+    obs.append(run);
+    obs.models(cta_model_xml);
+
+    // Evaluate likelihood serially
+    GObservations::optimizer serial(&obs);
+    serial.eval(obs.models());
+
+    // Evaluate likelihood twice with event-level parallelism, so that the
+    // observation copies are reused in the second evaluation
+    GObservations::optimizer parallel(&obs);
+    parallel.nthreads(4);
+    parallel.eval(obs.models());
+    parallel.eval(obs.models());
+
+    // Compare results
+    test_value(*(parallel.value()), *(serial.value()), 1.0e-6,
+               "Check likelihood value");
+    test_value(parallel.npred(), serial.npred(), 1.0e-6, "Check Npred");
+    for (int i = 0; i < obs.models().npars(); ++i) {
+        double ref = (*serial.gradient())[i];
+        test_value((*parallel.gradient())[i], ref,
+                   1.0e-6 * (std::abs(ref) + 1.0), "Check gradient");
+        ref = (*serial.covar())(i,i);
+        test_value((*parallel.covar())(i,i), ref,
+                   1.0e-6 * (std::abs(ref) + 1.0), "Check curvature");
+    }
+
+    // Exit test
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test parallel source scan
+ *
+ * Verifies that a test statistic map of CTA data computed with several
+ * threads is identical to the map computed with a single thread.
+ ***************************************************************************/
+void TestGCTAOptimize::test_source_scan(void)
+{
+    // Load unbinned CTA observation
+    GObservations   obs;
+    GCTAObservation run;
+    run.load_unbinned(cta_events);
+    run.response(cta_irf,cta_caldb);
+    obs.append(run);
+    obs.models(cta_model_xml);
+
+    // Create test source
+    GSkyDir            dir;
+    GModelSpatialPtsrc ptsrc(dir);
+    GModelSpectralPlaw plaw;
+    GModelPointSource  source(ptsrc, plaw);
+
+    // Setup optimizer and sky maps
+    GOptimizerLM opt;
+    opt.max_iter(20);
+    GSkymap map_serial("CAR", "CEL", 83.6331, 22.0145, 0.2, 0.2, 2, 2, 2);
+    GSkymap map_parallel = map_serial;
+
+    // Compute test statistic maps with one and with several threads
+    test_try("Compute test statistic maps");
+    try {
+        GSourceScan serial(obs, source);
+        serial.nthreads(1);
+        serial.tsmap(map_serial, opt);
+        GSourceScan parallel(obs, source);
+        parallel.nthreads(4);
+        parallel.tsmap(map_parallel, opt);
+
+        // Compare maps
+        test_value(parallel.nfailed(), serial.nfailed(),
+                   "Check number of failed fits");
+        for (int pix = 0; pix < map_serial.npix(); ++pix) {
+            for (int k = 0; k < map_serial.nmaps(); ++k) {
+                double ref = map_serial(pix,k);
+                test_value(map_parallel(pix,k), ref,
+                           1.0e-6 * (std::abs(ref) + 1.0),
+                           "Check pixel "+str(pix)+" of map "+str(k));
+            }
+        }
+
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Exit test
+    return;
+}
+
+
 /***************************************************************************
  * @brief Main entry point for test executable
  ***************************************************************************/
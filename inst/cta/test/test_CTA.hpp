@@ -51,6 +51,8 @@ public:
     void         test_response_npsf(void);
     void         test_response_irf_diffuse(void);
     void         test_response_npred_diffuse(void);
+    void         test_response_irf_gradients(void);
+    void         test_response_irf_integration(void);
     void         test_response(void);
 };
 
@@ -71,7 +73,10 @@ public:
     // Methods
     virtual void set(void);
     void         test_unbinned_obs(void);
+    void         test_event_list(void);
+    void         test_event_list_selection(void);
     void         test_binned_obs(void);
+    void         test_simulation_threads(void);
 };
 
 
@@ -93,6 +98,8 @@ public:
     virtual void set(void);
     void         test_unbinned_optimizer(void);
     void         test_binned_optimizer(void);
+    void         test_event_parallel(void);
+    void         test_source_scan(void);
 };
 
 #endif /* TEST_CTA_HPP */
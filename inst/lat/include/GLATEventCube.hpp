@@ -90,6 +90,8 @@ public:
     std::string       diffname(const int& index) const;
     GSkymap*          diffrsp(const int& index) const;
     double            maxrad(const GSkyDir& dir) const;
+    virtual GLATEventBin* view(void) const { return new GLATEventBin; }
+    virtual const GEvent* event(const int& index, GEvent* view) const;
 
 protected:
     // Protected methods
@@ -104,6 +106,7 @@ protected:
     virtual void set_energies(void);
     virtual void set_times(void);
     void         set_bin(const int& index);
+    void         set_bin(const int& index, GLATEventBin& bin);
 
     // Protected data area
     GLATEventBin             m_bin;          //!< Actual energy bin
@@ -59,7 +59,7 @@ public:
 
     // Operators
     GLATMeanPsf& operator= (const GLATMeanPsf& cube);
-    double       operator() (const double& offset, const double& logE);
+    double       operator() (const double& offset, const double& logE) const;
 
     // Methods
     void         clear(void);
@@ -40,6 +40,11 @@
 #include "GModel.hpp"
 #include "GObservation.hpp"
 #include "GResponse.hpp"
+#include "GModels.hpp"
+#include "GSkyDir.hpp"
+
+/* __ Forward declarations _______________________________________________ */
+class GLATObservation;
 
 
 /***********************************************************************//**
@@ -87,6 +92,8 @@ public:
     void        save(const std::string& rspname) const;
     bool        force_mean(void) { return m_force_mean; }
     void        force_mean(const bool& value) { m_force_mean=value; }
+    void        build_mean_psfs(const GModels&         models,
+                                const GLATObservation& obs);
 
     // Reponse methods
     double irf(const GLATEventAtom& event,
@@ -98,9 +105,17 @@ public:
 
 private:
     // Private methods
-    void init_members(void);
-    void copy_members(const GLATResponse& rsp);
-    void free_members(void);
+    void               init_members(void);
+    void               copy_members(const GLATResponse& rsp);
+    void               free_members(void);
+    const GLATMeanPsf* mean_psf(const std::string&     name,
+                                const GSkyDir&         dir,
+                                const GLATObservation& obs,
+                                const bool&            match_dir) const;
+    GLATMeanPsf*       find_mean_psf(const std::vector<GLATMeanPsf*>& psfs,
+                                     const std::string&               name,
+                                     const GSkyDir&                   dir,
+                                     const bool&                      match_dir) const;
 
     // Private members
     std::string               m_caldb;      //!< Name of or path to the calibration database
@@ -112,6 +127,7 @@ private:
     std::vector<GLATPsf*>     m_psf;        //!< Point spread functions
     std::vector<GLATEdisp*>   m_edisp;      //!< Energy dispersions
     std::vector<GLATMeanPsf*> m_ptsrc;      //!< Mean PSFs for point sources
+    std::vector<GLATMeanPsf*> m_ptsrc_new;  //!< Mean PSFs built during evaluation
 };
 
 #endif /* GLATRESPONSE_HPP */
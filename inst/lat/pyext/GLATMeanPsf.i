@@ -50,7 +50,7 @@ public:
     virtual ~GLATMeanPsf(void);
 
     // Operators
-    double       operator()(const double& offset, const double& logE);
+    double       operator()(const double& offset, const double& logE) const;
 
     // Methods
     void         clear(void);
@@ -70,6 +70,8 @@ public:
     void        save(const std::string& rspname) const;
     bool        force_mean(void);
     void        force_mean(const bool& value);
+    void        build_mean_psfs(const GModels&         models,
+                                const GLATObservation& obs);
 
     // Reponse methods
     double irf(const GLATEventAtom& event,
@@ -42,7 +42,7 @@
 #define G_SET_DIRECTIONS                    "GLATEventCube::set_directions()"
 #define G_SET_ENERGIES                        "GLATEventCube::set_energies()"
 #define G_SET_TIMES                              "GLATEventCube::set_times()"
-#define G_SET_BIN                              "GLATEventCube::set_bin(int&)"
+#define G_SET_BIN                "GLATEventCube::set_bin(int&, GLATEventBin&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -586,6 +586,34 @@ double GLATEventCube::maxrad(const GSkyDir& srcDir) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return event bin using an event view
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event bin allocated by view().
+ *
+ * Sets up the event bin @p view for the specified @p index and returns a
+ * pointer to it. If @p view is not an event bin, the event bin of the cube
+ * is used.
+ ***************************************************************************/
+const GEvent* GLATEventCube::event(const int& index, GEvent* view) const
+{
+    // Get event bin
+    GLATEventBin* bin = dynamic_cast<GLATEventBin*>(view);
+
+    // Use event bin of cube if no event bin was provided
+    if (bin == NULL) {
+        return ((*this)[index]);
+    }
+
+    // Set event bin (circumvent const correctness)
+    const_cast<GLATEventCube*>(this)->set_bin(index, *bin);
+
+    // Return event bin
+    return bin;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -791,6 +819,8 @@ void GLATEventCube::read_gti(const GFitsTable* hdu)
  * This method computes the sky directions and solid angles for all event
  * cube pixels. Sky directions are stored in an array of GLATInstDir objects
  * while solid angles are stored in units of sr in a double precision array.
+ * As a side effect, the sky map projection is initialised, so that the sky
+ * map can subsequently be accessed concurrently by several threads.
  ***************************************************************************/
 void GLATEventCube::set_directions(void)
 {
@@ -912,6 +942,33 @@ void GLATEventCube::set_times(void)
  * as if they were stored in an array.
  ***************************************************************************/
 void GLATEventCube::set_bin(const int& index)
+{
+    // Set event bin of cube
+    set_bin(index, m_bin);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set event bin
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[out] bin Event bin.
+ *
+ * @exception GException::out_of_range
+ *            Event index is outside valid range.
+ * @exception GLATException::no_energies
+ *            Energy vectors have not been set up.
+ * @exception GLATException::no_dirs
+ *            Sky directions and solid angles vectors have not been set up.
+ *
+ * Sets up the pointers of the event bin @p bin so that they point to the
+ * information of the bin with the specified @p index. The method does not
+ * modify the event cube.
+ ***************************************************************************/
+void GLATEventCube::set_bin(const int& index, GLATEventBin& bin)
 {
     // Optionally check if the index is valid
     #if defined(G_RANGE_CHECK)
@@ -931,19 +988,19 @@ void GLATEventCube::set_bin(const int& index)
     }
 
     // Get pixel and energy bin indices.
-    m_bin.m_index = index;
-    m_bin.m_ipix  = index % npix();
-    m_bin.m_ieng  = index / npix();
+    bin.m_index = index;
+    bin.m_ipix  = index % npix();
+    bin.m_ieng  = index / npix();
 
     // Set pointers
-    m_bin.m_cube   = this;
-    m_bin.m_counts = &(m_map.pixels()[index]);
-    m_bin.m_energy = &(m_energies[m_bin.m_ieng]);
-    m_bin.m_time   = &m_time;
-    m_bin.m_dir    = &(m_dirs[m_bin.m_ipix]);
-    m_bin.m_omega  = &(m_omega[m_bin.m_ipix]);
-    m_bin.m_ewidth = &(m_ewidth[m_bin.m_ieng]);
-    m_bin.m_ontime = &m_ontime;
+    bin.m_cube   = this;
+    bin.m_counts = &(m_map.pixels()[index]);
+    bin.m_energy = &(m_energies[bin.m_ieng]);
+    bin.m_time   = &m_time;
+    bin.m_dir    = &(m_dirs[bin.m_ipix]);
+    bin.m_omega  = &(m_omega[bin.m_ipix]);
+    bin.m_ewidth = &(m_ewidth[bin.m_ieng]);
+    bin.m_ontime = &m_ontime;
 
     // Return
     return;
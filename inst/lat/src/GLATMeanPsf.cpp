@@ -169,66 +169,56 @@ GLATMeanPsf& GLATMeanPsf::operator= (const GLATMeanPsf& psf)
  * A zero value is returned if the offset angle is equal or larger than
  * 70 degrees or if \f$\log E\f$ is not positive.
  ***************************************************************************/
-double GLATMeanPsf::operator() (const double& offset, const double& logE)
+double GLATMeanPsf::operator() (const double& offset, const double& logE) const
 {
-    // Initialise response
+    // Initialise response value
     double value = 0.0;
 
     // Continue only if arguments are within valid range
     if (offset < 70.0 && logE > 0.0) {
 
-        // Flag no change of values
-        //bool change = false;
-
-        // Set offset interpolation
-        //if (offset != m_last_offset) {
-            m_offset.set_value(offset);
-        //    m_last_offset = offset;
-        //    change        = true;
-        //}
-
-        // Set energy interpolation
-        //if (logE != m_last_energy) {
-            m_energy.set_value(logE);
-        //    m_last_energy = logE;
-        //    change        = true;
-        //}
-
-        // If change occured then update interpolation indices and weighting
-        // factors
-        //if (change) {
-
-            // Set energy indices for exposure computation
-            m_inx1_exp = m_energy.inx_left();
-            m_inx2_exp = m_energy.inx_right();
-
-            // Set energy indices for PSF computation
-            int inx_energy_left  = m_inx1_exp  * noffsets();
-            int inx_energy_right = m_inx2_exp * noffsets();
-            
-            // Set array indices for bi-linear interpolation
-            m_inx1 = m_offset.inx_left()  + inx_energy_left;
-            m_inx2 = m_offset.inx_left()  + inx_energy_right;
-            m_inx3 = m_offset.inx_right() + inx_energy_left;
-            m_inx4 = m_offset.inx_right() + inx_energy_right;
-
-            // Set weighting factors for bi-linear interpolation
-            m_wgt1 = m_offset.wgt_left()  * m_energy.wgt_left();
-            m_wgt2 = m_offset.wgt_left()  * m_energy.wgt_right();
-            m_wgt3 = m_offset.wgt_right() * m_energy.wgt_left();
-            m_wgt4 = m_offset.wgt_right() * m_energy.wgt_right();
-
-        //} // endif: logE or ctheta changed
+        // Get offset and energy interpolation indices and weighting
+        // factors. The caller-owned interface of the node arrays is used
+        // so that the mean PSF is not modified and can be evaluated
+        // concurrently.
+        int    inx_offset_left;
+        int    inx_offset_right;
+        double wgt_offset_left;
+        double wgt_offset_right;
+        int    inx1_exp;
+        int    inx2_exp;
+        double wgt_energy_left;
+        double wgt_energy_right;
+        m_offset.set_value(offset, inx_offset_left, inx_offset_right,
+                           wgt_offset_left, wgt_offset_right);
+        m_energy.set_value(logE, inx1_exp, inx2_exp,
+                           wgt_energy_left, wgt_energy_right);
+
+        // Set energy indices for PSF computation
+        int inx_energy_left  = inx1_exp * noffsets();
+        int inx_energy_right = inx2_exp * noffsets();
+
+        // Set array indices for bi-linear interpolation
+        int inx1 = inx_offset_left  + inx_energy_left;
+        int inx2 = inx_offset_left  + inx_energy_right;
+        int inx3 = inx_offset_right + inx_energy_left;
+        int inx4 = inx_offset_right + inx_energy_right;
+
+        // Set weighting factors for bi-linear interpolation
+        double wgt1 = wgt_offset_left  * wgt_energy_left;
+        double wgt2 = wgt_offset_left  * wgt_energy_right;
+        double wgt3 = wgt_offset_right * wgt_energy_left;
+        double wgt4 = wgt_offset_right * wgt_energy_right;
 
         // Compute energy dependent exposure and map corrections
-        double fac_left  = m_exposure[m_inx1_exp] * m_mapcorr[m_inx1_exp];
-        double fac_right = m_exposure[m_inx2_exp] * m_mapcorr[m_inx2_exp];
+        double fac_left  = m_exposure[inx1_exp] * m_mapcorr[inx1_exp];
+        double fac_right = m_exposure[inx2_exp] * m_mapcorr[inx2_exp];
 
         // Perform bi-linear interpolation
-        value = m_wgt1 * m_psf[m_inx1] * fac_left  +
-                m_wgt2 * m_psf[m_inx2] * fac_right +
-                m_wgt3 * m_psf[m_inx3] * fac_left  +
-                m_wgt4 * m_psf[m_inx4] * fac_right;
+        value = wgt1 * m_psf[inx1] * fac_left  +
+                wgt2 * m_psf[inx2] * fac_right +
+                wgt3 * m_psf[inx3] * fac_left  +
+                wgt4 * m_psf[inx4] * fac_right;
 
         // Optionally check for negative values
         #if G_SIGNAL_NEGATIVE_MEAN_PSF
@@ -332,12 +322,17 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
 
     // Limit computation to zenith angles < m_theta_max (typically 70
     // degrees - this is the hardwired value in the ST). For this purpose
-    // set the costhetamin parameter of Aeff to m_theta_max. Store also the
-    // original values in a vector for later restoration.
-    std::vector<double> save_costhetamin;
+    // work on private copies of the effective areas with the costhetamin
+    // parameter set to m_theta_max. The PSFs are also copied since their
+    // evaluation updates interpolation caches. The response itself is thus
+    // never modified, and mean PSFs for different sources may be computed
+    // concurrently.
+    std::vector<GLATAeff*> aeff;
+    std::vector<GLATPsf*>  psf;
     for (int i = 0; i < rsp->size(); ++i) {
-        save_costhetamin.push_back(rsp->aeff(i)->costhetamin());
-        rsp->aeff(i)->costhetamin(cos(m_theta_max*deg2rad));
+        aeff.push_back(rsp->aeff(i)->clone());
+        psf.push_back(rsp->psf(i)->clone());
+        aeff[i]->costhetamin(cos(m_theta_max*deg2rad));
     }
     
     // Allocate room for arrays
@@ -362,7 +357,7 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
         // Compute exposure by looping over the responses
         double exposure = 0.0;
         for (int i = 0; i < rsp->size(); ++i)
-            exposure += (*ltcube)(dir, energy[ieng], *rsp->aeff(i));
+            exposure += (*ltcube)(dir, energy[ieng], *aeff[i]);
 
         // Set exposure
         m_exposure.push_back(exposure);
@@ -371,23 +366,25 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
         for (int ioffset = 0; ioffset < m_offset.size(); ++ioffset) {
 
             // Compute point spread function by looping over the responses
-            double psf = 0.0;
+            double value = 0.0;
             for (int i = 0; i < rsp->size(); ++i)
-                psf += (*ltcube)(dir, energy[ieng], m_offset[ioffset],
-                                 *rsp->psf(i), *rsp->aeff(i));
+                value += (*ltcube)(dir, energy[ieng], m_offset[ioffset],
+                                   *psf[i], *aeff[i]);
 
             // Normalize PSF by exposure and clip when exposure drops to 0
-            psf = (exposure > 0.0) ? psf/exposure : 0.0;
+            value = (exposure > 0.0) ? value/exposure : 0.0;
 
             // Set PSF value
-            m_psf.push_back(psf);
+            m_psf.push_back(value);
 
         } // endfor: looped over offsets
     } // endfor: looped over energies
 
-    // Restore initial Aeff zenith angle restriction
-    for (int i = 0; i < rsp->size(); ++i)
-        rsp->aeff(i)->costhetamin(save_costhetamin[i]);
+    // Free private copies of effective areas and PSFs
+    for (int i = 0; i < rsp->size(); ++i) {
+        delete aeff[i];
+        delete psf[i];
+    }
 
     // Compute map corrections
     set_map_corrections(obs);
@@ -265,6 +265,29 @@ GLATLtCube* GLATObservation::ltcube(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Prepare observation for the evaluation of models
+ *
+ * @param[in] models Models.
+ *
+ * Builds the mean PSFs of all point sources of a binned observation (see
+ * GLATResponse::build_mean_psfs()), so that they are not built lazily
+ * while the response is evaluated by several threads.
+ ***************************************************************************/
+void GLATObservation::prepare(const GModels& models)
+{
+    // Build mean PSFs if we have a response, a livetime cube and an
+    // event cube
+    if (m_response != NULL && m_ltcube != NULL &&
+        dynamic_cast<const GLATEventCube*>(events()) != NULL) {
+        m_response->build_mean_psfs(models, *this);
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Returns instrument name
  ***************************************************************************/
@@ -35,6 +35,8 @@
 #include "GFits.hpp"
 #include "GTools.hpp"
 #include "GCaldb.hpp"
+#include "GModels.hpp"
+#include "GModelSky.hpp"
 #include "GModelSpatialPtsrc.hpp"
 #include "GLATInstDir.hpp"
 #include "GLATResponse.hpp"
@@ -241,42 +243,15 @@ double GLATResponse::irf(const GEvent&       event,
     const GSkyDir& srcDir = photon.dir();
     const GEnergy& srcEng = photon.energy();
 
-    // Search for mean PSF
-    int ipsf = -1;
-    for (int i = 0; i < m_ptsrc.size(); ++i) {
-        if (m_ptsrc[i]->dir() == srcDir) {
-            ipsf = i;
-            break;
-        }
-    }
-
-    // If mean PSF has not been found then create it now
-    if (ipsf == -1) {
-
-        // Allocate new mean PSF
-        GLATMeanPsf* psf = new GLATMeanPsf(srcDir, static_cast<const GLATObservation&>(obs));
-
-        // Set source name
-        std::string name = "SRC("+str(srcDir.ra_deg())+","+str(srcDir.dec_deg())+")";
-        psf->name(name);
-
-        // Push mean PSF on stack
-        const_cast<GLATResponse*>(this)->m_ptsrc.push_back(psf);
-
-        // Set index of mean PSF
-        ipsf = m_ptsrc.size()-1;
-
-        // Debug option: dump mean PSF
-        #if G_DUMP_MEAN_PSF
-        std::cout << "Added new mean PSF \""+name+"\"" << std::endl;
-        std::cout << *psf << std::endl;
-        #endif
-
-    } // endif: created new mean PSF
+    // Get mean PSF for source direction
+    std::string        name = "SRC("+str(srcDir.ra_deg())+","+str(srcDir.dec_deg())+")";
+    const GLATMeanPsf* psf  = mean_psf(name, srcDir,
+                                       static_cast<const GLATObservation&>(obs),
+                                       true);
 
     // Get IRF value
     double offset = dir->dist_deg(srcDir);
-    double irf    = (*m_ptsrc[ipsf])(offset, srcEng.log10MeV());
+    double irf    = (*psf)(offset, srcEng.log10MeV());
 
     // Return IRF value
     return irf;
@@ -413,43 +388,15 @@ double GLATResponse::irf(const GLATEventBin& event,
     // then return response from mean PSF
     if ((idiff == -1 || m_force_mean) && ptsrc != NULL) {
 
-        // Search for mean PSF
-        int ipsf = -1;
-        for (int i = 0; i < m_ptsrc.size(); ++i) {
-            if (m_ptsrc[i]->name() == source.name()) {
-                ipsf = i;
-                break;
-            }
-        }
-
-        // If mean PSF has not been found then create it now
-        if (ipsf == -1) {
-
-            // Allocate new mean PSF
-            GLATMeanPsf* psf = 
-                new GLATMeanPsf(ptsrc->dir(), static_cast<const GLATObservation&>(obs));
-
-            // Set source name
-            psf->name(source.name());
-
-            // Push mean PSF on stack
-            const_cast<GLATResponse*>(this)->m_ptsrc.push_back(psf);
-
-            // Set index of mean PSF
-            ipsf = m_ptsrc.size()-1;
-
-            // Debug option: dump mean PSF
-            #if G_DUMP_MEAN_PSF 
-            std::cout << "Added new mean PSF \""+source.name() << "\"" << std::endl;
-            std::cout << *psf << std::endl;
-            #endif
-
-        } // endif: created new mean PSF
+        // Get mean PSF for source
+        const GLATMeanPsf* psf = mean_psf(source.name(), ptsrc->dir(),
+                                          static_cast<const GLATObservation&>(obs),
+                                          false);
 
         // Get PSF value
-        GSkyDir srcDir   = m_ptsrc[ipsf]->dir();
+        GSkyDir srcDir   = psf->dir();
         double  offset   = event.dir().dist_deg(srcDir);
-        double  mean_psf = (*m_ptsrc[ipsf])(offset, srcEng.log10MeV()) / (event.ontime());
+        double  mean_psf = (*psf)(offset, srcEng.log10MeV()) / (event.ontime());
 
         // Debug option: compare mean PSF to diffuse response
         #if G_DEBUG_MEAN_PSF
@@ -684,6 +631,134 @@ GLATEdisp* GLATResponse::edisp(const int& index) const
 }
 
 
+/***********************************************************************//**
+ * @brief Build mean PSFs for point sources
+ *
+ * @param[in] models Models.
+ * @param[in] obs LAT observation.
+ *
+ * Builds the mean PSFs of all point source sky models that will be needed
+ * for the computation of the response of the observation. The mean PSFs
+ * are otherwise built lazily the first time that the response of a source
+ * is requested, which serialises their computation if the response is
+ * evaluated by several threads. Building the mean PSFs beforehand allows
+ * to compute them in parallel, since they are independent.
+ *
+ * Sources for which a mean PSF exists already are skipped, as are sources
+ * for which a diffuse response is found in the event cube, unless the use
+ * of the mean PSF has been enforced using force_mean().
+ *
+ * The method is called by GLATObservation::prepare() before the models
+ * are evaluated. It should not be called from within a parallel region.
+ * The mean PSFs that have been built during the last evaluation (see
+ * mean_psf()) are moved to the mean PSFs that are searched without
+ * critical section.
+ ***************************************************************************/
+void GLATResponse::build_mean_psfs(const GModels& models,
+                                   const GLATObservation& obs)
+{
+    // Move mean PSFs that were built during the last evaluation
+    m_ptsrc.insert(m_ptsrc.end(), m_ptsrc_new.begin(), m_ptsrc_new.end());
+    m_ptsrc_new.clear();
+
+    // Get pointer to event cube (if any)
+    const GLATEventCube* cube = dynamic_cast<const GLATEventCube*>(obs.events());
+
+    // Collect point sources for which a mean PSF needs to be built
+    std::vector<std::string> names;
+    std::vector<GSkyDir>     dirs;
+    for (int k = 0; k < models.size(); ++k) {
+
+        // Skip models that are not point source sky models
+        const GModelSky* sky = dynamic_cast<const GModelSky*>(models[k]);
+        if (sky == NULL) {
+            continue;
+        }
+        const GModelSpatialPtsrc* ptsrc =
+              dynamic_cast<const GModelSpatialPtsrc*>(sky->spatial());
+        if (ptsrc == NULL) {
+            continue;
+        }
+
+        // Skip sources with diffuse response
+        bool skip = false;
+        if (cube != NULL && !m_force_mean) {
+            for (int i = 0; i < cube->ndiffrsp(); ++i) {
+                if (cube->diffname(i) == sky->name()) {
+                    skip = true;
+                    break;
+                }
+            }
+        }
+
+        // Skip sources with existing mean PSF
+        for (int i = 0; i < (int)m_ptsrc.size() && !skip; ++i) {
+            if (m_ptsrc[i]->name() == sky->name()) {
+                skip = true;
+            }
+        }
+        for (int i = 0; i < (int)names.size() && !skip; ++i) {
+            if (names[i] == sky->name()) {
+                skip = true;
+            }
+        }
+
+        // Collect source
+        if (!skip) {
+            names.push_back(sky->name());
+            dirs.push_back(ptsrc->dir());
+        }
+
+    } // endfor: looped over models
+
+    // Continue only if there are mean PSFs to build
+    int nsrc = names.size();
+    if (nsrc > 0) {
+
+        // Build mean PSFs in parallel. The sky map projections that are
+        // used are set up before: the livetime cube maps are HEALPix maps
+        // that have no lazily initialised members, and the event cube
+        // computes the directions of all pixels when its map is set (see
+        // GLATEventCube::set_directions()). As exceptions must not leave
+        // the parallel region, a mean PSF that can not be computed is
+        // signalled by a NULL pointer.
+        std::vector<GLATMeanPsf*> psfs(nsrc, (GLATMeanPsf*)NULL);
+        #pragma omp parallel for schedule(dynamic)
+        for (int k = 0; k < nsrc; ++k) {
+            try {
+                GLATMeanPsf* psf = new GLATMeanPsf(dirs[k], obs);
+                psf->name(names[k]);
+                psfs[k] = psf;
+            }
+            catch (std::exception& e) {
+                psfs[k] = NULL;
+            }
+        }
+
+        // Store mean PSFs
+        for (int k = 0; k < nsrc; ++k) {
+            if (psfs[k] != NULL) {
+                m_ptsrc.push_back(psfs[k]);
+            }
+        }
+
+        // Build the mean PSFs that failed again serially, so that the
+        // exception is thrown
+        for (int k = 0; k < nsrc; ++k) {
+            if (psfs[k] == NULL) {
+                GLATMeanPsf* psf = new GLATMeanPsf(dirs[k], obs);
+                psf->name(names[k]);
+                m_ptsrc.push_back(psf);
+            }
+        }
+
+    } // endif: there were mean PSFs to build
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print LAT response information
  ***************************************************************************/
@@ -717,6 +792,9 @@ std::string GLATResponse::print(void) const
     for (int i = 0; i < m_ptsrc.size(); ++i) {
         result.append("\n"+m_ptsrc[i]->print());
     }
+    for (int i = 0; i < (int)m_ptsrc_new.size(); ++i) {
+        result.append("\n"+m_ptsrc_new[i]->print());
+    }
 
     // Return result
     return result;
@@ -746,6 +824,7 @@ void GLATResponse::init_members(void)
     m_psf.clear();
     m_edisp.clear();
     m_ptsrc.clear();
+    m_ptsrc_new.clear();
     
     // By default use HANDOFF response database.
     char* handoff = std::getenv("HANDOFF_IRF_DIR");
@@ -775,6 +854,7 @@ void GLATResponse::copy_members(const GLATResponse& rsp)
     m_psf        = rsp.m_psf;
     m_edisp      = rsp.m_edisp;
     m_ptsrc      = rsp.m_ptsrc;
+    m_ptsrc_new  = rsp.m_ptsrc_new;
 
     // Return
     return;
@@ -791,6 +871,113 @@ void GLATResponse::free_members(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Return mean PSF for a point source
+ *
+ * @param[in] name Source name.
+ * @param[in] dir Source direction.
+ * @param[in] obs LAT observation.
+ * @param[in] match_dir Search mean PSF by direction instead of name.
+ *
+ * Returns the mean PSF of a point source. If no mean PSF exists yet for
+ * the source, it is built and added to the response.
+ *
+ * The mean PSFs that were built before the evaluation (see
+ * build_mean_psfs()) are not modified while the response is evaluated,
+ * hence they are searched without critical section. Only if the mean PSF
+ * is not found there, the mean PSFs that were built during the evaluation
+ * are searched in a critical section. If the mean PSF is not found either,
+ * it is built outside the critical section, so that mean PSFs for
+ * different sources can be built concurrently and that exceptions do not
+ * leave the critical section, and it is then inserted in a critical
+ * section. In case that another thread inserted the same mean PSF in the
+ * meantime, the newly built mean PSF is dropped. Building mean PSFs
+ * concurrently is safe as the sky map projections that are used have been
+ * set up when the livetime cube and the event cube were loaded.
+ ***************************************************************************/
+const GLATMeanPsf* GLATResponse::mean_psf(const std::string&     name,
+                                          const GSkyDir&         dir,
+                                          const GLATObservation& obs,
+                                          const bool&            match_dir) const
+{
+    // Search for mean PSF that was built before the evaluation
+    GLATMeanPsf* psf = find_mean_psf(m_ptsrc, name, dir, match_dir);
+
+    // Search for mean PSF that was built during the evaluation
+    if (psf == NULL) {
+        #pragma omp critical(GLATResponse_mean_psf)
+        psf = find_mean_psf(m_ptsrc_new, name, dir, match_dir);
+    }
+
+    // If mean PSF has not been found then create it now
+    if (psf == NULL) {
+
+        // Allocate new mean PSF
+        GLATMeanPsf* new_psf = new GLATMeanPsf(dir, obs);
+        new_psf->name(name);
+
+        // Push mean PSF on stack unless another thread did it already
+        #pragma omp critical(GLATResponse_mean_psf)
+        {
+            psf = find_mean_psf(m_ptsrc_new, name, dir, match_dir);
+            if (psf == NULL) {
+                const_cast<GLATResponse*>(this)->m_ptsrc_new.push_back(new_psf);
+                psf     = new_psf;
+                new_psf = NULL;
+            }
+        }
+
+        // Free mean PSF if it was not used
+        if (new_psf != NULL) {
+            delete new_psf;
+        }
+
+        // Debug option: dump mean PSF
+        #if G_DUMP_MEAN_PSF
+        std::cout << "Added new mean PSF \""+name+"\"" << std::endl;
+        std::cout << *psf << std::endl;
+        #endif
+
+    } // endif: created new mean PSF
+
+    // Return mean PSF
+    return psf;
+}
+
+
+/***********************************************************************//**
+ * @brief Search mean PSF for a point source
+ *
+ * @param[in] psfs Mean PSFs.
+ * @param[in] name Source name.
+ * @param[in] dir Source direction.
+ * @param[in] match_dir Search mean PSF by direction instead of name.
+ *
+ * Returns the mean PSF of a point source, or NULL if no mean PSF exists
+ * for the source in @p psfs.
+ ***************************************************************************/
+GLATMeanPsf* GLATResponse::find_mean_psf(const std::vector<GLATMeanPsf*>& psfs,
+                                         const std::string&               name,
+                                         const GSkyDir&                   dir,
+                                         const bool&                      match_dir) const
+{
+    // Initialise result
+    GLATMeanPsf* psf = NULL;
+
+    // Search for mean PSF
+    for (int i = 0; i < (int)psfs.size(); ++i) {
+        if (match_dir ? (psfs[i]->dir()  == dir)
+                      : (psfs[i]->name() == name)) {
+            psf = psfs[i];
+            break;
+        }
+    }
+
+    // Return mean PSF
+    return psf;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                                 Friends                                 =
@@ -31,6 +31,10 @@
 #include <stdlib.h>
 #include <iostream>
 #include <unistd.h>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "GLATLib.hpp"
 #include "GTools.hpp"
 #include "test_LAT.hpp"
@@ -107,6 +111,7 @@ void TestGLATObservation::set(void)
     append(static_cast<pfunction>(&TestGLATObservation::test_unbinned_obs_p7), "Test P7 unbinned observation");
     append(static_cast<pfunction>(&TestGLATObservation::test_binned_obs_p6), "Test P6 binned observation");
     append(static_cast<pfunction>(&TestGLATObservation::test_binned_obs_p7), "Test P7 binned observation");
+    append(static_cast<pfunction>(&TestGLATObservation::test_mean_psfs_p7), "Test P7 mean PSF construction");
 
     // Return
     return;
@@ -574,6 +579,107 @@ void TestGLATObservation::test_one_binned_obs(const std::string& datadir, const
 }
 
 
+/***********************************************************************//**
+ * @brief Test mean PSF construction
+ *
+ * Verifies that the mean PSFs of point sources that are built up front,
+ * using several threads, give the same model values as mean PSFs that are
+ * built lazily when the response is evaluated, and that errors that occur
+ * while building the mean PSFs are reported.
+ ***************************************************************************/
+void TestGLATObservation::test_mean_psfs_p7(void)
+{
+    // Set filenames
+    std::string lat_srcmap = dirPass7+"/srcmap.fits";
+    std::string lat_expmap = dirPass7+"/binned_expmap.fits";
+    std::string lat_ltcube = dirPass7+"/ltcube.fits";
+
+    // Set point source models
+    GModels models;
+    for (int k = 0; k < 4; ++k) {
+        GSkyDir dir;
+        dir.radec_deg(83.6331 + 0.5*k, 22.0145);
+        GModelSpatialPtsrc spatial(dir);
+        GModelSpectralPlaw spectral(1.0e-7, -2.0);
+        GModelPointSource  source(spatial, spectral);
+        source.name("Source "+str(k));
+        models.append(source);
+    }
+
+    // Setup observations that use the mean PSF for all point sources
+    GLATObservation lazy;
+    GLATObservation built;
+    test_try("Setup observations");
+    try {
+        lazy.load_binned(lat_srcmap, lat_expmap, lat_ltcube);
+        lazy.response("P7SOURCE_V6", lat_caldb);
+        lazy.response()->force_mean(true);
+        built = lazy;
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Build mean PSFs up front using several threads
+    #ifdef _OPENMP
+    int nthreads = omp_get_max_threads();
+    omp_set_num_threads(4);
+    #endif
+    test_try("Build mean PSFs");
+    try {
+        built.prepare(models);
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+    #ifdef _OPENMP
+    omp_set_num_threads(nthreads);
+    #endif
+
+    // Compare model values to those computed with lazily built mean PSFs
+    const GLATEventCube* cube1 = dynamic_cast<const GLATEventCube*>(built.events());
+    const GLATEventCube* cube2 = dynamic_cast<const GLATEventCube*>(lazy.events());
+    test_assert(cube1 != NULL && cube2 != NULL, "Binned observations");
+    if (cube1 != NULL && cube2 != NULL) {
+        test_try("Compare model values");
+        try {
+            for (int i = 0; i < cube1->size(); i += 97) {
+                double value  = built.model(models, *((*cube1)[i]));
+                double expect = lazy.model(models, *((*cube2)[i]));
+                test_value(value, expect, 1.0e-10*std::abs(expect),
+                           "Model value for bin "+str(i));
+            }
+            test_try_success();
+        }
+        catch (std::exception &e) {
+            test_try_failure(e);
+        }
+    }
+
+    // Check that a mean PSF that can not be built raises an exception
+    test_try("Build mean PSFs without livetime cube");
+    try {
+        GLATObservation run;
+        run.load_binned(lat_srcmap, lat_expmap, "");
+        run.response("P7SOURCE_V6", lat_caldb);
+        run.response()->force_mean(true);
+        run.response()->build_mean_psfs(models, run);
+        test_try_failure("Exception expected for missing livetime cube.");
+    }
+    catch (GLATException::no_ltcube &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test binned optimizer handling
  *
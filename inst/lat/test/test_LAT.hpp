@@ -90,6 +90,7 @@ public:
     void         test_unbinned_obs_p7(void);
     void         test_binned_obs_p6(void);
     void         test_binned_obs_p7(void);
+    void         test_mean_psfs_p7(void);
     void         test_one_unbinned_obs(const std::string& datadir);
     void         test_one_binned_obs(const std::string& datadir, const std::string& irf);
 };
@@ -82,6 +82,8 @@ public:
     int              number(void) const;
     int              length(void) const;
     int              anynul(void) const;
+    void             page(const int& nrows);
+    int              page(void) const;
 };
 
 
@@ -59,8 +59,16 @@ public:
     const bool&       silent(void) const { return m_silent; }
     void              integrand(GIntegrand* integrand) { m_integrand=integrand; }
     const GIntegrand* integrand(void) const { return m_integrand; }
+    void              method(const std::string& method);
+    std::string       method(void) const;
+    void              order(const int& order);
+    const int&        order(void) const;
+    const int&        calls(void) const;
+    double            integrate(double a, double b);
     double            romb(double a, double b, int k = 5);
     double            trapzd(double a, double b, int n = 1, double result = 0.0);
+    double            gauss_kronrod(double a, double b);
+    double            gauss_legendre(double a, double b);
 };
 
 
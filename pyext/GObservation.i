@@ -59,16 +59,19 @@ public:
     virtual double        model(const GModels& models, const GEvent& event,
                                 GVector* gradient = NULL) const;
     virtual double        npred(const GModels& models, GVector* gradient = NULL) const;
+    virtual void          prepare(const GModels& models);
 
     // Implemented methods
     void                  name(const std::string& name);
     void                  id(const std::string& id);
-    void                  events(const GEvents* events);
+    virtual void          events(const GEvents* events);
     void                  statistics(const std::string& statistics);
+    void                  numeric_grad(const bool& numeric);
     const std::string&    name(void) const;
     const std::string&    id(void) const;
     const GEvents*        events(void) const;
     const std::string&    statistics(void) const;
+    const bool&           numeric_grad(void) const;
 
     // Other methods
     virtual double model_grad(const GModel& model, const GEvent& event, int ipar) const;
@@ -56,6 +56,8 @@ public:
     void           models(const std::string& filename);
     GModels&       models(void) { return m_models; }
     void           optimize(GOptimizer& opt);
+    void           nthreads(const int& nthreads);
+    const int&     nthreads(void) const;
     double         npred(void) const;
 };
 
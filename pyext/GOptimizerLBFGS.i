@@ -0,0 +1,89 @@
+/***************************************************************************
+ *        GOptimizerLBFGS.i  -  L-BFGS optimizer class Python interface    *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2012 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GOptimizerLBFGS.i
+ * @brief L-BFGS optimizer class Python interface definition
+ * @author Juergen Knoedlseder
+ */
+%{
+/* Put headers and other declarations here that are needed for compilation */
+#include "GOptimizerLBFGS.hpp"
+#include "GTools.hpp"
+%}
+
+
+/***********************************************************************//**
+ * @class GOptimizerLBFGS
+ *
+ * @brief GOptimizerLBFGS class SWIG interface defintion.
+ ***************************************************************************/
+class GOptimizerLBFGS : public GOptimizer {
+public:
+
+    // Constructors and destructors
+    GOptimizerLBFGS(void);
+    GOptimizerLBFGS(GLog& log);
+    GOptimizerLBFGS(const GOptimizerLBFGS& opt);
+    virtual ~GOptimizerLBFGS(void);
+
+    // Implemented pure virtual methods
+    virtual void             clear(void);
+    virtual GOptimizerLBFGS* clone(void) const;
+    virtual double           value(void) const;
+    virtual int              status(void) const;
+    virtual int              iter(void) const;
+
+    // Methods
+    void   max_iter(const int& n);
+    void   max_trials(const int& n);
+    void   memory(const int& n);
+    void   eps(const double& eps);
+    void   compute_errors(const bool& flag);
+    int    max_iter(void) const;
+    int    max_trials(void) const;
+    int    memory(void) const;
+    double eps(void) const;
+    bool   compute_errors(void) const;
+};
+
+
+/***********************************************************************//**
+ * @brief GOptimizerLBFGS class extension
+ ***************************************************************************/
+%extend GOptimizerLBFGS {
+    GOptimizerLBFGS copy() {
+        return (*self);
+    }
+};
+
+
+/***********************************************************************//**
+ * @brief GOptimizerLBFGS type casts
+ ***************************************************************************/
+%inline %{
+    GOptimizerLBFGS* cast_GOptimizerLBFGS(GOptimizer* arg) {
+        GOptimizerLBFGS* opt = dynamic_cast<GOptimizerLBFGS*>(arg);
+        if (opt == NULL)
+            throw GException::bad_type("cast_GOptimizerLBFGS(GOptimizer*)",
+                                       "GOptimizer not of type GOptimizerLBFGS");
+        return opt;
+    }
+%}
@@ -58,15 +58,22 @@ public:
     void   lambda_start(const double& val);
     void   lambda_inc(const double& val);
     void   lambda_dec(const double& val);
+    void   lambda_trials(const int& n);
     void   eps(const double& eps);
+    void   profile(const int& ipar);
+    void   clear_profile(void);
     int    max_iter(void) const;
     int    max_stalls(void) const;
     int    max_boundary_hits(void) const;
     double lambda_start(void) const;
     double lambda_inc(void) const;
     double lambda_dec(void) const;
+    int    lambda_trials(void) const;
     //double lambda(void) const;
     double eps(void) const;
+    int    nprofile(void) const;
+    double error_lower(const int& ipar) const;
+    double error_upper(const int& ipar) const;
 };
 
 
@@ -50,6 +50,7 @@ public:
     void                   clear(void);
     GRan*                  clone(void) const;
     void                   seed(unsigned long long int seed);
+    GRan                   stream(const unsigned long long int& index) const;
     unsigned long int      int32(void);
     unsigned long long int int64(void);
     double                 uniform(void);
@@ -55,9 +55,13 @@ public:
                             const GObservation& obs) const = 0;
 
     // Virtual methods
+    virtual bool   isreentrant(void) const;
     virtual double irf(const GEvent&       event,
                        const GSource&      source,
                        const GObservation& obs) const;
+    virtual double irf_gradients(const GEvent&       event,
+                                 const GSource&      source,
+                                 const GObservation& obs) const;
     virtual double irf_ptsrc(const GEvent&       event,
                              const GSource&      source,
                              const GObservation& obs) const;
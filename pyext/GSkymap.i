@@ -29,6 +29,11 @@
 #include "GTools.hpp"
 %}
 
+/* __ Vectors of sky directions and pixels _______________________________ */
+%include stl.i
+%template(GSkyDirs) std::vector<GSkyDir>;
+%template(GSkyPixels) std::vector<GSkyPixel>;
+
 
 /***********************************************************************//**
  * @brief Tuple to index conversion to provide pixel access.
@@ -129,6 +134,8 @@ public:
     double    omega(const int& pix) const;
     GSkyDir   xy2dir(const GSkyPixel& pix);
     GSkyPixel dir2xy(const GSkyDir& dir) const;
+    std::vector<GSkyDir>   xy2dir(const std::vector<GSkyPixel>& pixels) const;
+    std::vector<GSkyPixel> dir2xy(const std::vector<GSkyDir>& dirs) const;
     void      load(const std::string& filename);
     void      save(const std::string& filename, bool clobber = false) const;
     void      read(const GFitsHDU* hdu);
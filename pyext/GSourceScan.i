@@ -0,0 +1,70 @@
+/***************************************************************************
+ *                 GSourceScan.i  -  Source scan class                     *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2012 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GSourceScan.i
+ * @brief Source scan class Python interface definition
+ * @author Juergen Knoedlseder
+ */
+%{
+/* Put headers and other declarations here that are needed for compilation */
+#include "GSourceScan.hpp"
+#include "GTools.hpp"
+%}
+
+
+/***********************************************************************//**
+ * @class GSourceScan
+ *
+ * @brief Source scan class
+ ***************************************************************************/
+class GSourceScan : public GBase {
+public:
+    // Constructors and destructors
+    GSourceScan(void);
+    GSourceScan(GObservations& obs, const GModelSky& source);
+    GSourceScan(const GSourceScan& scan);
+    virtual ~GSourceScan(void);
+
+    // Methods
+    void         clear(void);
+    GSourceScan* clone(void) const;
+    void         observations(GObservations& obs);
+    void         source(const GModelSky& source);
+    void         nthreads(const int& nthreads);
+    const int&   nthreads(void) const;
+    void         tsmap(GSkymap& map, const GOptimizer& opt);
+    double       ts(const GSkyDir& dir, const GOptimizer& opt);
+    double       null_value(void) const;
+    int          nfailed(void) const;
+};
+
+
+/***********************************************************************//**
+ * @brief GSourceScan class extension
+ ***************************************************************************/
+%extend GSourceScan {
+    char *__str__() {
+        return tochar(self->print());
+    }
+    GSourceScan copy() {
+        return (*self);
+    }
+};
@@ -89,9 +89,13 @@ public:
     void    insert_col(const double* values, const int* rows,
                        int number, const int& col);
     void    cholesky_decompose(bool compress = true);
+    void    cholesky_decompose(const GSparseMatrix& factor,
+                               bool compress = true);
+    void    cholesky_symbolic(const GSparseMatrix& factor);
     GVector cholesky_solver(const GVector& vector, bool compress = true);
     void    cholesky_invert(bool compress = true);
     void    set_mem_block(const int& block);
+    void    zero(void);
     void    stack_init(const int& size = 0, const int& entries = 0);
     int     stack_push_column(const GVector& vector, const int& col);
     int     stack_push_column(const double* values, const int* rows,
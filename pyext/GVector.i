@@ -59,6 +59,7 @@ public:
     // Vector functions
     void     clear(void);
     GVector* clone(void) const;
+    GVector& axpy(const double& a, const GVector& x);
     int      size(void) const;
     int      non_zeros(void) const;
 };
@@ -41,6 +41,7 @@
 %include "GGti.i"
 %include "GCaldb.i"
 %include "GObservations.i"
+%include "GSourceScan.i"
 %include "GObservation.i"
 %include "GObservationRegistry.i"
 %include "GEvents.i"
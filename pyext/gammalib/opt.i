@@ -36,5 +36,6 @@
 /* __ Optimizer module ___________________________________________________ */
 %include "GOptimizer.i"
 %include "GOptimizerLM.i"
+%include "GOptimizerLBFGS.i"
 %include "GOptimizerPars.i"
 //%include "GOptimizerFunction.i"
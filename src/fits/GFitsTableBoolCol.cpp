@@ -164,8 +164,11 @@ bool& GFitsTableBoolCol::operator() (const int& row, const int& inx)
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return data bin
-    return m_data[offset(row, inx)];
+    return m_data[index];
 }
 
 
@@ -184,8 +187,11 @@ const bool& GFitsTableBoolCol::operator() (const int& row, const int& inx) const
         const_cast<GFitsTableBoolCol*>(this)->fetch_data();
     }
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return data bin
-    return m_data[offset(row, inx)];
+    return m_data[index];
 }
 
 
@@ -237,8 +243,11 @@ std::string GFitsTableBoolCol::string(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert bool into string
-    std::string result = (m_data[offset(row,inx)]) ? "T" : "F";
+    std::string result = (m_data[index]) ? "T" : "F";
 
     // Return value
     return result;
@@ -258,8 +267,11 @@ double GFitsTableBoolCol::real(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert bool into double
-    double value = (double)m_data[offset(row,inx)];
+    double value = (double)m_data[index];
 
     // Return value
     return value;
@@ -279,8 +291,11 @@ int GFitsTableBoolCol::integer(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert bool into int
-    int value = (int)m_data[offset(row,inx)];
+    int value = (int)m_data[index];
 
     // Return value
     return value;
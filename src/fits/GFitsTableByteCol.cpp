@@ -164,8 +164,11 @@ unsigned char& GFitsTableByteCol::operator() (const int& row, const int& inx)
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return data bin
-    return m_data[offset(row, inx)];
+    return m_data[index];
 }
 
 
@@ -184,8 +187,11 @@ const unsigned char& GFitsTableByteCol::operator() (const int& row, const int& i
         const_cast<GFitsTableByteCol*>(this)->fetch_data();
     }
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return data bin
-    return m_data[offset(row, inx)];
+    return m_data[index];
 }
 
 
@@ -237,9 +243,12 @@ std::string GFitsTableByteCol::string(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert unsigned char into string
     std::ostringstream s_value;
-    s_value << m_data[offset(row,inx)];
+    s_value << m_data[index];
 
     // Return value
     return s_value.str();
@@ -259,8 +268,11 @@ double GFitsTableByteCol::real(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert unsigned char into double
-    double value = (double)m_data[offset(row,inx)];
+    double value = (double)m_data[index];
 
     // Return value
     return value;
@@ -280,8 +292,11 @@ int GFitsTableByteCol::integer(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert unsigned char into int
-    int value = (int)m_data[offset(row,inx)];
+    int value = (int)m_data[index];
 
     // Return value
     return value;
@@ -320,8 +335,9 @@ void GFitsTableByteCol::insert(const int& rownum, const int& nrows)
         // the existing items
         else {
 
-            // If data are not available then load them now
-            if (m_data == NULL) fetch_data();
+            // If data are not available or only a page is in memory then load
+            // the entire column now
+            if (m_data == NULL || m_paged) load_column();
 
             // Compute new column length
             int length = m_length + nrows;
@@ -397,8 +413,9 @@ void GFitsTableByteCol::remove(const int& rownum, const int& nrows)
     // Continue only if there are rows to be removed
     if (nrows > 0) {
     
-        // If data are not available then load them now
-        if (m_data == NULL) fetch_data();
+        // If data are not available or only a page is in memory then load
+        // the entire column now
+        if (m_data == NULL || m_paged) load_column();
 
         // Compute new column length
         int length = m_length - nrows;
@@ -163,8 +163,11 @@ GFits::cdouble& GFitsTableCDoubleCol::operator() (const int& row, const int& inx
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return data bin
-    return m_data[offset(row, inx)];
+    return m_data[index];
 }
 
 
@@ -184,8 +187,11 @@ const GFits::cdouble& GFitsTableCDoubleCol::operator() (const int& row,
         const_cast<GFitsTableCDoubleCol*>(this)->fetch_data();
     }
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return data bin
-    return m_data[offset(row, inx)];
+    return m_data[index];
 }
 
 
@@ -237,9 +243,12 @@ std::string GFitsTableCDoubleCol::string(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert complex into string
-    std::string result = str(m_data[offset(row,inx)].re) + ", " +
-                         str(m_data[offset(row,inx)].im);
+    std::string result = str(m_data[index].re) + ", " +
+                         str(m_data[index].im);
 
     // Return result
     return result;
@@ -259,8 +268,11 @@ double GFitsTableCDoubleCol::real(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert complex into double
-    double value = (double)m_data[offset(row,inx)].re;
+    double value = (double)m_data[index].re;
 
     // Return value
     return value;
@@ -280,8 +292,11 @@ int GFitsTableCDoubleCol::integer(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Convert complex into int
-    int value = (int)m_data[offset(row,inx)].re;
+    int value = (int)m_data[index].re;
 
     // Return value
     return value;
@@ -320,8 +335,9 @@ void GFitsTableCDoubleCol::insert(const int& rownum, const int& nrows)
         // the existing items
         else {
 
-            // If data are not available then load them now
-            if (m_data == NULL) fetch_data();
+            // If data are not available or only a page is in memory then load
+            // the entire column now
+            if (m_data == NULL || m_paged) load_column();
 
             // Compute new column length
             int length = m_length + nrows;
@@ -399,8 +415,9 @@ void GFitsTableCDoubleCol::remove(const int& rownum, const int& nrows)
     // Continue only if there are rows to be removed
     if (nrows > 0) {
     
-        // If data are not available then load them now
-        if (m_data == NULL) fetch_data();
+        // If data are not available or only a page is in memory then load
+        // the entire column now
+        if (m_data == NULL || m_paged) load_column();
 
         // Compute new column length
         int length = m_length - nrows;
@@ -28,15 +28,17 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <cstdlib>
 #include "GException.hpp"
 #include "GFitsCfitsio.hpp"
 #include "GFitsTableCol.hpp"
 #include "GTools.hpp"
 
 /* __ Method name definitions ____________________________________________ */
-#define G_LOAD_COLUMN                          "GFitsTableCol::load_column()"
 #define G_SAVE_COLUMN                          "GFitsTableCol::save_column()"
 #define G_OFFSET                           "GFitsTableCol::offset(int&,int&)"
+#define G_PAGE                                   "GFitsTableCol::page(int&)"
+#define G_LOAD_ROWS                     "GFitsTableCol::load_rows(int&,int&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -333,6 +335,70 @@ int GFitsTableCol::anynul(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Set number of rows per page
+ *
+ * @param[in] nrows Number of rows per page (0=load entire column).
+ *
+ * @exception GException::invalid_argument
+ *            Negative number of rows specified.
+ *
+ * Sets the number of rows that are held in memory for a column that is
+ * attached to a FITS file. If a positive number of rows is specified, only
+ * the page of rows that contains the accessed row is loaded from the FITS
+ * file, and a new page is loaded once a row outside the actual page is
+ * accessed. This bounds the memory needed for large tables to the page
+ * size.
+ *
+ * Paged columns are meant for read access. Modifications of column
+ * elements are only kept as long as the page is held in memory, and
+ * references returned by the column access operators are only valid until
+ * a row of another page is accessed. Inserting
+ * or removing rows, and copying the column, loads the entire column.
+ * Paging is not supported for bit, logical and string columns, which are
+ * always loaded entirely.
+ *
+ * If the page size is changed while a page is held in memory, the data
+ * are reloaded according to the new page size.
+ ***************************************************************************/
+void GFitsTableCol::page(const int& nrows)
+{
+    // Throw an exception if the number of rows is negative
+    if (nrows < 0) {
+        throw GException::invalid_argument(G_PAGE,
+              "Number of rows per page must be non-negative (nrows="+
+              str(nrows)+").");
+    }
+
+    // Set number of rows per page
+    m_page = nrows;
+
+    // If only a page of the column is in memory then reload the data
+    // according to the new page size
+    if (m_paged) {
+        if (m_page > 0 && m_page < m_length) {
+            load_page(m_first);
+        }
+        else {
+            load_column();
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns number of rows per page (0=no paging)
+ ***************************************************************************/
+int GFitsTableCol::page(void) const
+{
+    // Return number of rows per page
+    return m_page;
+}
+
+
 /***********************************************************************//**
  * @brief Print column information
  *
@@ -366,6 +432,9 @@ std::string GFitsTableCol::print(void) const
     if (m_size == 0) {
         result.append("[not loaded] ");
     }
+    else if (m_paged) {
+        result.append("[paged]      ");
+    }
     else {
         result.append("[loaded]     ");
     }
@@ -430,12 +499,19 @@ void GFitsTableCol::save(void)
  * from the FITS file. If no FITS file is attached, memory is allocated
  * to hold the column data and all cells are initialised.
  *
- * This method calls GFitsTableCol::load_column to do the job.
+ * If a page size has been set and paging is supported for the column, only
+ * the first page is loaded using GFitsTableCol::load_page. Otherwise,
+ * GFitsTableCol::load_column is called to load the entire column.
  ***************************************************************************/
 void GFitsTableCol::fetch_data(void) const
 {
-    // Save column (circumvent const correctness)
-    const_cast<GFitsTableCol*>(this)->load_column();
+    // Load page or column (circumvent const correctness)
+    if (pageable()) {
+        load_page(m_first);
+    }
+    else {
+        const_cast<GFitsTableCol*>(this)->load_column();
+    }
 
     // Return
     return;
@@ -463,9 +539,68 @@ void GFitsTableCol::fetch_data(void) const
  * implement a specific storage class (i.e. float, double, short, ...).
  ***************************************************************************/
 void GFitsTableCol::load_column(void)
+{
+    // Signal that the entire column is in memory
+    m_first = 0;
+    m_paged = false;
+
+    // Load all rows
+    load_rows(0, m_length);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Load page of table column from FITS file
+ *
+ * @param[in] row Row that should be contained in the page.
+ *
+ * Loads the page of m_page rows that contains the specified row. The
+ * method is declared const so that it can be called from the const data
+ * access methods.
+ ***************************************************************************/
+void GFitsTableCol::load_page(const int& row) const
+{
+    // Determine first row and number of rows of page
+    int first = (row / m_page) * m_page;
+    int nrows = m_length - first;
+    if (nrows > m_page) {
+        nrows = m_page;
+    }
+
+    // Load page (circumvent const correctness)
+    const_cast<GFitsTableCol*>(this)->load_rows(first, nrows);
+
+    // Store page information
+    m_first = first;
+    m_paged = true;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Load rows of table column from FITS file
+ *
+ * @param[in] first First row to load (starting from 0).
+ * @param[in] nrows Number of rows to load.
+ *
+ * @exception GException::fits_hdu_not_found
+ *            Specified HDU not found in FITS file.
+ * @exception GException::fits_error
+ *            An error occured while loading column data from FITS file.
+ *
+ * Allocates memory for @p nrows rows of the column and loads the rows
+ * starting from @p first from the FITS file, if a FITS file is attached.
+ * Otherwise all cells are set to 0.
+ ***************************************************************************/
+void GFitsTableCol::load_rows(const int& first, const int& nrows)
 {
     // Calculate size of memory
-    m_size = m_number * m_length;
+    m_size = m_number * nrows;
 
     // Load only if the column has a positive size
     if (m_size > 0) {
@@ -495,16 +630,17 @@ void GFitsTableCol::load_column(void)
             
                 // Break on any other cfitsio error
                 if (status != 0) {
-                    throw GException::fits_hdu_not_found(G_LOAD_COLUMN,
+                    throw GException::fits_hdu_not_found(G_LOAD_ROWS,
                                   (FPTR(m_fitsfile)->HDUposition)+1,
                                   status);
                 }
 
                 // Load data
-                status = __ffgcv(FPTR(m_fitsfile), m_type, m_colnum, 1, 1, m_size,
-                                 ptr_nulval(), ptr_data(), &m_anynul, &status);
+                status = __ffgcv(FPTR(m_fitsfile), m_type, m_colnum, first+1, 1,
+                                 m_size, ptr_nulval(), ptr_data(), &m_anynul,
+                                 &status);
                 if (status != 0) {
-                    throw GException::fits_error(G_LOAD_COLUMN, status,
+                    throw GException::fits_error(G_LOAD_ROWS, status,
                                       "for column \""+m_name+"\".");
                 }
         
@@ -519,6 +655,31 @@ void GFitsTableCol::load_column(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Checks whether the column should be loaded in pages
+ *
+ * Paging is used if a page size smaller than the column length has been
+ * set, if the column is attached to a column of a FITS file, and if the
+ * column type is neither bit, logical nor string. The latter types are
+ * converted via transfer buffers and are always loaded entirely.
+ ***************************************************************************/
+bool GFitsTableCol::pageable(void) const
+{
+    // Check page size and FITS file connection
+    bool pageable = (m_page > 0 && m_page < m_length && m_colnum > 0 &&
+                     FPTR(m_fitsfile)->Fptr != NULL);
+
+    // Exclude column types that are not supported
+    if (pageable) {
+        int type = std::abs(m_type);
+        pageable = (type != __TBIT && type != __TLOGICAL && type != __TSTRING);
+    }
+
+    // Return
+    return pageable;
+}
+
+
 /***********************************************************************//**
  * @brief Save table column into FITS file
  *
@@ -554,7 +715,7 @@ void GFitsTableCol::save_column(void)
         }
 
         // Save the column data
-        status = __ffpcn(FPTR(m_fitsfile), m_type, m_colnum, 1, 1,
+        status = __ffpcn(FPTR(m_fitsfile), m_type, m_colnum, m_first+1, 1,
                          m_size, ptr_data(), ptr_nulval(), &status);
         if (status != 0) {
             throw GException::fits_error(G_SAVE_COLUMN, status);
@@ -595,8 +756,21 @@ int GFitsTableCol::offset(const int& row, const int& inx) const
     }
     #endif
 
-    // Calculate pixel offset
-    int offset = row * m_number + inx;
+    // If only a page of the column is in memory then load the page that
+    // contains the row if needed and compute the offset relative to the
+    // first row of the page
+    int offset;
+    if (m_paged) {
+        if (row < m_first || row >= m_first + m_page) {
+            load_page(row);
+        }
+        offset = (row - m_first) * m_number + inx;
+    }
+
+    // ... otherwise calculate pixel offset
+    else {
+        offset = row * m_number + inx;
+    }
 
     // Return offset
     return offset;
@@ -631,6 +805,9 @@ void GFitsTableCol::init_members(void)
     m_length = 0;
     m_size   = 0;
     m_anynul = 0;
+    m_page   = 0;
+    m_first  = 0;
+    m_paged  = false;
 
     // Return
     return;
@@ -644,6 +821,14 @@ void GFitsTableCol::init_members(void)
  ***************************************************************************/
 void GFitsTableCol::copy_members(const GFitsTableCol& column)
 {
+    // If only a page of the source column is in memory, or if the source
+    // column would be loaded in pages, then load the entire column. The
+    // copy may be attached to another FITS file (for example when saving
+    // into a new file), hence it needs all data.
+    if (column.m_paged || (column.m_size == 0 && column.pageable())) {
+        const_cast<GFitsTableCol*>(&column)->load_column();
+    }
+
     // Copy attributes
     m_name     = column.m_name;
     m_unit     = column.m_unit;
@@ -656,6 +841,9 @@ void GFitsTableCol::copy_members(const GFitsTableCol& column)
     m_length   = column.m_length;
     m_size     = column.m_size;
     m_anynul   = column.m_anynul;
+    m_page     = column.m_page;
+    m_first    = column.m_first;
+    m_paged    = column.m_paged;
     FPTR_COPY(m_fitsfile, column.m_fitsfile);
 
     // Return
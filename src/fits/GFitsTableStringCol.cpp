@@ -167,8 +167,11 @@ std::string& GFitsTableStringCol::operator() (const int& row, const int& inx)
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return data bin
-    return m_data[offset(row, inx)];
+    return m_data[index];
 }
 
 
@@ -185,8 +188,11 @@ const std::string& GFitsTableStringCol::operator() (const int& row, const int& i
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return data bin
-    return m_data[offset(row, inx)];
+    return m_data[index];
 }
 
 
@@ -238,8 +244,11 @@ std::string GFitsTableStringCol::string(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Return value
-    return m_data[offset(row,inx)];
+    return m_data[index];
 }
 
 
@@ -256,8 +265,11 @@ double GFitsTableStringCol::real(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Assign string to double
-    double value = todouble(m_data[offset(row,inx)]);
+    double value = todouble(m_data[index]);
 
     // Return value
     return value;
@@ -277,8 +289,11 @@ int GFitsTableStringCol::integer(const int& row, const int& inx) const
     // If data are not available then load them now
     if (m_data == NULL) fetch_data();
 
+    // Get data offset (this may load another page of the column)
+    int index = offset(row, inx);
+
     // Assign string to int
-    int value = toint(m_data[offset(row,inx)]);
+    int value = toint(m_data[index]);
 
     // Return value
     return value;
@@ -43,6 +43,7 @@
 #define G_OP_ADD                              "GMatrix::operator+=(GMatrix&)"
 #define G_OP_SUB                              "GMatrix::operator-=(GMatrix&)"
 #define G_OP_MAT_MUL                          "GMatrix::operator*=(GMatrix&)"
+#define G_PRODUCT                      "GMatrix::product(GMatrix&, GMatrix&)"
 #define G_INVERT                                          "GMatrix::invert()"
 #define G_ADD_COL                           "GMatrix::add_col(GVector&,int&)"
 #define G_EXTRACT_ROW                            "GMatrix::extract_row(int&)"
@@ -52,6 +53,10 @@
 #define G_INSERT_COL                     "GMatrix::insert_col(GVector&,int&)"
 #define G_ALLOC_MEMBERS                   "GMatrix::alloc_members(int&,int&)"
 
+/* __ Coding definitions _________________________________________________ */
+#define G_MATRIX_BLOCK         64 //!< Block size for matrix multiplication
+#define G_MATRIX_PARALLEL 1000000 //!< Minimum multiply-adds for threading
+
 
 /*==========================================================================
  =                                                                         =
@@ -299,14 +304,15 @@ GVector GMatrix::operator*(const GVector& vector) const
                                                  m_rows, m_cols);
     }
 
-    // Perform vector multiplication
+    // Perform vector multiplication column by column, so that the matrix
+    // elements are accessed in storage order
     GVector result(m_rows);
-    for (int row = 0; row < m_rows; ++row) {
-        double sum = 0.0;
-        for (int col = 0; col < m_cols; ++col) {
-            sum += (*this)(row,col) * vector[col];
+    for (int col = 0; col < m_cols; ++col) {
+        const double* ptr = m_data + m_colstart[col];
+        double        v   = vector[col];
+        for (int row = 0; row < m_rows; ++row) {
+            result[row] += ptr[row] * v;
         }
-        result[row] = sum;
     }
 
     // Return result
@@ -381,10 +387,8 @@ GMatrix& GMatrix::operator-=(const GMatrix& matrix)
  * This method performs a matrix multiplication. The operation can only
  * succeed when the dimensions of both matrices are compatible.
  *
- * In case of rectangular matrices the result matrix does not change and
- * the operation is performed inplace. For the general case the result
- * matrix changes in size and for simplicity a new matrix is allocated to
- * hold the result.
+ * The product is computed into a new matrix by product() and then
+ * assigned to the actual matrix.
  ***************************************************************************/
 GMatrix& GMatrix::operator*=(const GMatrix& matrix)
 {
@@ -395,41 +399,10 @@ GMatrix& GMatrix::operator*=(const GMatrix& matrix)
                                           matrix.m_rows, matrix.m_cols);
     }
 
-    // Case A: Matrices are rectangular, so perform 'inplace' multiplication
-    if (m_rows == m_cols) {
-        for (int row = 0; row < m_rows; ++row) {
-            GVector v_row = extract_row(row);
-            for (int col = 0; col < m_cols; ++col) {
-                double sum = 0.0;
-                for (int i = 0; i < m_cols; ++i) {
-                    sum += v_row[i] * matrix(i,col);
-                }
-                (*this)(row,col) = sum;
-            }
-        }
-    }
-
-    // Case B: Matrices are not rectangular, so we cannot work inplace
-    else {
-
-        // Allocate result matrix
-        GMatrix result(m_rows, matrix.m_cols);
-
-        // Loop over all elements of result matrix
-        for (int row = 0; row < m_rows; ++row) {
-            for (int col = 0; col < matrix.m_cols; ++col) {
-                double sum = 0.0;
-                for (int i = 0; i < m_cols; ++i) {
-                    sum += (*this)(row,i) * matrix(i,col);
-                }
-                result(row,col) = sum;
-            }
-        }
-
-        // Assign result
-        *this = result;
-
-    } // endelse: matrices were not rectangular
+    // Compute product and assign result
+    GMatrix result(m_rows, matrix.m_cols);
+    product(matrix, result);
+    *this = result;
 
     // Return result
     return *this;
@@ -493,13 +466,20 @@ void GMatrix::transpose(void)
         }
     }
 
-    // Case B: Non-rectangular transpose. No code optimization has been
-    // done so far.
+    // Case B: Non-rectangular transpose. The elements are copied in blocks
+    // so that source and destination stay in cache.
     else {
         GMatrix result(m_cols, m_rows);
-        for (int row = 0; row < m_rows; ++row) {
-            for (int col = 0; col < m_cols; ++col) {
-                result(col, row) = (*this)(row, col);
+        for (int col0 = 0; col0 < m_cols; col0 += G_MATRIX_BLOCK) {
+            int col1 = (col0+G_MATRIX_BLOCK < m_cols) ? col0+G_MATRIX_BLOCK : m_cols;
+            for (int row0 = 0; row0 < m_rows; row0 += G_MATRIX_BLOCK) {
+                int row1 = (row0+G_MATRIX_BLOCK < m_rows) ? row0+G_MATRIX_BLOCK : m_rows;
+                for (int col = col0; col < col1; ++col) {
+                    const double* src = m_data + m_colstart[col];
+                    for (int row = row0; row < row1; ++row) {
+                        result.m_data[result.m_colstart[row]+col] = src[row];
+                    }
+                }
             }
         }
         *this = result;
@@ -1030,6 +1010,83 @@ void GMatrix::alloc_members(const int& rows, const int& cols)
 }
 
 
+/***********************************************************************//**
+ * @brief Compute matrix product
+ *
+ * @param[in] matrix Right hand side matrix.
+ * @param[in,out] result Result matrix (rows x matrix.cols, set to zero).
+ *
+ * @exception GException::matrix_mismatch
+ *            Incompatible matrix size.
+ *
+ * Computes the product of the matrix with @p matrix and adds it to
+ * @p result, which is expected to be zero on input. The product is
+ * computed column by column using blocks of G_MATRIX_BLOCK rows and inner
+ * indices, so that each block of the left hand side matrix is reused for
+ * a block of result columns while it resides in cache. The elements of
+ * each result column are summed in the same order as a straightforward
+ * triple loop, hence the result does not depend on the blocking.
+ *
+ * If the number of multiply-adds exceeds G_MATRIX_PARALLEL, the result
+ * column blocks are distributed over the available threads.
+ ***************************************************************************/
+void GMatrix::product(const GMatrix& matrix, GMatrix& result) const
+{
+    // Raise an exception if the matrix dimensions are not compatible
+    if (m_cols != matrix.m_rows ||
+        result.m_rows != m_rows || result.m_cols != matrix.m_cols) {
+        throw GException::matrix_mismatch(G_PRODUCT,
+                                          m_rows, m_cols,
+                                          matrix.m_rows, matrix.m_cols);
+    }
+
+    // Get dimensions
+    int nrows   = m_rows;
+    int ninner  = m_cols;
+    int ncols   = matrix.m_cols;
+    int nblocks = (ncols + G_MATRIX_BLOCK - 1) / G_MATRIX_BLOCK;
+
+    // Decide whether the product is large enough for multi-threading
+    bool parallel = (double(nrows) * double(ninner) * double(ncols) >
+                     double(G_MATRIX_PARALLEL));
+
+    // Loop over blocks of result columns
+    #pragma omp parallel for if(parallel) schedule(dynamic)
+    for (int block = 0; block < nblocks; ++block) {
+
+        // Determine column range
+        int col0 = block * G_MATRIX_BLOCK;
+        int col1 = (col0+G_MATRIX_BLOCK < ncols) ? col0+G_MATRIX_BLOCK : ncols;
+
+        // Loop over blocks of inner indices and rows
+        for (int k0 = 0; k0 < ninner; k0 += G_MATRIX_BLOCK) {
+            int k1 = (k0+G_MATRIX_BLOCK < ninner) ? k0+G_MATRIX_BLOCK : ninner;
+            for (int row0 = 0; row0 < nrows; row0 += G_MATRIX_BLOCK) {
+                int row1 = (row0+G_MATRIX_BLOCK < nrows) ? row0+G_MATRIX_BLOCK : nrows;
+
+                // Add block contribution to all columns of column block
+                for (int col = col0; col < col1; ++col) {
+                    double*       dst = result.m_data + result.m_colstart[col];
+                    const double* rhs = matrix.m_data + matrix.m_colstart[col];
+                    for (int k = k0; k < k1; ++k) {
+                        const double* src = m_data + m_colstart[k];
+                        double        f   = rhs[k];
+                        for (int row = row0; row < row1; ++row) {
+                            dst[row] += src[row] * f;
+                        }
+                    }
+                }
+
+            } // endfor: looped over row blocks
+        } // endfor: looped over inner index blocks
+
+    } // endfor: looped over column blocks
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                           Friend functions                              =
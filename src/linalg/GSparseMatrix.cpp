@@ -1277,62 +1277,70 @@ GVector GSparseMatrix::extract_col(const int& col) const
  ***************************************************************************/
 void GSparseMatrix::cholesky_decompose(bool compress)
 {
-    // Save original matrix size
-    int matrix_rows = m_rows;
-    int matrix_cols = m_cols;
-
-    // Delete any existing symbolic and numeric analysis object and reset
-    // pointers
-    if (m_symbolic != NULL) delete m_symbolic;
-    if (m_numeric  != NULL) delete m_numeric;
-    m_symbolic = NULL;
-    m_numeric  = NULL;
+    // Perform decomposition with a new symbolic analysis
+    cholesky_factorise(NULL, compress);
 
-    // Allocate symbolic analysis object
-    GSparseSymbolic* symbolic = new GSparseSymbolic();
+    // Return
+    return;
+}
 
-    // Declare numeric analysis object. We don't allocate one since we'll
-    // throw it away at the end of the function (the L matrix will be copied
-    // in this object)
-    GSparseNumeric numeric;
 
-    // Fill pending element into matrix
-    fill_pending();
+/***********************************************************************//**
+ * @brief Perform a Cholesky decomposition reusing a symbolic analysis
+ *
+ * @param[in] factor Previously Cholesky decomposed matrix.
+ * @param[in] compress Use zero-row/column compression (default: true).
+ *
+ * Cholesky decomposition of a sparse matrix that reuses the ordering and
+ * symbolic analysis of a matrix that has been decomposed before, provided
+ * that both matrices have the same sparsity pattern (after compression).
+ * This avoids repeating the symbolic analysis when a sequence of matrices
+ * with identical structure but different values is decomposed, as is the
+ * case for the curvature matrix over the iterations of an optimizer. If
+ * the patterns differ, or if @p factor has not been decomposed, a new
+ * symbolic analysis is performed. In any case the result is identical to
+ * that of cholesky_decompose(bool).
+ ***************************************************************************/
+void GSparseMatrix::cholesky_decompose(const GSparseMatrix& factor,
+                                       bool compress)
+{
+    // Perform decomposition reusing the symbolic analysis of the factor
+    cholesky_factorise(factor.m_symbolic, compress);
 
-    // Remove rows and columns containing only zeros if matrix compression
-    // has been selected
-    if (compress) {
-        remove_zero_row_col();
-    }
+    // Return
+    return;
+}
 
-    // Ordering an symbolic analysis of matrix. This sets up an array 'pinv'
-    // which contains the fill-in reducing permutations
-    symbolic->cholesky_symbolic_analysis(1, *this);
 
-    // Store symbolic pointer in sparse matrix object
-    m_symbolic = symbolic;
+/***********************************************************************//**
+ * @brief Keep symbolic analysis of a Cholesky decomposition
+ *
+ * @param[in] factor Previously Cholesky decomposed matrix.
+ *
+ * Sets the matrix to an empty matrix of the dimension of @p factor that
+ * only holds a copy of the ordering and symbolic analysis of @p factor.
+ * The matrix can then be passed to cholesky_decompose(const GSparseMatrix&,
+ * bool) to reuse the symbolic analysis without keeping the elements of the
+ * decomposition.
+ ***************************************************************************/
+void GSparseMatrix::cholesky_symbolic(const GSparseMatrix& factor)
+{
+    // Protect against self-assignment
+    if (this != &factor) {
 
-    // Perform numeric Cholesky decomposition
-    numeric.cholesky_numeric_analysis(*this, *symbolic);
+        // Set empty matrix of same dimension
+        *this = GSparseMatrix(factor.m_rows, factor.m_cols);
 
-    // Copy L matrix into this object
-    free_elements(0, m_elements);
-    alloc_elements(0, numeric.m_L->m_elements);
-    for (int i = 0; i < m_elements; ++i) {
-        m_data[i]   = numeric.m_L->m_data[i];
-        m_rowinx[i] = numeric.m_L->m_rowinx[i];
-    }
-    for (int col = 0; col <= m_cols; ++col) {
-        m_colstart[col] = numeric.m_L->m_colstart[col];
-    }
+        // Copy symbolic analysis
+        if (factor.m_symbolic != NULL) {
+            m_symbolic  = new GSparseSymbolic();
+            *m_symbolic = *factor.m_symbolic;
+        }
 
-    // Insert zero rows and columns if they have been removed previously.
-    if (compress) {
-        insert_zero_row_col(matrix_rows, matrix_cols);
-    }
+    } // endif: object was not the same
 
-  // Return
-  return;
+    // Return
+    return;
 }
 
 
@@ -1778,6 +1786,53 @@ std::string GSparseMatrix::print(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Set all matrix elements to zero
+ *
+ * Removes all elements from the matrix and discards any decomposition. The
+ * matrix dimension, the allocated element memory and the matrix filling
+ * stack are kept, hence a matrix that is filled repeatedly (for example a
+ * curvature matrix that is computed in each iteration of an optimizer)
+ * does not need to be reallocated.
+ ***************************************************************************/
+void GSparseMatrix::zero(void)
+{
+    // Discard decomposition
+    if (m_numeric  != NULL) delete m_numeric;
+    if (m_symbolic != NULL) delete m_symbolic;
+    if (m_rowsel   != NULL) delete [] m_rowsel;
+    if (m_colsel   != NULL) delete [] m_colsel;
+    m_numeric    = NULL;
+    m_symbolic   = NULL;
+    m_rowsel     = NULL;
+    m_colsel     = NULL;
+    m_num_rowsel = 0;
+    m_num_colsel = 0;
+
+    // Discard pending element
+    m_fill_val = 0.0;
+    m_fill_row = 0;
+    m_fill_col = 0;
+
+    // Remove all elements
+    m_elements = 0;
+    if (m_colstart != NULL) {
+        for (int col = 0; col <= m_cols; ++col) {
+            m_colstart[col] = 0;
+        }
+    }
+
+    // Empty stack
+    if (m_stack_data != NULL) {
+        m_stack_entries  = 0;
+        m_stack_start[0] = 0;
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Initialises matrix filling stack
  *
@@ -2608,6 +2663,85 @@ void GSparseMatrix::fill_pending(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Perform a Cholesky decomposition
+ *
+ * @param[in] reuse Symbolic analysis to reuse (NULL if none).
+ * @param[in] compress Use zero-row/column compression.
+ *
+ * Performs the Cholesky decomposition of the matrix. If @p reuse is not
+ * NULL and has been obtained for a matrix with the same sparsity pattern,
+ * the symbolic analysis is copied from @p reuse instead of being redone.
+ ***************************************************************************/
+void GSparseMatrix::cholesky_factorise(const GSparseSymbolic* reuse,
+                                       bool compress)
+{
+    // Save original matrix size
+    int matrix_rows = m_rows;
+    int matrix_cols = m_cols;
+
+    // Allocate symbolic analysis object. If a symbolic analysis should be
+    // reused we copy it now since it may be owned by this object
+    GSparseSymbolic* symbolic = new GSparseSymbolic();
+    if (reuse != NULL) {
+        *symbolic = *reuse;
+    }
+
+    // Delete any existing symbolic and numeric analysis object and reset
+    // pointers
+    if (m_symbolic != NULL) delete m_symbolic;
+    if (m_numeric  != NULL) delete m_numeric;
+    m_symbolic = NULL;
+    m_numeric  = NULL;
+
+    // Declare numeric analysis object. We don't allocate one since we'll
+    // throw it away at the end of the function (the L matrix will be copied
+    // in this object)
+    GSparseNumeric numeric;
+
+    // Fill pending element into matrix
+    fill_pending();
+
+    // Remove rows and columns containing only zeros if matrix compression
+    // has been selected
+    if (compress) {
+        remove_zero_row_col();
+    }
+
+    // Ordering an symbolic analysis of matrix. This sets up an array 'pinv'
+    // which contains the fill-in reducing permutations. The analysis is
+    // skipped if the reused analysis matches the sparsity pattern
+    if (reuse == NULL || !symbolic->matches(*this)) {
+        symbolic->cholesky_symbolic_analysis(1, *this);
+    }
+
+    // Store symbolic pointer in sparse matrix object
+    m_symbolic = symbolic;
+
+    // Perform numeric Cholesky decomposition
+    numeric.cholesky_numeric_analysis(*this, *symbolic);
+
+    // Copy L matrix into this object
+    free_elements(0, m_elements);
+    alloc_elements(0, numeric.m_L->m_elements);
+    for (int i = 0; i < m_elements; ++i) {
+        m_data[i]   = numeric.m_L->m_data[i];
+        m_rowinx[i] = numeric.m_L->m_rowinx[i];
+    }
+    for (int col = 0; col <= m_cols; ++col) {
+        m_colstart[col] = numeric.m_L->m_colstart[col];
+    }
+
+    // Insert zero rows and columns if they have been removed previously.
+    if (compress) {
+        insert_zero_row_col(matrix_rows, matrix_cols);
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Allocate memory for new matrix elements
  *
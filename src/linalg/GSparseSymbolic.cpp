@@ -66,6 +66,8 @@ GSparseSymbolic::GSparseSymbolic()
   m_m2         = 0;
   m_lnz        = 0.0;
   m_unz        = 0.0;
+  m_pattern_rows = 0;
+  m_pattern_cols = 0;
 
   // Return
   return;
@@ -129,6 +131,12 @@ GSparseSymbolic& GSparseSymbolic::operator= (const GSparseSymbolic& s)
       m_m2  = s.m_m2;
       m_lnz = s.m_lnz;
       m_unz = s.m_unz;
+
+      // Copy sparsity pattern of analysed matrix
+      m_pattern_rows     = s.m_pattern_rows;
+      m_pattern_cols     = s.m_pattern_cols;
+      m_pattern_colstart = s.m_pattern_colstart;
+      m_pattern_rowinx   = s.m_pattern_rowinx;
 	
 	  // Copy m_pinv array if it exists
 	  if (s.m_pinv != NULL && s.m_n_pinv > 0) {
@@ -226,6 +234,10 @@ void GSparseSymbolic::cholesky_symbolic_analysis(int order,
   m_m2         = 0;
   m_lnz        = 0.0;
   m_unz        = 0.0;
+  m_pattern_rows = 0;
+  m_pattern_cols = 0;
+  m_pattern_colstart.clear();
+  m_pattern_rowinx.clear();
 
   // Check if order type is valid
   if (order < 0 || order > 1)
@@ -353,6 +365,14 @@ void GSparseSymbolic::cholesky_symbolic_analysis(int order,
     m_unz        = 0.0;
   }
 
+  // ... otherwise keep the sparsity pattern of the analysed matrix
+  else {
+    m_pattern_rows = m.m_rows;
+    m_pattern_cols = m.m_cols;
+    m_pattern_colstart.assign(m.m_colstart, m.m_colstart + m.m_cols + 1);
+    m_pattern_rowinx.assign(m.m_rowinx, m.m_rowinx + m.m_colstart[m.m_cols]);
+  }
+
   // Debug
   #if defined(G_DEBUG_SPARSE_CHOLESKY)
   cout << "GSparseSymbolic::cholesky_symbolic_analysis finished" << endl;
@@ -363,6 +383,43 @@ void GSparseSymbolic::cholesky_symbolic_analysis(int order,
 }
 
 
+/***************************************************************************
+ *               Check whether matrix has the analysed pattern             *
+ * ----------------------------------------------------------------------- *
+ * Returns true if the matrix has the same dimension and the same sparsity *
+ * pattern as the matrix for which the symbolic analysis was done. In that *
+ * case the analysis can be reused for a numeric factorisation of the      *
+ * matrix. The check is linear in the number of matrix elements.           *
+ * ----------------------------------------------------------------------- *
+ * Input:   m                  Sparse matrix                               *
+ ***************************************************************************/
+bool GSparseSymbolic::matches(const GSparseMatrix& m) const
+{
+  // Check dimensions and number of elements
+  if (m_pattern_colstart.empty()         ||
+      m.m_rows != m_pattern_rows         ||
+      m.m_cols != m_pattern_cols         ||
+      m.m_colstart[m.m_cols] != m_pattern_colstart[m_pattern_cols])
+    return false;
+
+  // Check column start indices
+  for (int col = 0; col <= m.m_cols; ++col) {
+    if (m.m_colstart[col] != m_pattern_colstart[col])
+      return false;
+  }
+
+  // Check row indices
+  int elements = m.m_colstart[m.m_cols];
+  for (int i = 0; i < elements; ++i) {
+    if (m.m_rowinx[i] != m_pattern_rowinx[i])
+      return false;
+  }
+
+  // Return
+  return true;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                     GSparseSymbolic private functions                   =
@@ -28,6 +28,7 @@
 #define GSPARSESYMBOLIC_HPP
 
 /* __ Includes ___________________________________________________________ */
+#include <vector>
 
 /* __ Definitions ________________________________________________________ */
 
@@ -46,7 +47,10 @@ double        cs_cumsum(int* p, int* c, int n);
  *
  * @brief Sparse matrix symbolic analysis class
  *
- * This class implements the symbolic analysis of a sparse matrix.
+ * This class implements the symbolic analysis of a sparse matrix. The
+ * sparsity pattern of the analysed matrix is kept, so that the analysis
+ * can be reused for the numeric factorisation of any matrix with the same
+ * pattern (see matches()).
  ***************************************************************************/
 class GSparseSymbolic {
 
@@ -68,6 +72,7 @@ public:
 
     // Methods
     void cholesky_symbolic_analysis(int order, const GSparseMatrix& m);
+    bool matches(const GSparseMatrix& m) const;
 
 private:
     // Private methods
@@ -97,6 +102,10 @@ private:
     int    m_n_parent;    //!< Number of elements in m_parent
     int    m_n_cp;        //!< Number of elements in m_cp
     int    m_n_leftmost;  //!< Number of elements in m_leftmost
+    int    m_pattern_rows;     //!< Number of rows of analysed matrix
+    int    m_pattern_cols;     //!< Number of columns of analysed matrix
+    std::vector<int> m_pattern_colstart; //!< Column start indices of analysed matrix
+    std::vector<int> m_pattern_rowinx;   //!< Row indices of analysed matrix
 };
 
 #endif /* GSPARSESYMBOLIC_HPP */
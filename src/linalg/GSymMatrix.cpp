@@ -56,6 +56,10 @@
 #define G_COPY_MEMBERS                "GSymMatrix::copy_members(GSymMatrix&)"
 #define G_ALLOC_MEMBERS                "GSymMatrix::alloc_members(int&,int&)"
 
+/* __ Coding definitions _________________________________________________ */
+#define G_CHOL_BLOCK          256 //!< Row block size for Cholesky update
+#define G_CHOL_PARALLEL    100000 //!< Minimum multiply-adds for threading
+
 
 /*==========================================================================
  =                                                                         =
@@ -657,27 +661,48 @@ void GSymMatrix::cholesky_decompose(bool compress)
     // Case A: no zero-row/col compression needed
     if (no_zeros) {
 
-        // Loop over upper triangle (col >= row)
-        double diag = 0.0;
-        for (int row = 0; row < m_rows; ++row) {
-            double* ptr = m_data + m_colstart[row];
-            for (int col = row; col < m_cols; ++col, ++ptr) {
-                double sum = *ptr;                         // sum = M(row,col)
-                for (int k = 0; k < row; ++k) {
-                    int offset = m_colstart[k] - k;        // is always positive
-                    sum -= m_data[offset+row] * m_data[offset+col]; // sum -= M(row,k)*M(col,k)
-                }
-                if (row == col) {
-                    if (sum <= 0.0) {
-                        throw GException::matrix_not_pos_definite(G_CHOL_DECOMP, row, sum);
+        // Compute the decomposition column by column. Column col of the
+        // lower triangle is stored contiguously, hence the contributions
+        // of all previous columns can be subtracted in storage order.
+        for (int col = 0; col < m_cols; ++col) {
+
+            // Get pointer to column and number of elements in column
+            double* ptr = m_data + m_colstart[col];        // ptr[i] = M(col+i,col)
+            int     len = m_rows - col;
+
+            // Decide whether the update is large enough for threading
+            bool parallel = (double(col) * double(len) > double(G_CHOL_PARALLEL));
+
+            // Subtract contributions of previous columns. The rows are
+            // processed in blocks, and the columns are summed in ascending
+            // order for each element.
+            #pragma omp parallel for if(parallel) schedule(static)
+            for (int i0 = 0; i0 < len; i0 += G_CHOL_BLOCK) {
+                int i1 = (i0+G_CHOL_BLOCK < len) ? i0+G_CHOL_BLOCK : len;
+                for (int k = 0; k < col; ++k) {
+                    const double* ptr_k = m_data + m_colstart[k] + (col-k);
+                    double        f     = ptr_k[0];            // M(col,k)
+                    for (int i = i0; i < i1; ++i) {
+                        ptr[i] -= ptr_k[i] * f;                // M(col+i,col) -= M(col+i,k)*M(col,k)
                     }
-                    *ptr = sqrt(sum);                      // M(row,row) = sqrt(sum)
-                    diag = 1.0/(*ptr);
                 }
-                else
-                    *ptr = sum*diag;                       // M(row,col) = sum/M(row,row)
             }
-        }
+
+            // Compute diagonal element
+            double sum = ptr[0];
+            if (sum <= 0.0) {
+                throw GException::matrix_not_pos_definite(G_CHOL_DECOMP, col, sum);
+            }
+            ptr[0]      = sqrt(sum);                       // M(col,col) = sqrt(sum)
+            double diag = 1.0/ptr[0];
+
+            // Scale off-diagonal elements
+            for (int i = 1; i < len; ++i) {
+                ptr[i] *= diag;                            // M(col+i,col) = sum/M(col,col)
+            }
+
+        } // endfor: looped over columns
+
     } // endif: there were no zero rows/cols in matrix
 
     // Case B: zero-row/col compression needed
@@ -1233,20 +1258,9 @@ GMatrix GSymMatrix::operator*(const GSymMatrix& matrix) const
                                           matrix.m_rows, matrix.m_cols);
     }
 
-    // Allocate result matrix
-    GMatrix result(m_rows, matrix.m_cols);
+    // Compute product using the blocked generic matrix multiplication
+    GMatrix result = GMatrix(*this) * GMatrix(matrix);
 
-    // Loop over all elements of result matrix
-    for (int row = 0; row < m_rows; ++row) {
-        for (int col = 0; col < matrix.m_cols; ++col) {
-            double sum = 0.0;
-            for (int i = 0; i < m_cols; ++i) {
-                sum += (*this)(row,i) * matrix(i,col);
-            }
-            result(row,col) = sum;
-        }
-    }
-    
     // Return result
     return result;
 }
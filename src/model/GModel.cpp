@@ -31,6 +31,8 @@
 #include "GTools.hpp"
 #include "GException.hpp"
 #include "GModel.hpp"
+#include "GObservation.hpp"
+#include "GEvents.hpp"
 
 /* __ Method name definitions ____________________________________________ */
 #define G_ACCESS1                                  "GModel::operator[](int&)"
@@ -429,6 +431,63 @@ bool GModel::isvalid(const std::string& instrument,
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate model and parameter gradients for a range of events
+ *
+ * @param[in] obs Observation.
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[out] values Model values (iend-ibegin elements).
+ * @param[out] gradients Parameter gradients ((iend-ibegin)*size() elements).
+ * @param[in] view Event view of the events container (optional).
+ *
+ * Evaluates the model and its parameter gradients for the events
+ * [ibegin,iend[ of the observation. The model value for event ibegin+i is
+ * stored in values[i], the gradient of parameter k for that event in
+ * gradients[i*size()+k]. Gradients are taken from the model parameters
+ * after evaluation, hence they are only meaningful for parameters that
+ * have analytical gradients.
+ *
+ * This default implementation simply calls eval_gradients() for every
+ * event. On return, the parameter gradients of the model correspond to
+ * the last event of the range.
+ *
+ * The events are accessed through the event view @p view that has been
+ * allocated by GEvents::view(). Several threads may hence evaluate
+ * different event ranges of the same observation concurrently, provided
+ * that each thread uses its own view and model.
+ ***************************************************************************/
+void GModel::eval_gradients_range(const GObservation& obs,
+                                  const int&          ibegin,
+                                  const int&          iend,
+                                  double*             values,
+                                  double*             gradients,
+                                  GEvent*             view) const
+{
+    // Get number of parameters
+    int npars = size();
+
+    // Loop over events
+    for (int i = ibegin; i < iend; ++i, ++values, gradients += npars) {
+
+        // Get event pointer
+        const GEvent* event = obs.events()->event(i, view);
+
+        // Evaluate model
+        *values = eval_gradients(*event, obs);
+
+        // Store parameter gradients
+        for (int k = 0; k < npars; ++k) {
+            gradients[k] = m_pars[k]->gradient();
+        }
+
+    } // endfor: looped over events
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
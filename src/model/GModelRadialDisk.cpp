@@ -263,16 +263,39 @@ double GModelRadialDisk::eval(const double& theta) const
 /***********************************************************************//**
  * @brief Evaluate function and gradients (in units of sr^-1)
  *
- * @param[in] theta Angular distance from shell centre (radians).
+ * @param[in] theta Angular distance from disk centre (radians).
+ *
+ * Evaluates the function value (see GModelRadialDisk::eval()) and sets
+ * the gradient of the disk radius parameter. Within the disk, the function
+ * value is the normalization \f${\tt m\_norm}\f$, hence the gradient with
+ * respect to the radius \f$r=r_s r_v\f$ (in radians) is
+ * \f[\frac{df}{dr_v} = -{\tt m\_norm} \frac{\sin r}{1 - \cos r} r_s\f]
+ * for \f$\theta \le r\f$, and zero otherwise.
  *
- * Evaluates the function value. No gradient computation is implemented as
- * radial models will be convolved with the instrument response and thus
- * require the numerical computation of the derivatives.
+ * Note that the gradient does not include the Dirac contribution from the
+ * displacement of the disk edge. This contribution needs to be taken into
+ * account when the model is convolved with the instrument response (see
+ * GResponse::irf_gradients()).
+ *
+ * The gradient is only computed if the radius is a free parameter.
  ***************************************************************************/
 double GModelRadialDisk::eval_gradients(const double& theta) const
 {
+    // Compute function value
+    double value = eval(theta);
+
+    // Compute partial derivative of the radius parameter value
+    double g_radius = 0.0;
+    if (m_radius.isfree() && value > 0.0) {
+        g_radius = -value * std::sin(m_radius_rad) /
+                   (1.0 - std::cos(m_radius_rad)) * m_radius.scale() * deg2rad;
+    }
+
+    // Set gradient (circumvent const correctness)
+    const_cast<GModelRadialDisk*>(this)->m_radius.gradient(g_radius);
+
     // Return value
-    return (eval(theta));
+    return value;
 }
 
 
@@ -472,7 +495,7 @@ void GModelRadialDisk::init_members(void)
     m_radius.free();
     m_radius.scale(1.0);
     m_radius.gradient(0.0);
-    m_radius.hasgrad(false);  // Radial components never have gradients
+    m_radius.hasgrad(true);
 
     // Set parameter pointer(s)
     m_pars.push_back(&m_radius);
@@ -264,14 +264,36 @@ double GModelRadialGauss::eval(const double& theta) const
  *
  * @param[in] theta Angular distance from Gaussian centre (radians).
  *
- * This method simply calls GModelRadialShell::eval() as no analytical
- * gradients will be computed. See GModelRadialShell::eval() for details
- * about the implemented method.
+ * Evaluates the function value (see GModelRadialGauss::eval()) and sets
+ * the gradient of the Gaussian width parameter. With \f$\sigma=s_s s_v\f$
+ * being factorised into a scaling factor and a value, the gradient with
+ * respect to the parameter value is given by
+ * \f[\frac{df}{ds_v} = f(\theta) \left( \frac{\theta^2}{\sigma^3} -
+ *    \frac{2}{\sigma} \right) s_s\f]
+ * where \f$\sigma\f$ and \f$\theta\f$ are given in radians (the
+ * conversion factor of the width from degrees to radians is included in
+ * \f$s_s\f$).
+ *
+ * The gradient is only computed if the width is a free parameter.
  ***************************************************************************/
 double GModelRadialGauss::eval_gradients(const double& theta) const
 {
+    // Compute function value
+    double value = eval(theta);
+
+    // Compute partial derivative of the width parameter value
+    double g_sigma = 0.0;
+    if (m_sigma.isfree()) {
+        double sigma_rad = sigma() * deg2rad;
+        g_sigma          = value * (theta * theta / (sigma_rad * sigma_rad) - 2.0) /
+                           sigma_rad * m_sigma.scale() * deg2rad;
+    }
+
+    // Set gradient (circumvent const correctness)
+    const_cast<GModelRadialGauss*>(this)->m_sigma.gradient(g_sigma);
+
     // Return value
-    return (eval(theta));
+    return value;
 }
 
 
@@ -468,9 +490,10 @@ std::string GModelRadialGauss::print(void) const
 /***********************************************************************//**
  * @brief Initialise class members
  *
- * Note that this model implements no gradients, as spatial models will
- * always require numerical gradient computations. The minimum Gaussian
- * width is set to 1 arcsec.
+ * The Gaussian width has an analytical gradient. As the spatial model is
+ * convolved with the instrument response, the gradient of the response is
+ * computed by GResponse::irf_gradients(). The minimum Gaussian width is
+ * set to 1 arcsec.
  ***************************************************************************/
 void GModelRadialGauss::init_members(void)
 {
@@ -484,7 +507,7 @@ void GModelRadialGauss::init_members(void)
     m_sigma.free();
     m_sigma.scale(1.0);
     m_sigma.gradient(0.0);
-    m_sigma.hasgrad(false);  // Radial components never have gradients
+    m_sigma.hasgrad(true);
 
     // Set parameter pointer(s)
     m_pars.push_back(&m_sigma);
@@ -329,14 +329,103 @@ double GModelRadialShell::eval(const double& theta) const
  *
  * @param[in] theta Angular distance from shell centre (radians).
  *
- * This method simply calls GModelRadialShell::eval() as no analytical
- * gradients will be computed. See GModelRadialShell::eval() for details
- * about the implemented method.
+ * Evaluates the function value (see GModelRadialShell::eval()) and sets
+ * the gradients of the shell radius and width parameters.
+ *
+ * Writing the shell profile as
+ * \f$f(\theta) = {\tt m\_norm} \, (S(\theta, \theta_{\rm out}) -
+ *                                  S(\theta, \theta_{\rm in}))\f$,
+ * where \f$S(\theta, r) = \sqrt{r^2 - \theta^2}\f$ (or
+ * \f$\sqrt{\sin^2 r - \sin^2 \theta}\f$ in the general case) for
+ * \f$\theta < r\f$ and zero otherwise, and using the fact that the
+ * normalization is \f${\tt m\_norm} = 1 / (V(\theta_{\rm out}) -
+ * V(\theta_{\rm in}))\f$ with \f$V(r)\f$ the solid angle integral of
+ * \f$S(\theta, r)\f$, the derivatives with respect to the outer and inner
+ * radius are
+ * \f[\frac{df}{d\theta_{\rm out}} =
+ *    -{\tt m\_norm} \, V'(\theta_{\rm out}) f(\theta) +
+ *    {\tt m\_norm} \frac{\partial S(\theta, \theta_{\rm out})}
+ *                        {\partial \theta_{\rm out}}\f]
+ * \f[\frac{df}{d\theta_{\rm in}} =
+ *     {\tt m\_norm} \, V'(\theta_{\rm in}) f(\theta) -
+ *    {\tt m\_norm} \frac{\partial S(\theta, \theta_{\rm in})}
+ *                        {\partial \theta_{\rm in}}\f]
+ * with \f$V'(r) = 2 \pi r^2\f$ in the small angle approximation and
+ * \f$V'(r) = \pi \sin r \cos r \ln((1+\sin r)/(1-\sin r))\f$ in the
+ * general case (see f3()). As \f$\theta_{\rm in}\f$ is the radius and
+ * \f$\theta_{\rm out}\f$ the sum of radius and width, the radius
+ * gradient is the sum of both derivatives while the width gradient is the
+ * derivative with respect to \f$\theta_{\rm out}\f$.
+ *
+ * Note that the derivatives of \f$S(\theta, r)\f$ diverge at the shell
+ * edges, hence the gradients are only evaluated strictly inside the shell
+ * edges. The divergence is integrable, and needs to be taken into account
+ * when the model is convolved with the instrument response (see
+ * GResponse::irf_gradients()).
  ***************************************************************************/
 double GModelRadialShell::eval_gradients(const double& theta) const
 {
+    // Compute function value (this also updates the precomputation cache)
+    double value = eval(theta);
+
+    // Initialise partial derivatives
+    double g_radius = 0.0;
+    double g_width  = 0.0;
+
+    // Continue only if gradients are needed
+    if (m_radius.isfree() || m_width.isfree()) {
+
+        // Set x appropriately for the small angle approximation or not
+        double x;
+        if (m_small_angle) {
+            x = theta * theta;
+        }
+        else {
+            x  = std::sin(theta);
+            x *= x;
+        }
+
+        // Continue only if we are strictly inside the outer edge
+        if (x < m_x_out) {
+
+            // Compute normalization derivatives
+            double dv_out = (m_small_angle) ? twopi * m_x_out : f3(m_theta_out);
+            double dv_in  = (m_small_angle) ? twopi * m_x_in  : f3(m_theta_in);
+            double g_out  = -m_norm * dv_out * value;
+            double g_in   =  m_norm * dv_in  * value;
+
+            // Add derivatives of outer and inner profile
+            double s_out = std::sqrt(m_x_out - x);
+            g_out       += (m_small_angle)
+                           ? m_norm * m_theta_out / s_out
+                           : m_norm * std::sin(m_theta_out) *
+                             std::cos(m_theta_out) / s_out;
+            if (x < m_x_in) {
+                double s_in = std::sqrt(m_x_in - x);
+                g_in       -= (m_small_angle)
+                              ? m_norm * m_theta_in / s_in
+                              : m_norm * std::sin(m_theta_in) *
+                                std::cos(m_theta_in) / s_in;
+            }
+
+            // Compute parameter value gradients
+            if (m_radius.isfree()) {
+                g_radius = (g_out + g_in) * m_radius.scale() * deg2rad;
+            }
+            if (m_width.isfree()) {
+                g_width = g_out * m_width.scale() * deg2rad;
+            }
+
+        } // endif: we were inside the outer edge
+
+    } // endif: gradients were needed
+
+    // Set gradients (circumvent const correctness)
+    const_cast<GModelRadialShell*>(this)->m_radius.gradient(g_radius);
+    const_cast<GModelRadialShell*>(this)->m_width.gradient(g_width);
+
     // Return value
-    return (eval(theta));
+    return value;
 }
 
 
@@ -586,7 +675,7 @@ void GModelRadialShell::init_members(void)
     m_radius.free();
     m_radius.scale(1.0);
     m_radius.gradient(0.0);
-    m_radius.hasgrad(false);  // Radial components never have gradients
+    m_radius.hasgrad(true);
 
     // Initialise Width
     m_width.clear();
@@ -597,7 +686,7 @@ void GModelRadialShell::init_members(void)
     m_width.free();
     m_width.scale(1.0);
     m_width.gradient(0.0);
-    m_width.hasgrad(false);  // Radial components never have gradients
+    m_width.hasgrad(true);
 
     // Set parameter pointer(s)
     m_pars.push_back(&m_radius);
@@ -785,6 +874,28 @@ double GModelRadialShell::f2(double x)
 }
 
 
+/***********************************************************************//**
+ * @brief Return function 3 value needed for gradient computation
+ *
+ * Computes
+ * \f[f3(x) = \pi \sin x \cos x
+ *    \ln \left( \frac{1 + \sin x}{1 - \sin x} \right)\f],
+ * which is the derivative of the solid angle integral of the unnormalised
+ * profile \f$\sqrt{\sin^2 x - \sin^2 \theta}\f$ with respect to the
+ * radius \f$x\f$.
+ ***************************************************************************/
+double GModelRadialShell::f3(double x)
+{
+    // Compute value
+    double sin_x = std::sin(x);
+    double f3    = pi * sin_x * std::cos(x) *
+                   std::log((1.0 + sin_x) / (1.0 - sin_x));
+
+    // Return value
+    return f3;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                                Friends                                  =
@@ -28,6 +28,10 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <vector>
 #include "GTools.hpp"
 #include "GException.hpp"
 #include "GModelSky.hpp"
@@ -52,10 +56,13 @@
 #define G_SPECTRAL                     "GModelSky::spectral(GEvent&, GTime&," \
                                                       " GObservation&, bool)"
 #define G_TEMPORAL        "GModelSky::temporal(GEvent&, GObservation&, bool)"
+#define G_EVAL_GRADIENTS_RANGE  "GModelSky::eval_gradients_range(GObservation&,"\
+                        " int&, int&, double*, double*, GEvent*, double*)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_MC_BLOCK 10000                  //!< Number of photons per MC block
 
 /* __ Debug definitions __________________________________________________ */
 #define G_DUMP_MC 0                                 //!< Dump MC information
@@ -308,6 +315,177 @@ double GModelSky::eval_gradients(const GEvent& event,
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate model and parameter gradients for a range of events
+ *
+ * @param[in] obs Observation.
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[out] values Model values (iend-ibegin elements).
+ * @param[out] gradients Parameter gradients ((iend-ibegin)*size() elements).
+ * @param[in] view Event view of the events container (optional).
+ *
+ * Evaluates the source model and its parameter gradients for the events
+ * [ibegin,iend[ of the observation (see GModel::eval_gradients_range for
+ * the layout of the output arrays). The results are identical to those
+ * of eval_gradients(), yet the spectral and temporal model components are
+ * only evaluated when the energy or time differs from that of the previous
+ * event. For binned observations, where consecutive bins share the same
+ * energy and time, this removes most of the spectral model evaluations.
+ ***************************************************************************/
+void GModelSky::eval_gradients_range(const GObservation& obs,
+                                     const int&          ibegin,
+                                     const int&          iend,
+                                     double*             values,
+                                     double*             gradients,
+                                     GEvent*             view) const
+{
+    // Evaluate model without IRF cache
+    eval_gradients_range(obs, ibegin, iend, values, gradients, view, NULL);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate model and parameter gradients for a range of events
+ *        using an IRF cache
+ *
+ * @param[in] obs Observation.
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[out] values Model values (iend-ibegin elements).
+ * @param[out] gradients Parameter gradients ((iend-ibegin)*size() elements).
+ * @param[in] view Event view of the events container (may be NULL).
+ * @param[in] irfs IRF values (one element per event of the observation,
+ *                 or NULL).
+ *
+ * @exception GException::no_response
+ *            No valid instrument response function defined.
+ * @exception GException::feature_not_implemented
+ *            Response has energy or time dispersion.
+ *
+ * Same as eval_gradients_range(obs,ibegin,iend,values,gradients,view), but
+ * the IRF value of event i is taken from irfs[i] if @p irfs is not NULL. The
+ * caller is responsible for providing IRF values that correspond to the
+ * spatial model and the response, and the spatial parameters need to be
+ * fixed as no spatial gradients are computed from cached IRF values.
+ ***************************************************************************/
+void GModelSky::eval_gradients_range(const GObservation& obs,
+                                     const int&          ibegin,
+                                     const int&          iend,
+                                     double*             values,
+                                     double*             gradients,
+                                     GEvent*             view,
+                                     const double*       irfs) const
+{
+    // Use event-wise evaluation if there is no spatial component
+    if (m_spatial == NULL) {
+        GModel::eval_gradients_range(obs, ibegin, iend, values, gradients,
+                                     view);
+        return;
+    }
+
+    // Get response function
+    GResponse* rsp = obs.response();
+    if (rsp == NULL) {
+        throw GException::no_response(G_EVAL_GRADIENTS_RANGE);
+    }
+
+    // Integration over time or energy dispersion is not implemented
+    if (rsp->hastdisp() || rsp->hasedisp()) {
+        throw GException::feature_not_implemented(G_EVAL_GRADIENTS_RANGE);
+    }
+
+    // Get number of parameters
+    int npars = size();
+    int nspec = (m_spectral != NULL) ? m_spectral->size() : 0;
+    int ntemp = (m_temporal != NULL) ? m_temporal->size() : 0;
+    int nspat = m_spatial->size();
+
+    // Allocate storage for unscaled spectral and temporal gradients
+    std::vector<double> spec_grad(nspec, 0.0);
+    std::vector<double> temp_grad(ntemp, 0.0);
+
+    // Initialise source and component values
+    GSource source(this->name(), *m_spatial, GEnergy(), GTime());
+    double  spec     = 1.0;
+    double  temp     = 1.0;
+    bool    has_spec = false;
+    bool    has_temp = false;
+
+    // Loop over events
+    for (int i = ibegin; i < iend; ++i, ++values, gradients += npars) {
+
+        // Get event pointer
+        const GEvent* event = obs.events()->event(i, view);
+
+        // Evaluate spectral component if energy has changed
+        if (!has_spec || event->energy() != source.energy()) {
+            source.energy(event->energy());
+            if (m_spectral != NULL) {
+                spec = m_spectral->eval_gradients(source.energy());
+                for (int k = 0; k < nspec; ++k) {
+                    spec_grad[k] = (*m_spectral)[k].gradient();
+                }
+            }
+            has_spec = true;
+        }
+
+        // Evaluate temporal component if time has changed
+        if (!has_temp || event->time() != source.time()) {
+            source.time(event->time());
+            if (m_temporal != NULL) {
+                temp = m_temporal->eval_gradients(source.time());
+                for (int k = 0; k < ntemp; ++k) {
+                    temp_grad[k] = (*m_temporal)[k].gradient();
+                }
+            }
+            has_temp = true;
+        }
+
+        // Get IRF value, either from the cache or by computing it. The
+        // IRF returns the spatial component of the source model and sets
+        // the spatial parameter gradients of the source copy of the spatial
+        // model. Cached IRF values are only used
+        // if all spatial parameters are fixed, hence no spatial gradients
+        // are needed in that case.
+        double irf = (irfs != NULL) ? irfs[i]
+                                    : rsp->irf_gradients(*event, source, obs);
+
+        // Set value
+        *values = spec * temp * irf;
+
+        // Set spectral and temporal gradients
+        double fact = temp * irf;
+        for (int k = 0; k < nspec; ++k) {
+            (*m_spectral)[k].gradient(spec_grad[k] * fact);
+        }
+        fact = spec * irf;
+        for (int k = 0; k < ntemp; ++k) {
+            (*m_temporal)[k].gradient(temp_grad[k] * fact);
+        }
+        fact = spec * temp;
+        for (int k = 0; k < nspat; ++k) {
+            GModelPar& par = (*m_spatial)[k];
+            if (par.isfree() && par.hasgrad()) {
+                par.gradient((*source.model())[k].gradient() * fact);
+            }
+        }
+
+        // Store parameter gradients
+        for (int k = 0; k < npars; ++k) {
+            gradients[k] = m_pars[k]->gradient();
+        }
+
+    } // endfor: looped over events
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Return spatially integrated sky model
  *
@@ -515,6 +693,15 @@ void GModelSky::write(GXmlElement& xml) const
  * only the sky region will be simulated that is actually observed by the
  * telescope.
  *
+ * The photon arrival times are drawn first. The photons are then split
+ * into blocks of G_MC_BLOCK photons that are distributed over the threads.
+ * The directions and energies of the photons of a block are drawn in one
+ * call each from the spatial and spectral model components, using stream
+ * i of a generator that is seeded from @p ran for block i. The photons
+ * hence do not depend on the number of threads. Each thread draws from
+ * its own copy of the spatial and spectral model components since they
+ * may cache sampling information.
+ *
  * @todo Check usage for diffuse models
  * @todo Implement photon arrival direction simulation for diffuse models
  * @todo Implement unique model ID to assign as Monte Carlo ID
@@ -570,30 +757,86 @@ GPhotons GModelSky::mc(const double& area,
             // Get photon arrival times from temporal model
             GTimes times = m_temporal->mc(rate, tmin, tmax, ran);
 
-            // Reserve space for photons
-            if (times.size() > 0) {
-                photons.reserve(times.size());
-            }
-
-            // Loop over photons
-            for (int i = 0; i < times.size(); ++i) {
+            // Get number of photons and blocks
+            int nphotons = times.size();
+            int nblocks  = (nphotons + G_MC_BLOCK - 1) / G_MC_BLOCK;
 
-                // Allocate photon
-                GPhoton photon;
+            // Derive generator for block streams
+            GRan base(ran.int64());
 
-                // Set photon arrival time
-                photon.time(times[i]);
+            // Allocate photons
+            photons.resize(nphotons);
 
-                // Set incident photon direction
-                photon.dir(m_spatial->mc(ran));
-
-                // Set photon energy
-                photon.energy(m_spectral->mc(emin, emax, ran));
+            // Set number of threads. No more threads than blocks are used
+            // since each thread copies the model components.
+            #ifdef _OPENMP
+            int nthreads = (nblocks < omp_get_max_threads())
+                           ? nblocks : omp_get_max_threads();
+            #else
+            int nthreads = 1;
+            #endif
+            if (nthreads < 1) {
+                nthreads = 1;
+            }
 
-                // Append photon
-                photons.push_back(photon);
+            // Draw incident photon directions and energies in blocks.
+            // Exceptions must not leave the parallel region, hence failed
+            // blocks are flagged.
+            std::vector<int> failed(nblocks, 0);
+            #pragma omp parallel num_threads(nthreads)
+            {
+                // Allocate model component copies for this thread
+                GModelSpatial*       spatial  = m_spatial->clone();
+                GModelSpectral*      spectral = m_spectral->clone();
+                std::vector<GSkyDir> dirs;
+                std::vector<GEnergy> energies;
+
+                // Loop over blocks
+                #pragma omp for schedule(dynamic)
+                for (int iblock = 0; iblock < nblocks; ++iblock) {
+                    int ibegin = iblock * G_MC_BLOCK;
+                    int iend   = (ibegin + G_MC_BLOCK < nphotons)
+                                 ? ibegin + G_MC_BLOCK : nphotons;
+                    try {
+                        GRan stream = base.stream(iblock);
+                        spatial->mc(iend-ibegin, stream, dirs);
+                        spectral->mc(iend-ibegin, emin, emax, stream, energies);
+                        for (int i = ibegin; i < iend; ++i) {
+                            photons[i].time(times[i]);
+                            photons[i].dir(dirs[i-ibegin]);
+                            photons[i].energy(energies[i-ibegin]);
+                        }
+                    }
+                    catch (std::exception &e) {
+                        failed[iblock] = 1;
+                    }
+                }
 
-            } // endfor: looped over photons
+                // Free model component copies
+                delete spatial;
+                delete spectral;
+
+            } // end pragma omp parallel
+
+            // Draw failed blocks again outside the parallel region, so
+            // that any exception is thrown to the caller, and store them
+            for (int iblock = 0; iblock < nblocks; ++iblock) {
+                if (failed[iblock]) {
+                    int ibegin = iblock * G_MC_BLOCK;
+                    int iend   = (ibegin + G_MC_BLOCK < nphotons)
+                                 ? ibegin + G_MC_BLOCK : nphotons;
+                    GRan                 stream = base.stream(iblock);
+                    std::vector<GSkyDir> dirs;
+                    std::vector<GEnergy> energies;
+                    m_spatial->mc(iend-ibegin, stream, dirs);
+                    m_spectral->mc(iend-ibegin, emin, emax, stream, energies);
+                    for (int i = ibegin; i < iend; ++i) {
+                        photons[i].time(times[i]);
+                        photons[i].dir(dirs[i-ibegin]);
+                        photons[i].energy(energies[i-ibegin]);
+                    }
+                }
+            }
 
         } // endif: model was used
     } // endif: model was valid
@@ -814,7 +1057,9 @@ GModelTemporal* GModelSky::xml_temporal(const GXmlElement& temporal) const
  *            Observation has no valid instrument response
  *
  * This method computes the spatial model component for a given true photon
- * energy and arrival time.
+ * energy and arrival time. If gradients are requested, the gradients of the
+ * free spatial parameters that have the hasgrad() flag set are provided by
+ * the instrument response (see GResponse::irf_gradients()).
  ***************************************************************************/
 double GModelSky::spatial(const GEvent& event,
                           const GEnergy& srcEng, const GTime& srcTime,
@@ -836,8 +1081,10 @@ double GModelSky::spatial(const GEvent& event,
         GSource source(this->name(), *m_spatial, srcEng, srcTime);
         
         // Get IRF value. This method returns the spatial component of the
-        // source model.
-        double irf = rsp->irf(event, source, obs);
+        // source model. If gradients are requested, the response also sets
+        // the spatial parameter gradients.
+        double irf = (grad) ? rsp->irf_gradients(event, source, obs)
+                            : rsp->irf(event, source, obs);
 
         // Case A: evaluate gradients
         if (grad) {
@@ -882,6 +1129,16 @@ double GModelSky::spatial(const GEvent& event,
                 }
             }
 
+            // Set spatial gradients. The response has set the gradients
+            // of the source model, which is a copy of the spatial model
+            double fact = spec * temp;
+            for (int i = 0; i < m_spatial->size(); ++i) {
+                GModelPar& par = (*m_spatial)[i];
+                if (par.isfree() && par.hasgrad()) {
+                    par.gradient((*source.model())[i].gradient() * fact);
+                }
+            }
+
         } // endif: gradient evaluation has been requested
 
         // Case B: evaluate no gradients
@@ -224,6 +224,34 @@ const GModelPar& GModelSpatial::operator[](const std::string& name) const
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Returns MC sky directions
+ *
+ * @param[in] number Number of sky directions.
+ * @param[in] ran Random number generator.
+ * @param[out] dirs Sky directions.
+ *
+ * Draws @p number random sky directions from the model in a single call.
+ * This default implementation calls mc(GRan&) for each sky direction.
+ * Derived classes may overload the method to set up the sampling only
+ * once for all sky directions.
+ ***************************************************************************/
+void GModelSpatial::mc(const int& number, GRan& ran,
+                       std::vector<GSkyDir>& dirs) const
+{
+    // Allocate sky directions
+    dirs.resize(number);
+
+    // Draw sky directions
+    for (int i = 0; i < number; ++i) {
+        dirs[i] = mc(ran);
+    }
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -263,61 +263,49 @@ double GModelSpatialMap::eval_gradients(const GSkyDir& srcDir) const
  *
  * @param[in] ran Random number generator.
  *
- * @exception GException::feature_not_implemented
- *            Method not yet implemented
- *
  * This method returns a random sky direction according to the intensity
- * distribution of the model sky map. It makes use of a cache array that
- * contains the normalized cumulative flux values of the skymap. Using a
- * uniform random number, this cache array is scanned using a bi-section
- * method to determine the skymap pixel for which the position should be
- * returned. To avoid binning problems, the exact position within the pixel
- * is set by a uniform random number generator (neglecting thus pixel
- * distortions). The fractional skymap pixel is then converted into a sky
- * direction.
+ * distribution of the model sky map (see mc_draw()).
  ***************************************************************************/
 GSkyDir GModelSpatialMap::mc(GRan& ran) const
 {
     // Allocate sky direction
     GSkyDir dir;
 
-    // Determine number of skymap pixels
-    int npix = m_map.npix();
-
-    // Continue only if there are skymap pixels
-    if (npix > 0) {
-
-        // Get uniform random number
-        double u = ran.uniform();
-
-        // Get pixel index according to random number. We use a bi-section
-        // method to find the corresponding skymap pixel
-        int low  = 0;
-        int high = npix;
-        while ((high - low) > 1) {
-            int mid = (low+high) / 2;
-            if (u < m_mc_cache[mid]) {
-                high = mid;
-            }
-            else if (m_mc_cache[mid] <= u) {
-                low = mid;
-            }
-        }
+    // Draw sky direction if there are skymap pixels
+    if (m_map.npix() > 0) {
+        dir = mc_draw(ran);
+    }
+    
+    // Return sky direction
+    return dir;
+}
 
-        // Convert 1D pixel index to 2D pixel index
-        GSkyPixel pixel = m_map.pix2xy(low);
 
-        // Randomize pixel
-        pixel.x(pixel.x() + ran.uniform() - 0.5);
-        pixel.y(pixel.y() + ran.uniform() - 0.5);
+/***********************************************************************//**
+ * @brief Returns MC sky directions
+ *
+ * @param[in] number Number of sky directions.
+ * @param[in] ran Random number generator.
+ * @param[out] dirs Sky directions.
+ *
+ * Draws @p number random sky directions according to the intensity
+ * distribution of the model sky map (see mc_draw()).
+ ***************************************************************************/
+void GModelSpatialMap::mc(const int& number, GRan& ran,
+                          std::vector<GSkyDir>& dirs) const
+{
+    // Allocate sky directions
+    dirs.resize(number);
 
-        // Get sky direction
-        dir = m_map.xy2dir(pixel);
+    // Draw sky directions if there are skymap pixels
+    if (m_map.npix() > 0) {
+        for (int i = 0; i < number; ++i) {
+            dirs[i] = mc_draw(ran);
+        }
+    }
 
-    } // endif: there were pixels in sky map
-    
-    // Return sky direction
-    return dir;
+    // Return
+    return;
 }
 
 
@@ -478,7 +466,8 @@ void GModelSpatialMap::init_members(void)
     // Initialise other members
     m_map.clear();
     m_filename.clear();
-    m_mc_cache.clear();
+    m_mc_prob.clear();
+    m_mc_alias.clear();
 
     // Return
     return;
@@ -496,7 +485,8 @@ void GModelSpatialMap::copy_members(const GModelSpatialMap& model)
     m_value    = model.m_value;
     m_map      = model.m_map;
     m_filename = model.m_filename;
-    m_mc_cache = model.m_mc_cache;
+    m_mc_prob  = model.m_mc_prob;
+    m_mc_alias = model.m_mc_alias;
 
     // Set parameter pointer(s)
     m_pars.clear();
@@ -525,14 +515,12 @@ void GModelSpatialMap::free_members(void)
  * pixels are set to zero intensity.
  *
  * The method also initialises a cache for Monte Carlo sampling of the
- * skymap. This Monte Carlo cache consists of a linear array that maps a
- * value between 0 and 1 into the skymap pixel.
+ * skymap (see mc_init()).
  ***************************************************************************/
 void GModelSpatialMap::load_map(const std::string& filename)
 {
-    // Initialise skymap and cache
+    // Initialise skymap
     m_map.clear();
-    m_mc_cache.clear();
 
     // Store filename of skymap (for XML writing). Note that we do not
     // expand any environment variable at this level, so that if we write
@@ -549,15 +537,8 @@ void GModelSpatialMap::load_map(const std::string& filename)
     // Continue only if there are skymap pixels
     if (npix > 0) {
 
-        // Reserve space for all pixels in cache
-        m_mc_cache.reserve(npix+1);
-
-        // Set first cache value to 0
-        m_mc_cache.push_back(0.0);
-
-        // Initialise cache with cumulative pixel fluxes and compute total
-        // flux in skymap for normalization. Negative pixels are set to
-        // zero intensity in the skymap.
+        // Compute total flux in skymap for normalization. Negative pixels
+        // are set to zero intensity in the skymap.
         double sum = 0.0;
         for (int i = 0; i < npix; ++i) {
             double flux = m_map(i) * m_map.omega(i);
@@ -566,29 +547,121 @@ void GModelSpatialMap::load_map(const std::string& filename)
                 flux     = 0.0;
             }
             sum += flux;
-            m_mc_cache.push_back(sum);
         }
 
-        // Normalize skymap and pixel fluxes in the cache so that the values
-        // in the cache run from 0 to 1
+        // Normalize skymap
         if (sum > 0.0) {
             for (int i = 0; i < npix; ++i) {
-                m_map(i)      /= sum;
-                m_mc_cache[i] /= sum;
+                m_map(i) /= sum;
             }
         }
-        
-        // Make sure that last pixel in the cache is >1
-        m_mc_cache[npix] = 1.0001;
+
+    } // endif: there were skymap pixels
+
+    // Initialise Monte Carlo cache
+    mc_init();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Initialise Monte Carlo cache
+ *
+ * Sets up the alias table that is used for drawing skymap pixels with a
+ * probability proportional to their flux in constant time (Vose's alias
+ * method). Each pixel i is assigned an acceptance probability
+ * m_mc_prob[i] and an alias pixel m_mc_alias[i]. A pixel is drawn by
+ * selecting a pixel i uniformly and by taking either pixel i, with
+ * probability m_mc_prob[i], or its alias.
+ *
+ * If the map has no positive pixel, all pixels are drawn with equal
+ * probability.
+ ***************************************************************************/
+void GModelSpatialMap::mc_init(void)
+{
+    // Initialise cache
+    m_mc_prob.clear();
+    m_mc_alias.clear();
+
+    // Determine number of skymap pixels
+    int npix = m_map.npix();
+
+    // Continue only if there are skymap pixels
+    if (npix > 0) {
+
+        // Compute pixel fluxes and total flux
+        m_mc_prob.reserve(npix);
+        double sum = 0.0;
+        for (int i = 0; i < npix; ++i) {
+            double flux = m_map(i) * m_map.omega(i);
+            m_mc_prob.push_back(flux);
+            sum += flux;
+        }
+
+        // Initialise aliases to the pixels themselves
+        m_mc_alias.reserve(npix);
+        for (int i = 0; i < npix; ++i) {
+            m_mc_alias.push_back(i);
+        }
+
+        // Continue only if there is flux in the map
+        if (sum > 0.0) {
+
+            // Scale pixel fluxes so that their mean is 1 and split the
+            // pixels into those below and above the mean
+            std::vector<int> small;
+            std::vector<int> large;
+            double           scale = double(npix) / sum;
+            for (int i = 0; i < npix; ++i) {
+                m_mc_prob[i] *= scale;
+                if (m_mc_prob[i] < 1.0) {
+                    small.push_back(i);
+                }
+                else {
+                    large.push_back(i);
+                }
+            }
+
+            // Fill up each pixel below the mean by a pixel above the mean
+            while (!small.empty() && !large.empty()) {
+                int ismall = small.back();
+                int ilarge = large.back();
+                small.pop_back();
+                m_mc_alias[ismall] = ilarge;
+                m_mc_prob[ilarge] -= 1.0 - m_mc_prob[ismall];
+                if (m_mc_prob[ilarge] < 1.0) {
+                    large.pop_back();
+                    small.push_back(ilarge);
+                }
+            }
+
+            // Remaining pixels are only affected by rounding errors and
+            // are always accepted
+            for (int i = 0; i < (int)large.size(); ++i) {
+                m_mc_prob[large[i]] = 1.0;
+            }
+            for (int i = 0; i < (int)small.size(); ++i) {
+                m_mc_prob[small[i]] = 1.0;
+            }
+
+        } // endif: there was flux in the map
+
+        // ... otherwise draw all pixels with equal probability
+        else {
+            m_mc_prob.assign(npix, 1.0);
+        }
 
         // Dump cache values for debugging
         #if defined(G_DEBUG_CACHE)
-        for (int i = 0; i < npix+1; ++i) {
+        for (int i = 0; i < npix; ++i) {
             std::cout << "i=" << i;
-            std::cout << " c=" << m_mc_cache[i] << std::endl;
+            std::cout << " p=" << m_mc_prob[i];
+            std::cout << " a=" << m_mc_alias[i] << std::endl;
         }
         #endif
-        
+
     } // endif: there were skymap pixels
 
     // Return
@@ -596,6 +669,49 @@ void GModelSpatialMap::load_map(const std::string& filename)
 }
 
 
+/***********************************************************************//**
+ * @brief Draw MC sky direction
+ *
+ * @param[in] ran Random number generator.
+ * @return Sky direction.
+ *
+ * Draws a skymap pixel in constant time from the alias table that is set
+ * up by mc_init(). To avoid binning problems, the exact position within
+ * the pixel is set by a uniform random number generator (neglecting thus
+ * pixel distortions). The fractional skymap pixel is then converted into
+ * a sky direction.
+ *
+ * The method assumes that the skymap has at least one pixel.
+ ***************************************************************************/
+GSkyDir GModelSpatialMap::mc_draw(GRan& ran) const
+{
+    // Determine number of skymap pixels
+    int npix = m_map.npix();
+
+    // Get pixel index according to random number using the alias method.
+    // The integer part of u selects a pixel, and the fractional part
+    // decides whether the pixel or its alias is taken
+    double u    = ran.uniform() * npix;
+    int    ipix = int(u);
+    if (ipix >= npix) {
+        ipix = npix - 1;
+    }
+    if (u - ipix >= m_mc_prob[ipix]) {
+        ipix = m_mc_alias[ipix];
+    }
+
+    // Convert 1D pixel index to 2D pixel index
+    GSkyPixel pixel = m_map.pix2xy(ipix);
+
+    // Randomize pixel
+    pixel.x(pixel.x() + ran.uniform() - 0.5);
+    pixel.y(pixel.y() + ran.uniform() - 0.5);
+
+    // Return sky direction
+    return (m_map.xy2dir(pixel));
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                                Friends                                  =
@@ -243,7 +243,10 @@ double GModelSpatialPtsrc::eval(const GSkyDir& srcDir) const
  * 0.1 arcsec, i.e. well below the angular resolution of gamma-ray
  * telescopes).
  *
- * This method does not provide valid parameter gradients.
+ * This method does not provide valid parameter gradients. As the point
+ * source is a delta function, the position gradients are only defined
+ * after convolution with the instrument response, and are provided by
+ * GResponse::irf_gradients().
  ***************************************************************************/
 double GModelSpatialPtsrc::eval_gradients(const GSkyDir& srcDir) const
 {
@@ -269,6 +272,26 @@ GSkyDir GModelSpatialPtsrc::mc(GRan& ran) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns MC sky directions
+ *
+ * @param[in] number Number of sky directions.
+ * @param[in] ran Random number generator.
+ * @param[out] dirs Sky directions.
+ *
+ * Sets all sky directions to the point source direction.
+ ***************************************************************************/
+void GModelSpatialPtsrc::mc(const int& number, GRan& ran,
+                            std::vector<GSkyDir>& dirs) const
+{
+    // Set sky directions
+    dirs.assign(number, dir());
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Read model from XML element
  *
@@ -476,7 +499,7 @@ void GModelSpatialPtsrc::init_members(void)
     m_ra.fix();
     m_ra.scale(1.0);
     m_ra.gradient(0.0);
-    m_ra.hasgrad(false);
+    m_ra.hasgrad(true);
 
     // Initialise Declination
     m_dec.clear();
@@ -485,7 +508,7 @@ void GModelSpatialPtsrc::init_members(void)
     m_dec.fix();
     m_dec.scale(1.0);
     m_dec.gradient(0.0);
-    m_dec.hasgrad(false);
+    m_dec.hasgrad(true);
 
     // Set parameter pointer(s)
     m_pars.clear();
@@ -224,6 +224,38 @@ const GModelPar& GModelSpectral::operator[](const std::string& name) const
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Returns MC energies
+ *
+ * @param[in] number Number of energies.
+ * @param[in] emin Minimum photon energy.
+ * @param[in] emax Maximum photon energy.
+ * @param[in] ran Random number generator.
+ * @param[out] energies Energies.
+ *
+ * Draws @p number random energies within [emin, emax] from the model in a
+ * single call. This default implementation calls
+ * mc(const GEnergy&, const GEnergy&, GRan&) for each energy. Derived
+ * classes may overload the method to set up the sampling only once for all
+ * energies.
+ ***************************************************************************/
+void GModelSpectral::mc(const int& number, const GEnergy& emin,
+                        const GEnergy& emax, GRan& ran,
+                        std::vector<GEnergy>& energies) const
+{
+    // Allocate energies
+    energies.resize(number);
+
+    // Draw energies
+    for (int i = 0; i < number; ++i) {
+        energies[i] = mc(emin, emax, ran);
+    }
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -29,6 +29,7 @@
 #include <config.h>
 #endif
 #include <cmath>
+#include <algorithm>
 #include "GException.hpp"
 #include "GTools.hpp"
 #include "GCsv.hpp"
@@ -52,6 +53,7 @@ const GModelSpectralRegistry g_spectral_func_registry(&g_spectral_func_seed);
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_MC_CACHE_MAX 100  //!< Maximum number of energy intervals in MC cache
 
 /* __ Debug definitions __________________________________________________ */
 
@@ -488,50 +490,55 @@ double GModelSpectralFunc::eflux(const GEnergy& emin, const GEnergy& emax) const
  * @param[in] ran Random number generator.
  ***************************************************************************/
 GEnergy GModelSpectralFunc::mc(const GEnergy& emin, const GEnergy& emax,
-                               GRan& ran) const
+                                GRan& ran) const
 {
     // Allocate energy
     GEnergy energy;
     
     // Continue only if emax > emin
     if (emax > emin) {
+        energy = mc_energy(mc_update(emin, emax), ran);
+    }
     
-        // Update cache
-        mc_update(emin, emax);
-
-        // Determine in which bin we reside
-        int inx = 0;
-        if (m_mc_cum.size() > 1) {
-            double u = ran.uniform();
-            for (inx = m_mc_cum.size()-1; inx > 0; --inx) {
-                if (m_mc_cum[inx-1] <= u) {
-                    break;
-                }
-            }
-        }
+    // Return energy
+    return energy;
+}
 
-        // Get random energy for specific bin
-        if (m_mc_exp[inx] != 0.0) {
-            double e_min = m_mc_min[inx];
-            double e_max = m_mc_max[inx];
-            double u     = ran.uniform();
-            double eng   = (u > 0.0) 
-                            ? std::exp(std::log(u * (e_max - e_min) + e_min) / m_mc_exp[inx])
-                            : 0.0;
-            energy.MeV(eng);
-        }
-        else {
-            double e_min = m_mc_min[inx];
-            double e_max = m_mc_max[inx];
-            double u     = ran.uniform();
-            double eng   = std::exp(u * (e_max - e_min) + e_min);
-            energy.MeV(eng);
+
+/***********************************************************************//**
+ * @brief Returns MC energies between [emin, emax]
+ *
+ * @param[in] number Number of energies.
+ * @param[in] emin Minimum photon energy.
+ * @param[in] emax Maximum photon energy.
+ * @param[in] ran Random number generator.
+ * @param[out] energies Energies.
+ *
+ * Draws @p number random energies, looking up the inverse cumulative
+ * distribution for [emin, emax] only once.
+ ***************************************************************************/
+void GModelSpectralFunc::mc(const int& number, const GEnergy& emin,
+                             const GEnergy& emax, GRan& ran,
+                             std::vector<GEnergy>& energies) const
+{
+    // Allocate energies
+    energies.assign(number, GEnergy());
+
+    // Continue only if emax > emin
+    if (emax > emin) {
+
+        // Get cached inverse cumulative distribution for energy interval
+        int icache = mc_update(emin, emax);
+
+        // Draw energies
+        for (int i = 0; i < number; ++i) {
+            energies[i] = mc_energy(icache, ran);
         }
 
     } // endif: emax > emin
-    
-    // Return energy
-    return energy;
+
+    // Return
+    return;
 }
 
 
@@ -703,10 +710,13 @@ void GModelSpectralFunc::init_members(void)
     // Initialise cache
     m_mc_emin.clear();
     m_mc_emax.clear();
+    m_mc_begin.clear();
+    m_mc_end.clear();
     m_mc_cum.clear();
     m_mc_min.clear();
     m_mc_max.clear();
     m_mc_exp.clear();
+    m_mc_index = -1;
 
     // Return
     return;
@@ -738,6 +748,9 @@ void GModelSpectralFunc::copy_members(const GModelSpectralFunc& model)
     // Copy MC cache
     m_mc_emin    = model.m_mc_emin;
     m_mc_emax    = model.m_mc_emax;
+    m_mc_begin   = model.m_mc_begin;
+    m_mc_end     = model.m_mc_end;
+    m_mc_index   = model.m_mc_index;
     m_mc_cum     = model.m_mc_cum;
     m_mc_min     = model.m_mc_min;
     m_mc_max     = model.m_mc_max;
@@ -905,6 +918,9 @@ void GModelSpectralFunc::set_cache(void) const
     
     } // endfor: looped over all nodes
 
+    // Clear MC cache
+    mc_clear();
+
     // Return
     return;
 }
@@ -915,25 +931,45 @@ void GModelSpectralFunc::set_cache(void) const
  *
  * @param[in] emin Minimum energy.
  * @param[in] emax Maximum energy.
+ * @return Index of energy interval in cache.
  *
- * This method sets up an array of indices and the cumulative distribution
- * function needed for MC simulations.
- * 
+ * This method sets up the piecewise power law inverse of the cumulative
+ * distribution function needed for MC simulations within [emin, emax].
+ * The cache holds the distributions of up to G_MC_CACHE_MAX energy
+ * intervals, so that simulations that alternate between energy bins
+ * only build the distribution of each bin once. The segments of energy
+ * interval i are stored in the range [m_mc_begin[i], m_mc_end[i]) of the
+ * cache arrays.
  ***************************************************************************/
-void GModelSpectralFunc::mc_update(const GEnergy& emin, const GEnergy& emax) const
+int GModelSpectralFunc::mc_update(const GEnergy& emin, const GEnergy& emax) const
 {
-    // Check if we need to update the cache
-    if (emin != m_mc_emin || emax != m_mc_emax) {
-    
+    // Check whether the energy interval is the one of the last call,
+    // otherwise search it in the cache
+    int icache = m_mc_index;
+    if (icache < 0 || icache >= (int)m_mc_emin.size() ||
+        emin != m_mc_emin[icache] || emax != m_mc_emax[icache]) {
+        icache = -1;
+        for (int i = 0; i < (int)m_mc_emin.size(); ++i) {
+            if (emin == m_mc_emin[i] && emax == m_mc_emax[i]) {
+                icache = i;
+                break;
+            }
+        }
+    }
+
+    // If the energy interval was not found then add it to the cache
+    if (icache < 0) {
+
+        // Clear cache if it is full
+        if (m_mc_emin.size() >= G_MC_CACHE_MAX) {
+            mc_clear();
+        }
+
         // Store new energy interval
-        m_mc_emin = emin;
-        m_mc_emax = emax;
-        
-        // Initialise cache
-        m_mc_cum.clear();
-        m_mc_min.clear();
-        m_mc_max.clear();
-        m_mc_exp.clear();
+        icache     = m_mc_emin.size();
+        int ibegin = m_mc_cum.size();
+        m_mc_emin.push_back(emin);
+        m_mc_emax.push_back(emax);
 
         // Get energy range in MeV
         double e_min = emin.MeV();
@@ -1010,16 +1046,16 @@ void GModelSpectralFunc::mc_update(const GEnergy& emin, const GEnergy& emax) con
             } // endelse: emin and emax not between same nodes
 
             // Build cumulative distribution
-            for (int i = 1; i < m_mc_cum.size(); ++i) {
+            for (int i = ibegin+1; i < (int)m_mc_cum.size(); ++i) {
                 m_mc_cum[i] += m_mc_cum[i-1];
             }
             double norm = m_mc_cum[m_mc_cum.size()-1];
-            for (int i = 0; i < m_mc_cum.size(); ++i) {
+            for (int i = ibegin; i < (int)m_mc_cum.size(); ++i) {
                 m_mc_cum[i] /= norm;
             }
 
             // Set MC values
-            for (int i = 0; i < m_mc_cum.size(); ++i) {
+            for (int i = ibegin; i < (int)m_mc_cum.size(); ++i) {
 
                 // Compute exponent
                 double exponent = m_mc_exp[i] + 1.0;
@@ -1039,15 +1075,91 @@ void GModelSpectralFunc::mc_update(const GEnergy& emin, const GEnergy& emax) con
             } // endfor: set MC values
             
         } // endif: e_max > e_min
-        
-    } // endif: Update was required
+
+        // Store range of energy interval in cache
+        m_mc_begin.push_back(ibegin);
+        m_mc_end.push_back(m_mc_cum.size());
+
+    } // endif: energy interval was added to cache
+
+    // Store index of last energy interval
+    m_mc_index = icache;
+
+    // Return index
+    return icache;
+}
 
 
+/***********************************************************************//**
+ * @brief Clear MC pre-computation cache
+ ***************************************************************************/
+void GModelSpectralFunc::mc_clear(void) const
+{
+    // Clear cache
+    m_mc_emin.clear();
+    m_mc_emax.clear();
+    m_mc_begin.clear();
+    m_mc_end.clear();
+    m_mc_cum.clear();
+    m_mc_min.clear();
+    m_mc_max.clear();
+    m_mc_exp.clear();
+    m_mc_index = -1;
+
     // Return
     return;
 }
 
 
+/***********************************************************************//**
+ * @brief Draw MC energy from cached distribution
+ *
+ * @param[in] icache Index of energy interval in cache.
+ * @param[in] ran Random number generator.
+ *
+ * Draws a random energy from the inverse cumulative distribution of an
+ * energy interval that has been set up by mc_update().
+ ***************************************************************************/
+GEnergy GModelSpectralFunc::mc_energy(const int& icache, GRan& ran) const
+{
+    // Allocate energy
+    GEnergy energy;
+
+    // Determine in which bin we reside using a bisection of the
+    // cumulative distribution
+    int ibegin = m_mc_begin[icache];
+    int iend   = m_mc_end[icache];
+    int inx    = ibegin;
+    if (iend - ibegin > 1) {
+        double u = ran.uniform();
+        inx = std::upper_bound(m_mc_cum.begin() + ibegin,
+                               m_mc_cum.begin() + iend - 1, u) -
+              m_mc_cum.begin();
+    }
+
+    // Get random energy for specific bin
+    if (m_mc_exp[inx] != 0.0) {
+        double e_min = m_mc_min[inx];
+        double e_max = m_mc_max[inx];
+        double u     = ran.uniform();
+        double eng   = (u > 0.0) 
+                        ? std::exp(std::log(u * (e_max - e_min) + e_min) / m_mc_exp[inx])
+                        : 0.0;
+        energy.MeV(eng);
+    }
+    else {
+        double e_min = m_mc_min[inx];
+        double e_max = m_mc_max[inx];
+        double u     = ran.uniform();
+        double eng   = std::exp(u * (e_max - e_min) + e_min);
+        energy.MeV(eng);
+    }
+
+    // Return energy
+    return energy;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                                 Friends                                 =
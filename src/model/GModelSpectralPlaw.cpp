@@ -419,6 +419,55 @@ GEnergy GModelSpectralPlaw::mc(const GEnergy& emin, const GEnergy& emax,
 }
 
 
+/***********************************************************************//**
+ * @brief Returns MC energies between [emin, emax]
+ *
+ * @param[in] number Number of energies.
+ * @param[in] emin Minimum photon energy.
+ * @param[in] emax Maximum photon energy.
+ * @param[in] ran Random number generator.
+ * @param[out] energies Energies.
+ *
+ * Draws @p number random energies, computing the power law boundaries
+ * only once.
+ ***************************************************************************/
+void GModelSpectralPlaw::mc(const int& number, const GEnergy& emin,
+                            const GEnergy& emax, GRan& ran,
+                            std::vector<GEnergy>& energies) const
+{
+    // Allocate energies
+    energies.resize(number);
+
+    // Case A: Index is not -1
+    if (index() != -1.0) {
+        double exponent = index() + 1.0;
+        double e_max    = std::pow(emax.MeV(), exponent);
+        double e_min    = std::pow(emin.MeV(), exponent);
+        for (int i = 0; i < number; ++i) {
+            double u   = ran.uniform();
+            double eng = (u > 0.0) 
+                         ? std::exp(std::log(u * (e_max - e_min) + e_min) / exponent)
+                         : 0.0;
+            energies[i].MeV(eng);
+        }
+    }
+
+    // Case B: Index is -1
+    else {
+        double e_max = std::log(emax.MeV());
+        double e_min = std::log(emin.MeV());
+        for (int i = 0; i < number; ++i) {
+            double u   = ran.uniform();
+            double eng = std::exp(u * (e_max - e_min) + e_min);
+            energies[i].MeV(eng);
+        }
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Autoscale normalization
  *
@@ -581,6 +581,76 @@ double GModels::eval_gradients(const GEvent& event,
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate sum and gradients of all models for a range of events
+ *
+ * @param[in] obs Observation.
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[out] values Sum of models (iend-ibegin elements).
+ * @param[out] gradients Parameter gradients ((iend-ibegin)*npars()
+ *                       elements).
+ * @param[in] view Event view of the events container (optional).
+ *
+ * Evaluates the sum and the parameter gradients of all models for the
+ * events [ibegin,iend[ of the observation. The sum for event ibegin+i is
+ * stored in values[i], the gradient of parameter k in
+ * gradients[i*npars()+k]. See GModel::eval_gradients_range for details.
+ ***************************************************************************/
+void GModels::eval_gradients_range(const GObservation& obs,
+                                   const int&          ibegin,
+                                   const int&          iend,
+                                   double*             values,
+                                   double*             gradients,
+                                   GEvent*             view) const
+{
+    // Get dimensions
+    int num   = (iend > ibegin) ? iend - ibegin : 0;
+    int npars = this->npars();
+
+    // Initialise values
+    for (int i = 0; i < num; ++i) {
+        values[i] = 0.0;
+    }
+
+    // Continue only if there are events
+    if (num > 0) {
+
+        // Allocate model working arrays
+        std::vector<double> wrk_values(num);
+        std::vector<double> wrk_grads;
+
+        // Evaluate all models
+        int igrad = 0;
+        for (int m = 0; m < size(); ++m) {
+
+            // Evaluate model
+            int n = m_models[m]->size();
+            wrk_grads.resize(num*n+1);
+            m_models[m]->eval_gradients_range(obs, ibegin, iend,
+                                              &wrk_values[0], &wrk_grads[0],
+                                              view);
+
+            // Add values and store gradients
+            for (int i = 0; i < num; ++i) {
+                values[i] += wrk_values[i];
+                for (int k = 0; k < n; ++k) {
+                    gradients[i*npars+igrad+k] = wrk_grads[i*n+k];
+                }
+            }
+
+            // Increment parameter counter
+            igrad += n;
+
+        } // endfor: looped over models
+
+    } // endif: there were events
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print models
  *
@@ -28,13 +28,56 @@
 #include <cmath>            // For std::abs()
 #include <vector>
 #include "GIntegral.hpp"
+#include "GException.hpp"
 #include "GTools.hpp"
 
 /* __ Method name definitions ____________________________________________ */
+#define G_METHOD                       "GIntegral::method(std::string&)"
+#define G_ORDER                                  "GIntegral::order(int&)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_ROMBERG                                   0   //!< Romberg method
+#define G_GAUSS_KRONROD                             1   //!< Gauss-Kronrod
+#define G_GAUSS_LEGENDRE                            2   //!< Gauss-Legendre
+#define G_KRONROD_LIMIT      200   //!< Maximum number of Kronrod intervals
+
+/* __ Constants __________________________________________________________ */
+
+/* Abscissae of the 21-point Kronrod rule (the odd elements are the
+   abscissae of the 10-point Gauss rule) */
+const double kronrod_x[11] = {0.995657163025808080735527280689003,
+                              0.973906528517171720077964012084452,
+                              0.930157491355708226001207180059508,
+                              0.865063366688984510732096688423493,
+                              0.780817726586416897063717578345042,
+                              0.679409568299024406234327365114874,
+                              0.562757134668604683339000099272694,
+                              0.433395394129247190799265943165784,
+                              0.294392862701460198131126603103866,
+                              0.148874338981631210884826001129720,
+                              0.000000000000000000000000000000000};
+
+/* Weights of the 21-point Kronrod rule */
+const double kronrod_w[11] = {0.011694638867371874278064396062192,
+                              0.032558162307964727478818972459390,
+                              0.054755896574351996031381300244580,
+                              0.075039674810919952767043140916190,
+                              0.093125454583697605535065465083366,
+                              0.109387158802297641899210590325805,
+                              0.123491976262065851077958109831074,
+                              0.134709217311473325928054001771707,
+                              0.142775938577060080797094273138717,
+                              0.147739104901338491374841515972068,
+                              0.149445554002916905664936468389821};
+
+/* Weights of the 10-point Gauss rule */
+const double gauss_w[5]    = {0.066671344308688137593568809893332,
+                              0.149451349150580593145776339657697,
+                              0.219086362515982043995534934228163,
+                              0.269266719309996355091226921569469,
+                              0.295524224714752870173892994651338};
 
 /* __ Debug definitions __________________________________________________ */
 
@@ -173,6 +216,126 @@ GIntegral* GIntegral::clone(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Set integration method
+ *
+ * @param[in] method Integration method.
+ *
+ * @exception GException::invalid_argument
+ *            Invalid integration method specified.
+ *
+ * Sets the method that is used by integrate(). Valid methods are
+ * "ROMBERG" (default), "GAUSS-KRONROD" and "GAUSS-LEGENDRE". The method
+ * name is case insensitive.
+ ***************************************************************************/
+void GIntegral::method(const std::string& method)
+{
+    // Convert method name to upper case
+    std::string name = toupper(method);
+
+    // Set method
+    if (name == "ROMBERG") {
+        m_method = G_ROMBERG;
+    }
+    else if (name == "GAUSS-KRONROD") {
+        m_method = G_GAUSS_KRONROD;
+    }
+    else if (name == "GAUSS-LEGENDRE") {
+        m_method = G_GAUSS_LEGENDRE;
+    }
+    else {
+        throw GException::invalid_argument(G_METHOD,
+              "Unknown integration method \""+method+"\". Specify "
+              "\"ROMBERG\", \"GAUSS-KRONROD\" or \"GAUSS-LEGENDRE\".");
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return integration method
+ *
+ * Returns the name of the method that is used by integrate().
+ ***************************************************************************/
+std::string GIntegral::method(void) const
+{
+    // Set method name
+    std::string name;
+    switch (m_method) {
+    case G_GAUSS_KRONROD:
+        name = "GAUSS-KRONROD";
+        break;
+    case G_GAUSS_LEGENDRE:
+        name = "GAUSS-LEGENDRE";
+        break;
+    default:
+        name = "ROMBERG";
+        break;
+    }
+
+    // Return method name
+    return name;
+}
+
+
+/***********************************************************************//**
+ * @brief Set order of Gauss-Legendre integration
+ *
+ * @param[in] order Number of Gauss-Legendre abscissae (>0).
+ *
+ * @exception GException::invalid_argument
+ *            Order is not positive.
+ ***************************************************************************/
+void GIntegral::order(const int& order)
+{
+    // Check order
+    if (order < 1) {
+        throw GException::invalid_argument(G_ORDER,
+              "Gauss-Legendre order must be positive.");
+    }
+
+    // Set order
+    m_order = order;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform integration using the selected method
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ *
+ * Returns the integral of the integrand from a to b using the method that
+ * has been selected using method().
+ ***************************************************************************/
+double GIntegral::integrate(double a, double b)
+{
+    // Initialise result
+    double result = 0.0;
+
+    // Dispatch on method
+    switch (m_method) {
+    case G_GAUSS_KRONROD:
+        result = gauss_kronrod(a, b);
+        break;
+    case G_GAUSS_LEGENDRE:
+        result = gauss_legendre(a, b);
+        break;
+    default:
+        result = romb(a, b);
+        break;
+    }
+
+    // Return result
+    return result;
+}
+
+
 /***********************************************************************//**
  * @brief Perform Romberg integration
  *
@@ -187,7 +350,6 @@ GIntegral* GIntegral::clone(void) const
  * requested fractional accuracy. By default it is set to 1e-6.
  *
  * @todo Check that k is smaller than m_max_iter
- * @todo Make use of std::vector class
  ***************************************************************************/
 double GIntegral::romb(double a, double b, int k)
 {
@@ -200,9 +362,14 @@ double GIntegral::romb(double a, double b, int k)
     // Continue only if integration range is valid
     if (b > a) {
 
-        // Allocate temporal storage
-        double* s = new double[m_max_iter+2];
-        double* h = new double[m_max_iter+2];
+        // Allocate temporal storage (only grows, hence repeated
+        // integrations do not allocate memory)
+        if ((int)m_wrk_s.size() < m_max_iter+2) {
+            m_wrk_s.resize(m_max_iter+2);
+            m_wrk_h.resize(m_max_iter+2);
+        }
+        double* s = &m_wrk_s[0];
+        double* h = &m_wrk_h[0];
 
         // Initialise step size
         h[1] = 1.0;
@@ -240,10 +407,6 @@ double GIntegral::romb(double a, double b, int k)
 
         } // endfor: iterative loop
 
-        // Free temporal storage
-        delete [] s;
-        delete [] h;
-
         // Dump warning
         if (!m_silent) {
             if (!converged) {
@@ -294,6 +457,7 @@ double GIntegral::trapzd(double a, double b, int n, double result)
             // Evaluate integrand at boundaries
             double y_a = m_integrand->eval(a);
             double y_b = m_integrand->eval(b);
+            m_calls   += 2;
             
             // Compute result
             result = 0.5*(b-a)*(y_a + y_b);
@@ -344,6 +508,9 @@ double GIntegral::trapzd(double a, double b, int n, double result)
                 
             } // endfor: looped over steps
 
+            // Update number of integrand evaluations
+            m_calls += it;
+
             // Set result
             result = 0.5*(result + (b-a)*sum/tnm);
         }
@@ -355,6 +522,175 @@ double GIntegral::trapzd(double a, double b, int n, double result)
 }
 
 
+/***********************************************************************//**
+ * @brief Perform adaptive Gauss-Kronrod integration
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ *
+ * Returns the integral of the integrand from a to b using an adaptive
+ * 21-point Gauss-Kronrod rule. The integration interval is successively
+ * bisected at the subinterval with the largest error estimate until the
+ * total error estimate is below m_eps times the absolute value of the
+ * integral, or until G_KRONROD_LIMIT subintervals have been used. The
+ * error estimate of each subinterval is derived from the difference
+ * between the embedded 10-point Gauss and the 21-point Kronrod rules
+ * following the QUADPACK routine QK21.
+ *
+ * After integration, iter() returns the number of subintervals that were
+ * used.
+ ***************************************************************************/
+double GIntegral::gauss_kronrod(double a, double b)
+{
+    // Initialise result
+    bool   converged = false;
+    double result    = 0.0;
+    double error     = 0.0;
+
+    // Initialise number of subintervals
+    m_iter = 0;
+
+    // Continue only if integration range is valid
+    if (b > a) {
+
+        // Initialise workspace (keeps allocated memory)
+        m_wrk_a.clear();
+        m_wrk_b.clear();
+        m_wrk_r.clear();
+        m_wrk_e.clear();
+
+        // Integrate over full interval
+        double err;
+        double res = kronrod(a, b, &err);
+        m_wrk_a.push_back(a);
+        m_wrk_b.push_back(b);
+        m_wrk_r.push_back(res);
+        m_wrk_e.push_back(err);
+        result = res;
+        error  = err;
+        m_iter = 1;
+
+        // Bisect intervals until convergence
+        while (true) {
+
+            // Check for convergence
+            if (error <= m_eps * std::abs(result)) {
+                converged = true;
+                break;
+            }
+
+            // Stop if maximum number of subintervals is reached
+            if (m_iter >= G_KRONROD_LIMIT) {
+                break;
+            }
+
+            // Find subinterval with largest error
+            int imax = 0;
+            for (int i = 1; i < m_iter; ++i) {
+                if (m_wrk_e[i] > m_wrk_e[imax]) {
+                    imax = i;
+                }
+            }
+
+            // Bisect subinterval. Stop if the subinterval can no longer
+            // be bisected due to rounding
+            double a1 = m_wrk_a[imax];
+            double b2 = m_wrk_b[imax];
+            double b1 = 0.5 * (a1 + b2);
+            if (b1 <= a1 || b1 >= b2) {
+                break;
+            }
+            double err1;
+            double err2;
+            double res1 = kronrod(a1, b1, &err1);
+            double res2 = kronrod(b1, b2, &err2);
+
+            // Update total result and error
+            result += res1 + res2 - m_wrk_r[imax];
+            error  += err1 + err2 - m_wrk_e[imax];
+
+            // Replace subinterval by left half and append right half
+            m_wrk_b[imax] = b1;
+            m_wrk_r[imax] = res1;
+            m_wrk_e[imax] = err1;
+            m_wrk_a.push_back(b1);
+            m_wrk_b.push_back(b2);
+            m_wrk_r.push_back(res2);
+            m_wrk_e.push_back(err2);
+            m_iter++;
+
+        } // endwhile: bisected intervals
+
+        // Sum up results of all subintervals to reduce rounding errors
+        result = 0.0;
+        for (int i = 0; i < m_iter; ++i) {
+            result += m_wrk_r[i];
+        }
+
+        // Dump warning
+        if (!m_silent) {
+            if (!converged) {
+                std::cout << "*** WARNING: GIntegral::gauss_kronrod: ";
+                std::cout << "Integration did not converge ";
+                std::cout << "(intervals=" << m_iter;
+                std::cout << ", result=" << result;
+                std::cout << ", d=" << error;
+                std::cout << " > " << m_eps * std::abs(result) << ")";
+                std::cout << std::endl;
+            }
+        }
+
+    } // endif: integration range was valid
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform Gauss-Legendre integration
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ *
+ * Returns the integral of the integrand from a to b using a Gauss-Legendre
+ * quadrature of fixed order (see order()). The quadrature is exact for
+ * polynomials up to degree 2n-1, where n is the order. No error estimate
+ * is computed. The abscissae and weights are computed once and kept by
+ * the object.
+ ***************************************************************************/
+double GIntegral::gauss_legendre(double a, double b)
+{
+    // Initialise result
+    double result = 0.0;
+
+    // Set number of iterations
+    m_iter = 1;
+
+    // Continue only if integration range is valid
+    if (b > a) {
+
+        // Compute abscissae and weights if the order has changed
+        if ((int)m_gl_x.size() != m_order) {
+            legendre_nodes();
+        }
+
+        // Compute integral
+        double centre = 0.5 * (b + a);
+        double half   = 0.5 * (b - a);
+        for (int i = 0; i < m_order; ++i) {
+            result += m_gl_w[i] * m_integrand->eval(centre + half * m_gl_x[i]);
+        }
+        result  *= half;
+        m_calls += m_order;
+
+    } // endif: integration range was valid
+
+    // Return result
+    return result;
+}
+
+
 /***********************************************************************//**
  * @brief Print integral information
  ***************************************************************************/
@@ -369,6 +705,11 @@ std::string GIntegral::print(void) const
     // Append information
     result.append("\n"+parformat("Relative precision")+str(eps()));
     result.append("\n"+parformat("Max. number of iterations")+str(max_iter()));
+    result.append("\n"+parformat("Integration method")+method());
+    if (m_method == G_GAUSS_LEGENDRE) {
+        result.append("\n"+parformat("Gauss-Legendre order")+str(order()));
+    }
+    result.append("\n"+parformat("Integrand evaluations")+str(calls()));
     if (silent()) {
         result.append("\n"+parformat("Warnings")+"suppressed");
     }
@@ -398,6 +739,17 @@ void GIntegral::init_members(void)
     m_max_iter  = 20;
     m_iter      = 0;
     m_silent    = false;
+    m_method    = G_ROMBERG;
+    m_order     = 10;
+    m_calls     = 0;
+    m_gl_x.clear();
+    m_gl_w.clear();
+    m_wrk_s.clear();
+    m_wrk_h.clear();
+    m_wrk_a.clear();
+    m_wrk_b.clear();
+    m_wrk_r.clear();
+    m_wrk_e.clear();
 
     // Return
     return;
@@ -417,6 +769,11 @@ void GIntegral::copy_members(const GIntegral& integral)
     m_max_iter  = integral.m_max_iter;
     m_iter      = integral.m_iter;
     m_silent    = integral.m_silent;
+    m_method    = integral.m_method;
+    m_order     = integral.m_order;
+    m_calls     = integral.m_calls;
+    m_gl_x      = integral.m_gl_x;
+    m_gl_w      = integral.m_gl_w;
 
     // Return
     return;
@@ -507,3 +864,142 @@ double GIntegral::polint(double* xa, double* ya, int n, double x, double *dy)
     // Return
     return y;
 }
+
+
+/***********************************************************************//**
+ * @brief Apply 21-point Gauss-Kronrod rule
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[out] error Error estimate.
+ *
+ * Returns the integral from a to b using the 21-point Kronrod rule. The
+ * error estimate is computed from the difference to the embedded 10-point
+ * Gauss rule, scaled as in the QUADPACK routine QK21.
+ ***************************************************************************/
+double GIntegral::kronrod(const double& a, const double& b, double* error)
+{
+    // Set constants
+    const double epmach = 2.2204460492503131e-16;
+    const double uflow  = 2.2250738585072014e-308;
+
+    // Get centre and half length of interval
+    double centre = 0.5 * (a + b);
+    double half   = 0.5 * (b - a);
+
+    // Evaluate integrand at centre
+    double fc     = m_integrand->eval(centre);
+    double res_g  = 0.0;
+    double res_k  = fc * kronrod_w[10];
+    double res_a  = std::abs(res_k);
+
+    // Evaluate integrand at symmetric abscissae
+    double fv1[10];
+    double fv2[10];
+    for (int j = 0; j < 10; ++j) {
+        double x    = half * kronrod_x[j];
+        double f1   = m_integrand->eval(centre - x);
+        double f2   = m_integrand->eval(centre + x);
+        double sum  = f1 + f2;
+        fv1[j]      = f1;
+        fv2[j]      = f2;
+        res_k      += kronrod_w[j] * sum;
+        res_a      += kronrod_w[j] * (std::abs(f1) + std::abs(f2));
+        if (j % 2 == 1) {
+            res_g += gauss_w[j/2] * sum;
+        }
+    }
+
+    // Update number of integrand evaluations
+    m_calls += 21;
+
+    // Compute integral of absolute deviation from mean
+    double mean    = 0.5 * res_k;
+    double res_asc = kronrod_w[10] * std::abs(fc - mean);
+    for (int j = 0; j < 10; ++j) {
+        res_asc += kronrod_w[j] * (std::abs(fv1[j] - mean) +
+                                   std::abs(fv2[j] - mean));
+    }
+
+    // Scale results to interval
+    double result = res_k * half;
+    res_a        *= std::abs(half);
+    res_asc      *= std::abs(half);
+
+    // Compute error estimate
+    double err = std::abs((res_k - res_g) * half);
+    if (res_asc != 0.0 && err != 0.0) {
+        double scale = std::pow(200.0 * err / res_asc, 1.5);
+        err          = (scale < 1.0) ? res_asc * scale : res_asc;
+    }
+    if (res_a > uflow / (50.0 * epmach)) {
+        double err_min = 50.0 * epmach * res_a;
+        if (err < err_min) {
+            err = err_min;
+        }
+    }
+
+    // Set error estimate
+    *error = err;
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute Gauss-Legendre abscissae and weights
+ *
+ * Computes the abscissae and weights of the Gauss-Legendre quadrature of
+ * order m_order on the interval [-1,1]. The abscissae are the roots of the
+ * Legendre polynomial of degree m_order, which are found by Newton's
+ * method.
+ ***************************************************************************/
+void GIntegral::legendre_nodes(void)
+{
+    // Allocate abscissae and weights
+    int n = m_order;
+    m_gl_x.assign(n, 0.0);
+    m_gl_w.assign(n, 0.0);
+
+    // Roots are symmetric, hence we only need to find half of them
+    int m = (n + 1) / 2;
+    for (int i = 0; i < m; ++i) {
+
+        // Initial approximation of root
+        double z  = std::cos(pi * (i + 0.75) / (n + 0.5));
+        double pp = 0.0;
+
+        // Refine root using Newton's method
+        for (int iter = 0; iter < 100; ++iter) {
+
+            // Evaluate Legendre polynomial using the recurrence relation
+            double p1 = 1.0;
+            double p2 = 0.0;
+            for (int j = 1; j <= n; ++j) {
+                double p3 = p2;
+                p2        = p1;
+                p1        = ((2.0*j - 1.0) * z * p2 - (j - 1.0) * p3) / j;
+            }
+
+            // Compute derivative and Newton step
+            pp        = n * (z * p1 - p2) / (z * z - 1.0);
+            double z1 = z;
+            z         = z1 - p1 / pp;
+            if (std::abs(z - z1) < 3.0e-15) {
+                break;
+            }
+
+        } // endfor: Newton iterations
+
+        // Store symmetric abscissae and weights
+        m_gl_x[i]     = -z;
+        m_gl_x[n-1-i] =  z;
+        m_gl_w[i]     = 2.0 / ((1.0 - z * z) * pp * pp);
+        m_gl_w[n-1-i] = m_gl_w[i];
+
+    } // endfor: looped over roots
+
+    // Return
+    return;
+}
@@ -195,6 +195,41 @@ void GEvents::gti(const GGti& gti)
 }
 
 
+/***********************************************************************//**
+ * @brief Allocate event view
+ *
+ * Returns a new event view that can be passed to the event() method. The
+ * view is owned by the caller, who is responsible for deleting it. The
+ * default implementation returns NULL, as the events of containers that
+ * hold their events explicitly can be accessed concurrently without a
+ * view.
+ ***************************************************************************/
+GEvent* GEvents::view(void) const
+{
+    // Return
+    return NULL;
+}
+
+
+/***********************************************************************//**
+ * @brief Return event using an event view
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event view allocated by view() (may be NULL).
+ *
+ * Returns a pointer to the event with the specified @p index. Containers
+ * that fill their events on access use the caller owned @p view, hence
+ * several threads may access the same container concurrently provided that
+ * each thread uses its own view. The default implementation ignores the
+ * view and uses the element access operator.
+ ***************************************************************************/
+const GEvent* GEvents::event(const int& index, GEvent* view) const
+{
+    // Return event
+    return ((*this)[index]);
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                          GEvents event iterator                         =
@@ -40,6 +40,11 @@
 /* __ Method name definitions ____________________________________________ */
 #define G_MODEL                   "GObservation::model(GModels&, GPointing&,"\
                                     " GInstDir&, GEnergy&, GTime&, GVector*)"
+#define G_MODEL_RANGE      "GObservation::model(GModels&, int&, int&, double*,"\
+                                                         " double*, GEvent*)"
+#define G_MODEL_COMP       "GObservation::model(GModel&, int&, int&, double*,"\
+                                                         " double*, GEvent*)"
+#define G_NPRED                     "GObservation::npred(GModel&, GVector*)"
 #define G_EVENTS                                     "GObservation::events()"
 #define G_NPRED_TEMP                 "GObservation::npred_temp(GModel&, int)"
 #define G_NPRED_SPEC              "GObservation::npred_spec(GModel&, GTime&)"
@@ -234,6 +239,199 @@ double GObservation::model(const GModels& models, const GEvent& event,
 }
 
 
+/***********************************************************************//**
+ * @brief Return model values and gradients for a range of events
+ *
+ * @param[in] models Model descriptor.
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[out] values Model values (iend-ibegin elements).
+ * @param[out] gradients Model gradients ((iend-ibegin)*models.npars()
+ *                       elements).
+ * @param[in] view Event view of the events container (optional).
+ *
+ * @exception GException::out_of_range
+ *            Event range is not valid.
+ *
+ * Computes the model values and parameter gradients for the events
+ * [ibegin,iend[ of the observation. The result for event ibegin+i is
+ * identical to that of model(models, event, gradient): the value is stored
+ * in values[i] and the gradient with respect to parameter k in
+ * gradients[i*models.npars()+k].
+ *
+ * The models are evaluated using model_range(), which allows models and
+ * derived observation classes to share computations between events.
+ * Gradients of free parameters without analytical gradient are computed
+ * numerically for each event.
+ *
+ * The events are accessed through the event view @p view that has been
+ * allocated by GEvents::view(). If the response is reentrant (see
+ * GResponse::isreentrant()), several threads may evaluate different event
+ * ranges of the same observation concurrently, provided that each thread
+ * uses its own view and models.
+ ***************************************************************************/
+void GObservation::model(const GModels& models, const int& ibegin,
+                         const int& iend, double* values,
+                         double* gradients, GEvent* view) const
+{
+    // Check event range
+    if (ibegin < 0 || iend < ibegin || iend > events()->size()) {
+        throw GException::out_of_range(G_MODEL_RANGE, iend, ibegin,
+                                       events()->size());
+    }
+
+    // Get dimensions
+    int num   = iend - ibegin;
+    int npars = models.npars();
+
+    // Initialise values and gradients
+    for (int i = 0; i < num; ++i) {
+        values[i] = 0.0;
+    }
+    for (int i = 0; i < num*npars; ++i) {
+        gradients[i] = 0.0;
+    }
+
+    // Continue only if there are events
+    if (num > 0) {
+
+        // Allocate model working arrays
+        std::vector<double> wrk_values(num);
+        std::vector<double> wrk_grads;
+
+        // Loop over models
+        int igrad = 0;
+        for (int m = 0; m < models.size(); ++m) {
+
+            // Get model pointer. Continue only if pointer is valid
+            const GModel* mptr = models[m];
+            if (mptr != NULL) {
+
+                // Get number of model parameters
+                int n = mptr->size();
+
+                // Continue only if model applies to specific instrument and
+                // observation identifier
+                if (mptr->isvalid(instrument(), id())) {
+
+                    // Evaluate model for all events
+                    wrk_grads.resize(num*n+1);
+                    model(*mptr, ibegin, iend, &wrk_values[0], &wrk_grads[0],
+                          view);
+
+                    // Add model values
+                    for (int i = 0; i < num; ++i) {
+                        values[i] += wrk_values[i];
+                    }
+
+                    // Set model gradients for free parameters
+                    for (int k = 0; k < n; ++k) {
+                        if ((*mptr)[k].isfree()) {
+                            double* grad = gradients + igrad + k;
+                            for (int i = 0; i < num; ++i, grad += npars) {
+                                *grad = wrk_grads[i*n+k];
+                            }
+                        }
+                    }
+
+                } // endif: model component was valid for instrument
+
+                // Increment parameter counter for gradients
+                igrad += n;
+
+            } // endif: model was valid
+
+        } // endfor: looped over models
+
+    } // endif: there were events
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return values and gradients of one model for a range of events
+ *
+ * @param[in] model Model component.
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[out] values Model values (iend-ibegin elements).
+ * @param[out] gradients Model gradients ((iend-ibegin)*model.size()
+ *                       elements).
+ * @param[in] view Event view of the events container (optional).
+ *
+ * @exception GException::out_of_range
+ *            Event range is not valid.
+ *
+ * Computes the values and parameter gradients of a single model component
+ * for the events [ibegin,iend[ of the observation. The value for event
+ * ibegin+i is stored in values[i] and the gradient with respect to model
+ * parameter k in gradients[i*model.size()+k]. Gradients of fixed
+ * parameters are set to zero. If the model does not apply to the
+ * instrument and identifier of the observation, all values and gradients
+ * are zero.
+ *
+ * The sum over all model components is identical to the result of
+ * model(const GModels&, const int&, const int&, double*, double*, GEvent*),
+ * which allows callers to evaluate model components separately.
+ ***************************************************************************/
+void GObservation::model(const GModel& model, const int& ibegin,
+                         const int& iend, double* values,
+                         double* gradients, GEvent* view) const
+{
+    // Check event range
+    if (ibegin < 0 || iend < ibegin || iend > events()->size()) {
+        throw GException::out_of_range(G_MODEL_COMP, iend, ibegin,
+                                       events()->size());
+    }
+
+    // Get dimensions
+    int num = iend - ibegin;
+    int n   = model.size();
+
+    // Continue only if there are events and if model applies to specific
+    // instrument and observation identifier ...
+    if (num > 0 && model.isvalid(instrument(), id())) {
+
+        // Evaluate model for all events
+        model_range(model, ibegin, iend, values, gradients, view);
+
+        // Set model gradients. Gradients of fixed parameters are zero,
+        // gradients of parameters without analytical gradient are computed
+        // numerically for each event.
+        for (int k = 0; k < n; ++k) {
+            double* grad = gradients + k;
+            if (!model[k].isfree()) {
+                for (int i = 0; i < num; ++i, grad += n) {
+                    *grad = 0.0;
+                }
+            }
+            else if (!model[k].hasgrad() || m_numeric_grad) {
+                for (int i = 0; i < num; ++i, grad += n) {
+                    *grad = model_grad(model, *(events()->event(ibegin+i, view)),
+                                       k);
+                }
+            }
+        }
+
+    } // endif: model component was valid
+
+    // ... otherwise set values and gradients to zero
+    else {
+        for (int i = 0; i < num; ++i) {
+            values[i] = 0.0;
+        }
+        for (int i = 0; i < num*n; ++i) {
+            gradients[i] = 0.0;
+        }
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Return total number (and optionally gradient) of predicted counts
  *        for all models
@@ -309,6 +507,81 @@ double GObservation::npred(const GModels& models, GVector* gradient) const
 }
 
 
+/***********************************************************************//**
+ * @brief Prepare observation for the evaluation of models
+ *
+ * @param[in] models Models.
+ *
+ * This method is called by the optimizer before the models are evaluated
+ * and before the events of the observation are distributed over several
+ * threads. Derived classes may overload the method to set up model
+ * dependent information that is then shared by the threads that evaluate
+ * the models. The default implementation does nothing.
+ ***************************************************************************/
+void GObservation::prepare(const GModels& models)
+{
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return number (and optionally gradient) of predicted counts for
+ *        one model
+ *
+ * @param[in] model Model component.
+ * @param[out] gradient Model parameter gradients (optional).
+ *
+ * @exception GException::gradient_par_mismatch
+ *            Dimension of gradient vector mismatches number of parameters.
+ *
+ * Returns the number of predicted counts within the analysis region for a
+ * single model component. If NULL is passed for the gradient vector then
+ * gradients will not be computed. If the model does not apply to the
+ * instrument and identifier of the observation, zero is returned.
+ ***************************************************************************/
+double GObservation::npred(const GModel& model, GVector* gradient) const
+{
+    // Verify that gradient vector and model have the same dimension
+    #if defined(G_RANGE_CHECK)
+    if (gradient != NULL) {
+        if (model.size() != gradient->size()) {
+            throw GException::gradient_par_mismatch(G_NPRED,
+                                                    gradient->size(),
+                                                    model.size());
+        }
+    }
+    #endif
+
+    // Initialise
+    double npred = 0.0;
+
+    // If gradient is available then reset gradient vector elements to 0
+    if (gradient != NULL) {
+        (*gradient) = 0.0;
+    }
+
+    // Continue only if model applies to specific instrument and
+    // observation identifier
+    if (model.isvalid(instrument(), id())) {
+
+        // Determine Npred for model
+        npred = npred_temp(model);
+
+        // Optionally determine Npred gradients
+        if (gradient != NULL) {
+            for (int k = 0; k < model.size(); ++k) {
+                (*gradient)[k] = npred_grad(model, k);
+            }
+        }
+
+    } // endif: model component was valid for instrument
+
+    // Return prediction
+    return npred;
+}
+
+
 /***********************************************************************//**
  * @brief Set observation name
  *
@@ -387,6 +660,27 @@ void GObservation::statistics(const std::string& statistics)
 }
 
 
+/***********************************************************************//**
+ * @brief Set numerical gradient computation
+ *
+ * @param[in] numeric Compute all gradients numerically?
+ *
+ * If @p numeric is true, model_grad() and the event range model() method
+ * ignore analytical parameter gradients and compute all gradients of free
+ * parameters numerically. This allows validating analytical gradients,
+ * such as the spatial gradients that are provided by the instrument
+ * response, against the numerical derivatives.
+ ***************************************************************************/
+void GObservation::numeric_grad(const bool& numeric)
+{
+    // Set flag
+    m_numeric_grad = numeric;
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Return event container
  *
@@ -421,8 +715,9 @@ void GObservation::init_members(void)
     // Initialise members
     m_name.clear();
     m_id.clear();
-    m_statistics = "Poisson";
-    m_events     = NULL;
+    m_statistics   = "Poisson";
+    m_events       = NULL;
+    m_numeric_grad = false;
 
     // Return
     return;
@@ -439,9 +734,10 @@ void GObservation::init_members(void)
 void GObservation::copy_members(const GObservation& obs)
 {
     // Copy members
-    m_name       = obs.m_name;
-    m_id         = obs.m_id;
-    m_statistics = obs.m_statistics;
+    m_name         = obs.m_name;
+    m_id           = obs.m_id;
+    m_statistics   = obs.m_statistics;
+    m_numeric_grad = obs.m_numeric_grad;
 
     // Clone members
     m_events = (obs.m_events != NULL) ? obs.m_events->clone() : NULL;
@@ -467,6 +763,33 @@ void GObservation::free_members(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate model for a range of events
+ *
+ * @param[in] model Model.
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[out] values Model values (iend-ibegin elements).
+ * @param[out] gradients Parameter gradients ((iend-ibegin)*model.size()
+ *                       elements).
+ * @param[in] view Event view of the events container (may be NULL).
+ *
+ * Evaluates a single model for the events [ibegin,iend[ by calling
+ * GModel::eval_gradients_range(). Derived classes may overload this method
+ * to provide instrument specific optimisations.
+ ***************************************************************************/
+void GObservation::model_range(const GModel& model, const int& ibegin,
+                               const int& iend, double* values,
+                               double* gradients, GEvent* view) const
+{
+    // Evaluate model
+    model.eval_gradients_range(*this, ibegin, iend, values, gradients, view);
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                          Model gradient methods                         =
@@ -513,8 +836,9 @@ double GObservation::model_grad(const GModel& model, const GEvent& event,
     // Compute gradient only if parameter is free
     if (model[ipar].isfree()) {
 
-        // If model has a gradient then use it
-        if (model[ipar].hasgrad()) {
+        // If model has a gradient then use it (unless numerical gradients
+        // have been requested)
+        if (model[ipar].hasgrad() && !m_numeric_grad) {
             grad = model[ipar].gradient();
         }
 
@@ -421,11 +421,15 @@ void GObservations::models(const std::string& filename)
  * @brief Optimise model parameters using optimiser
  *
  * @param[in] opt Optimiser.
+ *
+ * The events of each observation are distributed over the number of
+ * threads that has been set using nthreads().
  ***************************************************************************/
 void GObservations::optimize(GOptimizer& opt)
 {
     // Set optimizer function
     GObservations::optimizer fct(this);
+    fct.nthreads(m_nthreads);
 
     // Optimise model parameters
     m_models = opt(fct, m_models);
@@ -438,6 +442,27 @@ void GObservations::optimize(GOptimizer& opt)
 }
 
 
+/***********************************************************************//**
+ * @brief Set number of threads per observation
+ *
+ * @param[in] nthreads Number of threads per observation.
+ *
+ * Sets the number of threads over which the events (or bins) of a single
+ * observation are distributed by optimize() (see
+ * GObservations::optimizer::nthreads()). If @p nthreads is 1 (the
+ * default), the observations are distributed over the available threads
+ * instead.
+ ***************************************************************************/
+void GObservations::nthreads(const int& nthreads)
+{
+    // Set number of threads (at least one)
+    m_nthreads = (nthreads > 1) ? nthreads : 1;
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print observations information
  ***************************************************************************/
@@ -529,7 +554,8 @@ void GObservations::init_members(void)
     // Initialise members
     m_obs.clear();
     m_models.clear();
-    m_npred = 0.0;
+    m_npred    = 0.0;
+    m_nthreads = 1;
 
     // Return
     return;
@@ -547,8 +573,9 @@ void GObservations::init_members(void)
 void GObservations::copy_members(const GObservations& obs)
 {
     // Copy attributes
-    m_models = obs.m_models;
-    m_npred  = obs.m_npred;
+    m_models   = obs.m_models;
+    m_npred    = obs.m_npred;
+    m_nthreads = obs.m_nthreads;
 
     // Copy observations
     m_obs.clear();
@@ -46,6 +46,9 @@
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_EVAL_BLOCK  256 //!< Number of events per model evaluation call
+#define G_DENSE_NPARS  50 //!< Maximum number of parameters for dense curvature
+#define G_CACHE_MAX 10000000 //!< Maximum number of cached values of all observations
 
 /* __ Debug definitions __________________________________________________ */
 #define G_EVAL_TIMING   0 //!< Perform optimizer timing (0=no, 1=yes)
@@ -165,6 +168,31 @@ GObservations::optimizer& GObservations::optimizer::operator= (const optimizer&
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Clone optimizer function
+ *
+ * The clone evaluates its own copy of the observations, and has its own
+ * workspaces and model caches. Since the evaluation modifies internal
+ * state of the observations (event access, caches of the instrument
+ * response), this allows evaluating the clone concurrently with the
+ * original.
+ ***************************************************************************/
+GObservations::optimizer* GObservations::optimizer::clone(void) const
+{
+    // Copy optimizer function
+    optimizer* fct = new optimizer(*this);
+
+    // Attach copy of observations unless the copy already owns one
+    if (fct->m_this != NULL && fct->m_obs_copy == NULL) {
+        fct->m_obs_copy = m_this->clone();
+        fct->m_this     = fct->m_obs_copy;
+    }
+
+    // Return clone
+    return fct;
+}
+
+
 /***********************************************************************//**
  * @brief   Evaluate log-likelihood function
  *
@@ -178,6 +206,20 @@ GObservations::optimizer& GObservations::optimizer::operator= (const optimizer&
  * Poisson and Gaussian statistics. 
  * Note that different statistics and different analysis methods
  * (binned/unbinned) may be combined.
+ *
+ * By default, the observations are distributed over the available
+ * threads. If more than one thread per observation has been requested
+ * using the nthreads() method, the observations are processed one after
+ * the other and the events (or bins) of each observation are distributed
+ * over the threads instead.
+ *
+ * If the computation of the curvature matrix has been switched off using
+ * curvature(false), only the function value and the gradient are
+ * computed and the curvature matrix is returned empty.
+ *
+ * Before the evaluation, each observation is given the opportunity to
+ * prepare the evaluation of the models (see GObservation::prepare()).
+ * Model contributions are cached between evaluations (see cache()).
  ***************************************************************************/
 void GObservations::optimizer::eval(const GOptimizerPars& pars) 
 {
@@ -200,191 +242,142 @@ void GObservations::optimizer::eval(const GOptimizerPars& pars)
             continue;
         }
 
-        // Free old memory
-        if (m_gradient != NULL) delete m_gradient;
-        if (m_covar    != NULL) delete m_covar;
-        if (m_wrk_grad != NULL) delete m_wrk_grad;
-
-        // Initialise value, gradient vector and curvature matrix
-        m_value    = 0.0;
-        m_npred    = 0.0;
-        m_gradient = new GVector(npars);
-        m_covar    = new GSparseMatrix(npars,npars);
-        m_wrk_grad = new GVector(npars);
-        m_covar->stack_init(npars,10000);
-        
-        // Allocate vectors to save working variables of each thread
-        std::vector<GVector*>       vect_cpy_grad;
-        std::vector<GSparseMatrix*> vect_cpy_covar;
-        std::vector<double*>        vect_cpy_value;
-        std::vector<double*>        vect_cpy_npred;
-        
-        // Here OpenMP will paralellize the execution. The following code will
-        // be executed by the differents threads. In order to avoid protecting
-        // attributes ( m_value,m_npred, m_gradient and m_covar), each thread
-        // works with its own working variables (cpy_*). When a thread starts,
-        // we add working variables in a vector (vect_cpy_*). When computation
-        // is finished we just add all elements contain in the vector to the
-        // attributes value.
-        #pragma omp parallel
-        {
-            // Allocate and initialize variable copies for multi-threading
-            GModels        cpy_model((GModels&)pars);
-            GVector        cpy_wrk_grad(npars);
-            GVector*       cpy_gradient = new GVector(npars);
-            GSparseMatrix* cpy_covar    = new GSparseMatrix(npars,npars);
-            double*        cpy_npred    = new double(0.0);
-            double*        cpy_value    = new double(0.0);
-            cpy_covar->stack_init(npars,10000);
-            
-            // Push variable copies into vector. This is a critical zone to
-            // avoid multiple thread pushing simultaneously.
-            #pragma omp critical
-            {
-                vect_cpy_grad.push_back(cpy_gradient);
-                vect_cpy_covar.push_back(cpy_covar); 
-                vect_cpy_value.push_back(cpy_value);
-                vect_cpy_npred.push_back(cpy_npred);
-            }
+        // Allocate gradient vectors and curvature matrix if the number of
+        // parameters has changed, otherwise reuse them
+        if (m_gradient == NULL || m_covar == NULL ||
+            m_gradient->size() != npars) {
+            if (m_gradient != NULL) delete m_gradient;
+            if (m_wrk_grad != NULL) delete m_wrk_grad;
+            if (m_covar    != NULL) delete m_covar;
+            m_gradient = new GVector(npars);
+            m_wrk_grad = new GVector(npars);
+            m_covar    = new GSparseMatrix(npars,npars);
+        }
 
-            // The omp for directive will deal the iterations on the differents
-            // threads.
-            #pragma omp for
-            // Loop over all observations
+        // Initialise value, gradient vector and curvature matrix. The
+        // curvature matrix is set to zero since the optimizer may have
+        // decomposed it in place. It has no filling stack, as the
+        // contributions are accumulated in the workspaces and added to the
+        // curvature matrix in a fixed order.
+        m_value     = 0.0;
+        m_npred     = 0.0;
+        *m_gradient = 0.0;
+        m_covar->zero();
+
+        // Prepare the observations for the evaluation of the models
+        const GModels* models = dynamic_cast<const GModels*>(&pars);
+        if (models != NULL) {
             for (int i = 0; i < m_this->size(); ++i) {
-    
-                // Extract statistics for this observation
-                std::string statistics = m_this->m_obs[i]->statistics();
-    
-                // Unbinned analysis
-                if (dynamic_cast<const GEventList*>(m_this->m_obs[i]->events()) != NULL) {
-    
-                    // Poisson statistics
-                    if (toupper(statistics) == "POISSON") {
-    
-                        // Determine Npred value and gradient for this observation
-                        double npred = m_this->m_obs[i]->npred(cpy_model, &cpy_wrk_grad);
-    
-                        // Update the Npred value, gradient.
-                        *cpy_npred    += npred;
-                        *cpy_gradient += cpy_wrk_grad;
-
-                        // Optionally show debug information
-                        #if G_EVAL_DEBUG
-                        #pragma omp critial single
-                        {
-                            std::cout << "Unbinned Poisson (" << i << "):";
-                            std::cout << " Npred=" << npred;
-                            std::cout << " Grad="<< *copy_wrk_grad << std::endl;
-                            std::cout << "Sum:";
-                            std::cout << " Npred=" << *cpy_npred;
-                            std::cout << " Grad=" << *cpy_gradient << std::endl;
-                        }
-                        #endif
-    
-                        // Update the log-likelihood
-                        poisson_unbinned(*(m_this->m_obs[i]), 
-                                          cpy_model,
-                                         *cpy_covar,
-                                         *cpy_gradient,
-                                         *cpy_value,
-                                          cpy_wrk_grad);
-    
-                        // Add the Npred value to the log-likelihood
-                        *cpy_value += npred;
-    
-                    } // endif: Poisson statistics
-    
-                    // ... otherwise throw an exception
-                    else {
-                        throw GException::invalid_statistics(G_EVAL, statistics,
-                            "Unbinned optimization requires Poisson statistics.");
-                    }
-    
-                } // endif: unbinned analysis
-    
-                // ... or binned analysis
-                else {
-    
-                    // Poisson statistics
-                    if (toupper(statistics) == "POISSON") {
-                        #if G_EVAL_DEBUG
-                        std::cout << "Binned Poisson" << std::endl;
-                        #endif
-                        poisson_binned(*(m_this->m_obs[i]), 
-                                        cpy_model,
-                                       *cpy_covar,
-                                       *cpy_gradient,
-                                       *cpy_value,
-                                       *cpy_npred,
-                                        cpy_wrk_grad);
-                    }
-    
-                    // ... or Gaussian statistics
-                    else if (toupper(statistics) == "GAUSSIAN") {
-                        #if G_EVAL_DEBUG
-                        std::cout << "Binned Gaussian" << std::endl;
-                        #endif
-                        gaussian_binned(*(m_this->m_obs[i]), 
-                                         cpy_model,
-                                        *cpy_covar,
-                                        *cpy_gradient,
-                                        *cpy_value,
-                                        *cpy_npred,
-                                         cpy_wrk_grad);
-                    }
-    
-                    // ... or unsupported
-                    else {
-                        throw GException::invalid_statistics(G_EVAL, statistics,
-                            "Binned optimization requires Poisson or Gaussian statistics.");
-                    }
-    
-                } // endelse: binned analysis
-    
-            } // endfor: looped over observations
-            
-        } // end pragma omp parallel
-        
-        // Now the computation is finished, update attributes.
-        // For each omp section, a thread will be created.
-        #pragma omp sections
-        {
-            #pragma omp section
-            {
-                for (int i = 0; i < vect_cpy_covar.size() ; ++i) {
-                    *m_covar += *(vect_cpy_covar.at(i));
-                    delete vect_cpy_covar.at(i);
-                }
+                m_this->m_obs[i]->prepare(*models);
             }
+        }
 
-            #pragma omp section
-            {
-                for (int i = 0; i < vect_cpy_grad.size(); ++i){
-                    *m_gradient += *(vect_cpy_grad.at(i));
-                    delete vect_cpy_grad.at(i);
-                }
+        // Determine the models that changed since the last evaluation and
+        // prepare the model caches
+        prepare_cache(pars);
+
+        // If events should be distributed over the threads then loop over
+        // the observations serially. Each observation will then partition
+        // its events over the threads.
+        if (m_nthreads > 1) {
+            alloc_workspaces(1);
+            workspace& wrk = *m_wrk[0];
+            wrk.resize(npars);
+            wrk.covar->zero();
+            for (int i = 0; i < m_this->size(); ++i) {
+                eval_observation(*(m_this->m_obs[i]),
+                                  pars,
+                                 *wrk.covar,
+                                 *m_gradient,
+                                  m_value,
+                                  m_npred,
+                                 *m_wrk_grad,
+                                  wrk);
             }
+            wrk.covar->stack_flush();
+            *m_covar += *wrk.covar;
+        }
+
+        // ... otherwise distribute the observations over the threads
+        else {
+
+            // Determine the maximum number of threads
+            #ifdef _OPENMP
+            int nthreads = omp_get_max_threads();
+            #else
+            int nthreads = 1;
+            #endif
 
-            #pragma omp section
+            // Allocate workspaces and vectors to save working variables of
+            // each thread
+            alloc_workspaces(nthreads);
+            std::vector<int>    vect_cpy_used(nthreads, 0);
+            std::vector<double> vect_cpy_value(nthreads, 0.0);
+            std::vector<double> vect_cpy_npred(nthreads, 0.0);
+
+            // Here OpenMP will paralellize the execution. The following code
+            // will be executed by the differents threads. In order to avoid
+            // protecting attributes ( m_value,m_npred, m_gradient and
+            // m_covar), each thread works with its own workspace and working
+            // variables (cpy_*) that are stored by thread number in the
+            // vectors vect_cpy_*. When computation is finished we add all
+            // elements in thread order, which makes the result reproducible.
+            #pragma omp parallel
             {
-                for(int i = 0; i < vect_cpy_npred.size(); ++i){
-                    m_npred += *(vect_cpy_npred.at(i));
-                    delete vect_cpy_npred.at(i);
+                // Get thread number
+                #ifdef _OPENMP
+                int ithread = omp_get_thread_num();
+                #else
+                int ithread = 0;
+                #endif
+
+                // Prepare the workspace of this thread. The model copy is
+                // only synchronised with the actual parameter values, and
+                // the working arrays and the curvature matrix are only
+                // allocated once per fit. Each thread writes only into its
+                // own slot, hence no critical zone is needed.
+                workspace& wrk       = *m_wrk[ithread];
+                wrk.resize(npars);
+                GModels&   cpy_model = wrk.sync(pars);
+                wrk.gradient         = 0.0;
+                wrk.covar->zero();
+                vect_cpy_used[ithread] = 1;
+
+                // The omp for directive will deal the iterations on the
+                // differents threads.
+                #pragma omp for
+                // Loop over all observations
+                for (int i = 0; i < m_this->size(); ++i) {
+                    eval_observation(*(m_this->m_obs[i]),
+                                      cpy_model,
+                                     *wrk.covar,
+                                      wrk.gradient,
+                                      vect_cpy_value[ithread],
+                                      vect_cpy_npred[ithread],
+                                      wrk.wrk_grad,
+                                      wrk);
                 }
-            }
 
-            #pragma omp section
-            {
-                for (int i = 0; i < vect_cpy_value.size(); ++i){
-                    m_value += *(vect_cpy_value.at(i));
-                    delete vect_cpy_value.at(i);
+                // Flush the stack of the curvature matrix
+                wrk.covar->stack_flush();
+
+            } // end pragma omp parallel
+
+            // Now the computation is finished, update attributes in thread
+            // order
+            for (int i = 0; i < nthreads; ++i) {
+                if (vect_cpy_used[i]) {
+                    *m_covar    += *(m_wrk[i]->covar);
+                    *m_gradient += m_wrk[i]->gradient;
                 }
+                m_npred += vect_cpy_npred[i];
+                m_value += vect_cpy_value[i];
             }
-        } // end of pragma omp sections
 
-        // Release stack
-        m_covar->stack_destroy();
+        } // endelse: distributed observations over threads
+
+        // Signal that the model caches hold all events
+        finish_cache();
 
     } while(0); // endwhile: main loop
     
@@ -424,6 +417,73 @@ void GObservations::optimizer::eval(const GOptimizerPars& pars)
 }
 
 
+/***********************************************************************//**
+ * @brief Set number of threads per observation
+ *
+ * @param[in] nthreads Number of threads per observation.
+ *
+ * Sets the number of threads over which the events (or bins) of a single
+ * observation are distributed. If @p nthreads is 1 (the default), the
+ * observations are distributed over the available threads instead.
+ *
+ * The events are split into @p nthreads contiguous ranges, and the
+ * contributions of each range are summed in range order. Results are
+ * therefore reproducible for a given number of threads.
+ *
+ * All event ranges evaluate the same observation, hence no copies of the
+ * observations are made. The events of an observation are only
+ * distributed over the threads if its instrument response may be
+ * evaluated concurrently (see GResponse::isreentrant()); other
+ * observations are evaluated by a single thread.
+ ***************************************************************************/
+void GObservations::optimizer::nthreads(const int& nthreads)
+{
+    // Set number of threads (at least one)
+    m_nthreads = (nthreads > 1) ? nthreads : 1;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set model caching
+ *
+ * @param[in] cache Cache model contributions?
+ *
+ * If caching is enabled (the default), the contributions of each model to
+ * the model values and gradients of all events (or bins) and to Npred are
+ * kept for each observation. In the next evaluation, only the models for
+ * which a parameter value, scale or free attribute has changed are
+ * recomputed, while the cached contributions are used for all other
+ * models. This speeds up fits in which only some of the models are varied,
+ * such as source-by-source refits over a fixed background. The result is
+ * identical to an evaluation without cache.
+ *
+ * The caches are reset if the number of models or parameters changes.
+ * The caches of all observations hold together at most G_CACHE_MAX values.
+ * Observations are cached in the order of the container, and observations
+ * for which the total would exceed G_CACHE_MAX values are not cached.
+ ***************************************************************************/
+void GObservations::optimizer::cache(const bool& cache)
+{
+    // Set caching flag
+    m_use_cache = cache;
+
+    // Release caches if caching is disabled
+    if (!m_use_cache) {
+        m_cache.clear();
+        m_changed.clear();
+        m_par_values.clear();
+        m_par_scales.clear();
+        m_par_free.clear();
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Evaluate log-likelihood function for Poisson statistics and
  *        unbinned analysis
@@ -469,6 +529,47 @@ void GObservations::optimizer::poisson_unbinned(const GObservation&   obs,
                                                 GVector&              gradient,
                                                 double&               value,
                                                 GVector&              wrk_grad)
+{
+    // Unbinned analysis does not update Npred
+    double npred = 0.0;
+
+    // Evaluate events
+    workspace wrk;
+    eval_events(&GObservations::optimizer::poisson_unbinned_range,
+                obs, pars, covar, gradient, value, npred, wrk_grad, wrk);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate log-likelihood function for Poisson statistics and
+ *        unbinned analysis for a range of events
+ *
+ * @param[in] obs Observation.
+ * @param[in] pars Optimizer parameters.
+ * @param[in] cache Model cache of observation (NULL if none).
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event.
+ * @param[in,out] covar Covariance matrix.
+ * @param[in,out] gradient Gradient.
+ * @param[in,out] value Likelihood value.
+ * @param[in,out] npred Number of predicted events (not used).
+ * @param[in,out] wrk_grad Gradient working array.
+ * @param[in,out] wrk Workspace.
+ ***************************************************************************/
+void GObservations::optimizer::poisson_unbinned_range(const GObservation&   obs,
+                                                      const GOptimizerPars& pars,
+                                                      obs_cache*            cache,
+                                                      const int&            ibegin,
+                                                      const int&            iend,
+                                                      GSparseMatrix&        covar,
+                                                      GVector&              gradient,
+                                                      double&               value,
+                                                      double&               npred,
+                                                      GVector&              wrk_grad,
+                                                      workspace&            wrk)
 {
     // Timing measurement
     #if G_EVAL_TIMING
@@ -482,19 +583,45 @@ void GObservations::optimizer::poisson_unbinned(const GObservation&   obs,
     // Get number of parameters
     int npars = pars.npars();
 
-    // Allocate some working arrays
-    int*    inx    = new int[npars];
-    double* values = new double[npars];
-
-    
-    // Iterate over all events
-    for (int i = 0; i < obs.events()->size(); ++i) {
+    // Get working arrays and model value and gradient arrays for a block
+    // of events from the workspace
+    wrk.resize(npars);
+    int*    inx     = &wrk.inx[0];
+    double* values  = &wrk.values[0];
+    double* mvalues = &wrk.mvalues[0];
+    double* mgrads  = &wrk.mgrads[0];
+    int     iblock  = ibegin;
+    int     eblock  = ibegin;
+
+    // For a small number of parameters accumulate the curvature matrix in
+    // a dense array and add it to the sparse matrix at the end
+    double* dense = NULL;
+    if (m_curvature && npars <= G_DENSE_NPARS) {
+        dense = &wrk.dense[0];
+        for (int k = 0; k < npars*npars; ++k) {
+            dense[k] = 0.0;
+        }
+    }
 
-        // Get event pointer
-        const GEvent* event = (*obs.events())[i];
+    // Iterate over all events in range
+    for (int i = ibegin; i < iend; ++i) {
+
+        // Evaluate model and gradients for the next block of events. This
+        // is done before accessing the event, as model evaluation may
+        // alter the event returned by the events container.
+        if (i >= eblock) {
+            iblock = i;
+            eblock = (i+G_EVAL_BLOCK < iend) ? i+G_EVAL_BLOCK : iend;
+            mgrads = eval_model(obs, pars, cache, iblock, eblock, mvalues,
+                                wrk);
+        }
 
         // Get model and derivative
-        double model = obs.model((GModels&)pars, *event, &wrk_grad);
+        double model = mvalues[i-iblock];
+        const double* grad = mgrads + (i-iblock)*npars;
+        for (int k = 0; k < npars; ++k) {
+            wrk_grad[k] = grad[k];
+        }
 
         // Skip bin if model is too small (avoids -Inf or NaN gradients)
         if (model <= m_minmod) {
@@ -534,23 +661,36 @@ void GObservations::optimizer::poisson_unbinned(const GObservation&   obs,
             // Update gradient.
             gradient[jpar] -= fb * g;
 
-            // Loop over rows
-            register int* ipar = inx;
+            // Skip curvature matrix if it is not requested
+            if (!m_curvature) {
+                continue;
+            }
 
-            for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                values[idev] = fa_i * wrk_grad[*ipar];
+            // Update lower triangle of dense matrix ...
+            if (dense != NULL) {
+                double* col = dense + jpar*npars;
+                for (int idev = jdev; idev < ndev; ++idev) {
+                    col[inx[idev]] += fa_i * wrk_grad[inx[idev]];
+                }
             }
 
-            // Add column to matrix
-            covar.add_col(values, inx, ndev, jpar);
+            // ... or add column to sparse matrix
+            else {
+                int* ipar = inx;
+                for (int idev = 0; idev < ndev; ++idev, ++ipar) {
+                    values[idev] = fa_i * wrk_grad[*ipar];
+                }
+                covar.add_col(values, inx, ndev, jpar);
+            }
 
         } // endfor: looped over columns
 
     } // endfor: iterated over all events
 
-    // Free temporary memory
-    if (values != NULL) delete [] values;
-    if (inx    != NULL) delete [] inx;
+    // Add dense curvature matrix to sparse matrix
+    if (dense != NULL) {
+        add_dense(covar, dense, npars, inx, values);
+    }
 
     // Optionally dump gradient and covariance matrix
     #if G_EVAL_DEBUG
@@ -623,6 +763,44 @@ void GObservations::optimizer::poisson_binned(const GObservation&   obs,
                                               double&               value,
                                               double&               npred,
                                               GVector&              wrk_grad)
+{
+    // Evaluate bins
+    workspace wrk;
+    eval_events(&GObservations::optimizer::poisson_binned_range,
+                obs, pars, covar, gradient, value, npred, wrk_grad, wrk);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate log-likelihood function for Poisson statistics and
+ *        binned analysis for a range of bins
+ *
+ * @param[in] obs Observation.
+ * @param[in] pars Optimizer parameters.
+ * @param[in] cache Model cache of observation (NULL if none).
+ * @param[in] ibegin Index of first bin.
+ * @param[in] iend Index after last bin.
+ * @param[in,out] covar Covariance matrix.
+ * @param[in,out] gradient Gradient.
+ * @param[in,out] value Likelihood value.
+ * @param[in,out] npred Number of predicted events.
+ * @param[in,out] wrk_grad Gradient working array.
+ * @param[in,out] wrk Workspace.
+ ***************************************************************************/
+void GObservations::optimizer::poisson_binned_range(const GObservation&   obs,
+                                                    const GOptimizerPars& pars,
+                                                    obs_cache*            cache,
+                                                    const int&            ibegin,
+                                                    const int&            iend,
+                                                    GSparseMatrix&        covar,
+                                                    GVector&              gradient,
+                                                    double&               value,
+                                                    double&               npred,
+                                                    GVector&              wrk_grad,
+                                                    workspace&            wrk)
 {
     // Timing measurement
     #if G_EVAL_TIMING
@@ -647,12 +825,38 @@ void GObservations::optimizer::poisson_binned(const GObservation&   obs,
     // Get number of parameters
     int npars = pars.npars();
 
-    // Allocate some working arrays
-    int*    inx    = new int[npars];
-    double* values = new double[npars];
+    // Get working arrays and model value and gradient arrays for a block
+    // of events from the workspace
+    wrk.resize(npars);
+    int*    inx     = &wrk.inx[0];
+    double* values  = &wrk.values[0];
+    double* mvalues = &wrk.mvalues[0];
+    double* mgrads  = &wrk.mgrads[0];
+    int     iblock  = ibegin;
+    int     eblock  = ibegin;
+
+    // For a small number of parameters accumulate the curvature matrix in
+    // a dense array and add it to the sparse matrix at the end
+    double* dense = NULL;
+    if (m_curvature && npars <= G_DENSE_NPARS) {
+        dense = &wrk.dense[0];
+        for (int k = 0; k < npars*npars; ++k) {
+            dense[k] = 0.0;
+        }
+    }
 
-    // Iterate over all bins
-    for (int i = 0; i < obs.events()->size(); ++i) {
+    // Iterate over all bins in range
+    for (int i = ibegin; i < iend; ++i) {
+
+        // Evaluate model and gradients for the next block of events. This
+        // is done before accessing the event, as model evaluation may
+        // alter the event returned by the events container.
+        if (i >= eblock) {
+            iblock = i;
+            eblock = (i+G_EVAL_BLOCK < iend) ? i+G_EVAL_BLOCK : iend;
+            mgrads = eval_model(obs, pars, cache, iblock, eblock, mvalues,
+                                wrk);
+        }
 
         // Update number of bins
         #if G_OPT_DEBUG
@@ -661,13 +865,17 @@ void GObservations::optimizer::poisson_binned(const GObservation&   obs,
 
         // Get event pointer
         const GEventBin* bin =
-            (*(static_cast<GEventCube*>(const_cast<GEvents*>(obs.events()))))[i];
+            static_cast<const GEventBin*>(obs.events()->event(i, wrk.view));
 
         // Get number of counts in bin
         double data = bin->counts();
 
         // Get model and derivative
-        double model = obs.model((GModels&)pars, *bin, &wrk_grad);
+        double model = mvalues[i-iblock];
+        const double* grad = mgrads + (i-iblock)*npars;
+        for (int k = 0; k < npars; ++k) {
+            wrk_grad[k] = grad[k];
+        }
 
         // Multiply model by bin size
         model *= bin->size();
@@ -736,14 +944,27 @@ void GObservations::optimizer::poisson_binned(const GObservation&   obs,
                 // Update gradient
                 gradient[jpar] += fc * g;
 
-                // Loop over rows
-                register int* ipar = inx;
-                for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                    values[idev] = fa_i * wrk_grad[*ipar];
+                // Skip curvature matrix if it is not requested
+                if (!m_curvature) {
+                    continue;
                 }
 
-                // Add column to matrix
-                covar.add_col(values, inx, ndev, jpar);
+                // Update lower triangle of dense matrix ...
+                if (dense != NULL) {
+                    double* col = dense + jpar*npars;
+                    for (int idev = jdev; idev < ndev; ++idev) {
+                        col[inx[idev]] += fa_i * wrk_grad[inx[idev]];
+                    }
+                }
+
+                // ... or add column to sparse matrix
+                else {
+                    int* ipar = inx;
+                    for (int idev = 0; idev < ndev; ++idev, ++ipar) {
+                        values[idev] = fa_i * wrk_grad[*ipar];
+                    }
+                    covar.add_col(values, inx, ndev, jpar);
+                }
 
             } // endfor: looped over columns
 
@@ -776,9 +997,10 @@ void GObservations::optimizer::poisson_binned(const GObservation&   obs,
 
     } // endfor: iterated over all events
 
-    // Free temporary memory
-    if (values != NULL) delete [] values;
-    if (inx    != NULL) delete [] inx;
+    // Add dense curvature matrix to sparse matrix
+    if (dense != NULL) {
+        add_dense(covar, dense, npars, inx, values);
+    }
 
     // Dump statistics
     #if G_OPT_DEBUG
@@ -789,7 +1011,7 @@ void GObservations::optimizer::poisson_binned(const GObservation&   obs,
     std::cout << "Sum of data: " << sum_data << std::endl;
     std::cout << "Sum of model: " << sum_model << std::endl;
     std::cout << "Initial statistics: " << init_value << std::endl;
-    std::cout << "Statistics: " << m_value-init_value << std::endl;
+    std::cout << "Statistics: " << value-init_value << std::endl;
     #endif
 
     // Optionally dump gradient and covariance matrix
@@ -864,6 +1086,44 @@ void GObservations::optimizer::gaussian_binned(const GObservation&   obs,
                                                double&               value,
                                                double&               npred,
                                                GVector&              wrk_grad)
+{
+    // Evaluate bins
+    workspace wrk;
+    eval_events(&GObservations::optimizer::gaussian_binned_range,
+                obs, pars, covar, gradient, value, npred, wrk_grad, wrk);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate log-likelihood function for Gaussian statistics and
+ *        binned analysis for a range of bins
+ *
+ * @param[in] obs Observation.
+ * @param[in] pars Optimizer parameters.
+ * @param[in] cache Model cache of observation (NULL if none).
+ * @param[in] ibegin Index of first bin.
+ * @param[in] iend Index after last bin.
+ * @param[in,out] covar Covariance matrix.
+ * @param[in,out] gradient Gradient.
+ * @param[in,out] value Likelihood value.
+ * @param[in,out] npred Number of predicted events.
+ * @param[in,out] wrk_grad Gradient working array.
+ * @param[in,out] wrk Workspace.
+ ***************************************************************************/
+void GObservations::optimizer::gaussian_binned_range(const GObservation&   obs,
+                                                     const GOptimizerPars& pars,
+                                                     obs_cache*            cache,
+                                                     const int&            ibegin,
+                                                     const int&            iend,
+                                                     GSparseMatrix&        covar,
+                                                     GVector&              gradient,
+                                                     double&               value,
+                                                     double&               npred,
+                                                     GVector&              wrk_grad,
+                                                     workspace&            wrk)
 {
     // Timing measurement
     #if G_EVAL_TIMING
@@ -877,16 +1137,42 @@ void GObservations::optimizer::gaussian_binned(const GObservation&   obs,
     // Get number of parameters
     int npars = pars.npars();
 
-    // Allocate some working arrays
-    int*    inx    = new int[npars];
-    double* values = new double[npars];
+    // Get working arrays and model value and gradient arrays for a block
+    // of events from the workspace
+    wrk.resize(npars);
+    int*    inx     = &wrk.inx[0];
+    double* values  = &wrk.values[0];
+    double* mvalues = &wrk.mvalues[0];
+    double* mgrads  = &wrk.mgrads[0];
+    int     iblock  = ibegin;
+    int     eblock  = ibegin;
+
+    // For a small number of parameters accumulate the curvature matrix in
+    // a dense array and add it to the sparse matrix at the end
+    double* dense = NULL;
+    if (m_curvature && npars <= G_DENSE_NPARS) {
+        dense = &wrk.dense[0];
+        for (int k = 0; k < npars*npars; ++k) {
+            dense[k] = 0.0;
+        }
+    }
 
-    // Iterate over all bins
-    for (int i = 0; i < obs.events()->size(); ++i) {
+    // Iterate over all bins in range
+    for (int i = ibegin; i < iend; ++i) {
+
+        // Evaluate model and gradients for the next block of events. This
+        // is done before accessing the event, as model evaluation may
+        // alter the event returned by the events container.
+        if (i >= eblock) {
+            iblock = i;
+            eblock = (i+G_EVAL_BLOCK < iend) ? i+G_EVAL_BLOCK : iend;
+            mgrads = eval_model(obs, pars, cache, iblock, eblock, mvalues,
+                                wrk);
+        }
 
         // Get event pointer
         const GEventBin* bin =
-            (*(static_cast<GEventCube*>(const_cast<GEvents*>(obs.events()))))[i];
+            static_cast<const GEventBin*>(obs.events()->event(i, wrk.view));
 
         // Get number of counts in bin
         double data = bin->counts();
@@ -900,7 +1186,11 @@ void GObservations::optimizer::gaussian_binned(const GObservation&   obs,
         }
 
         // Get model and derivative
-        double model = obs.model((GModels&)pars, *bin, &wrk_grad);
+        double model = mvalues[i-iblock];
+        const double* grad = mgrads + (i-iblock)*npars;
+        for (int k = 0; k < npars; ++k) {
+            wrk_grad[k] = grad[k];
+        }
 
         // Multiply model by bin size
         model *= bin->size();
@@ -949,22 +1239,36 @@ void GObservations::optimizer::gaussian_binned(const GObservation&   obs,
             // Update gradient
             gradient[jpar] -= fa * fa_i;
 
-            // Loop over rows
-            register int* ipar = inx;
-            for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                values[idev] = fa_i * wrk_grad[*ipar];
+            // Skip curvature matrix if it is not requested
+            if (!m_curvature) {
+                continue;
+            }
+
+            // Update lower triangle of dense matrix ...
+            if (dense != NULL) {
+                double* col = dense + jpar*npars;
+                for (int idev = jdev; idev < ndev; ++idev) {
+                    col[inx[idev]] += fa_i * wrk_grad[inx[idev]];
+                }
             }
 
-            // Add column to matrix
-            covar.add_col(values, inx, ndev, jpar);
+            // ... or add column to sparse matrix
+            else {
+                int* ipar = inx;
+                for (int idev = 0; idev < ndev; ++idev, ++ipar) {
+                    values[idev] = fa_i * wrk_grad[*ipar];
+                }
+                covar.add_col(values, inx, ndev, jpar);
+            }
 
         } // endfor: looped over columns
 
     } // endfor: iterated over all events
 
-    // Free temporary memory
-    if (values != NULL) delete [] values;
-    if (inx    != NULL) delete [] inx;
+    // Add dense curvature matrix to sparse matrix
+    if (dense != NULL) {
+        add_dense(covar, dense, npars, inx, values);
+    }
 
     // Optionally dump gradient and covariance matrix
     #if G_EVAL_DEBUG
@@ -1007,7 +1311,17 @@ void GObservations::optimizer::init_members(void)
     m_gradient  = NULL;
     m_covar     = NULL;
     m_this      = NULL;
+    m_obs_copy  = NULL;
     m_wrk_grad  = NULL;
+    m_nthreads  = 1;
+    m_wrk.clear();
+    m_use_cache  = true;
+    m_cache_busy = false;
+    m_cache.clear();
+    m_changed.clear();
+    m_par_values.clear();
+    m_par_scales.clear();
+    m_par_free.clear();
 
     // Return
     return;
@@ -1021,11 +1335,19 @@ void GObservations::optimizer::init_members(void)
  ***************************************************************************/
 void GObservations::optimizer::copy_members(const optimizer& fct)
 {
-    // Copy attributes
-    m_value  = fct.m_value;
-    m_npred  = fct.m_npred;
-    m_minmod = fct.m_minmod;
-    m_minerr = fct.m_minerr;
+    // Copy attributes. If the optimizer owns a copy of the observations
+    // then copy it as well.
+    m_this     = fct.m_this;
+    if (fct.m_obs_copy != NULL) {
+        m_obs_copy = fct.m_obs_copy->clone();
+        m_this     = m_obs_copy;
+    }
+    m_value    = fct.m_value;
+    m_npred    = fct.m_npred;
+    m_minmod   = fct.m_minmod;
+    m_minerr   = fct.m_minerr;
+    m_nthreads = fct.m_nthreads;
+    m_use_cache = fct.m_use_cache;
 
     // Clone gradient if it exists
     if (fct.m_gradient != NULL) m_gradient = new GVector(*fct.m_gradient);
@@ -1036,6 +1358,11 @@ void GObservations::optimizer::copy_members(const optimizer& fct)
     // Clone working gradient if it exists
     if (fct.m_wrk_grad != NULL) m_wrk_grad = new GVector(*fct.m_wrk_grad);
 
+    // Workspaces and model caches are not copied since they are allocated
+    // on demand
+    m_wrk.clear();
+    m_cache.clear();
+
     // Return
     return;
 }
@@ -1050,11 +1377,782 @@ void GObservations::optimizer::free_members(void)
     if (m_gradient != NULL) delete m_gradient;
     if (m_covar    != NULL) delete m_covar;
     if (m_wrk_grad != NULL) delete m_wrk_grad;
+    if (m_obs_copy != NULL) delete m_obs_copy;
+
+    // Free workspaces
+    for (int i = 0; i < (int)m_wrk.size(); ++i) {
+        delete m_wrk[i];
+    }
 
     // Signal free pointers
     m_gradient = NULL;
     m_covar    = NULL;
     m_wrk_grad = NULL;
+    m_obs_copy = NULL;
+    m_wrk.clear();
+    m_cache.clear();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Allocate workspaces
+ *
+ * @param[in] num Number of workspaces.
+ *
+ * Makes sure that at least @p num workspaces exist. Existing workspaces are
+ * kept, so that their model copies and working arrays are reused over all
+ * function evaluations of a fit. This method should not be called from
+ * within a parallel region.
+ ***************************************************************************/
+void GObservations::optimizer::alloc_workspaces(const int& num)
+{
+    // Append missing workspaces
+    while ((int)m_wrk.size() < num) {
+        m_wrk.push_back(new workspace);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate log-likelihood function for one observation
+ *
+ * @param[in] obs Observation.
+ * @param[in] pars Optimizer parameters.
+ * @param[in,out] covar Covariance matrix.
+ * @param[in,out] gradient Gradient.
+ * @param[in,out] value Likelihood value.
+ * @param[in,out] npred Number of predicted events.
+ * @param[in,out] wrk_grad Gradient working array.
+ * @param[in,out] wrk Workspace.
+ *
+ * @exception GException::invalid_statistics
+ *            Invalid optimization statistics encountered.
+ *
+ * Dispatches the observation to the method that corresponds to the
+ * analysis method (binned/unbinned) and the statistics of the observation.
+ ***************************************************************************/
+void GObservations::optimizer::eval_observation(const GObservation&   obs,
+                                                const GOptimizerPars& pars,
+                                                GSparseMatrix&        covar,
+                                                GVector&              gradient,
+                                                double&               value,
+                                                double&               npred,
+                                                GVector&              wrk_grad,
+                                                workspace&            wrk)
+{
+    // Extract statistics for this observation
+    std::string statistics = toupper(obs.statistics());
+
+    // Unbinned analysis
+    if (dynamic_cast<const GEventList*>(obs.events()) != NULL) {
+
+        // Poisson statistics
+        if (statistics == "POISSON") {
+
+            // Determine Npred value and gradient for this observation
+            double obs_npred = eval_npred(obs, pars, find_cache(obs),
+                                          wrk_grad);
+
+            // Update the Npred value, gradient.
+            npred    += obs_npred;
+            gradient += wrk_grad;
+
+            // Optionally show debug information
+            #if G_EVAL_DEBUG
+            std::cout << "Unbinned Poisson:";
+            std::cout << " Npred=" << obs_npred;
+            std::cout << " Grad="<< wrk_grad << std::endl;
+            #endif
+
+            // Update the log-likelihood (unbinned analysis does not update
+            // Npred)
+            double unbinned_npred = 0.0;
+            eval_events(&GObservations::optimizer::poisson_unbinned_range,
+                        obs, pars, covar, gradient, value, unbinned_npred,
+                        wrk_grad, wrk);
+
+            // Add the Npred value to the log-likelihood
+            value += obs_npred;
+
+        } // endif: Poisson statistics
+
+        // ... otherwise throw an exception
+        else {
+            throw GException::invalid_statistics(G_EVAL, statistics,
+                "Unbinned optimization requires Poisson statistics.");
+        }
+
+    } // endif: unbinned analysis
+
+    // ... or binned analysis
+    else {
+
+        // Poisson statistics
+        if (statistics == "POISSON") {
+            #if G_EVAL_DEBUG
+            std::cout << "Binned Poisson" << std::endl;
+            #endif
+            eval_events(&GObservations::optimizer::poisson_binned_range,
+                        obs, pars, covar, gradient, value, npred, wrk_grad,
+                        wrk);
+        }
+
+        // ... or Gaussian statistics
+        else if (statistics == "GAUSSIAN") {
+            #if G_EVAL_DEBUG
+            std::cout << "Binned Gaussian" << std::endl;
+            #endif
+            eval_events(&GObservations::optimizer::gaussian_binned_range,
+                        obs, pars, covar, gradient, value, npred, wrk_grad,
+                        wrk);
+        }
+
+        // ... or unsupported
+        else {
+            throw GException::invalid_statistics(G_EVAL, statistics,
+                "Binned optimization requires Poisson or Gaussian statistics.");
+        }
+
+    } // endelse: binned analysis
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate log-likelihood function kernel over all events of an
+ *        observation
+ *
+ * @param[in] fct Event range kernel.
+ * @param[in] obs Observation.
+ * @param[in] pars Optimizer parameters.
+ * @param[in,out] covar Covariance matrix.
+ * @param[in,out] gradient Gradient.
+ * @param[in,out] value Likelihood value.
+ * @param[in,out] npred Number of predicted events.
+ * @param[in,out] wrk_grad Gradient working array.
+ * @param[in,out] wrk Workspace.
+ *
+ * If only a single thread per observation is requested, the kernel is
+ * called once for all events. Otherwise the events are split into
+ * m_nthreads contiguous ranges that are evaluated in parallel. Each range
+ * works on its own workspace (holding the model copy, the gradient and
+ * the working arrays), curvature matrix, likelihood value and Npred
+ * accumulators. Once all ranges are done, the accumulators
+ * are added to the result in range order, hence the result does not depend
+ * on the thread scheduling.
+ *
+ * All ranges evaluate the same observation. Each range accesses the events
+ * through its own event view (see GEvents::view()), which is allocated in
+ * the workspace for each call. As instrument responses may hold caches
+ * that are updated on evaluation, the events are only split into ranges if
+ * the response of the observation is reentrant (see
+ * GResponse::isreentrant()); otherwise the kernel is called once for all
+ * events. The model cache of the observation is shared by all ranges, as
+ * each range only accesses its own events.
+ ***************************************************************************/
+void GObservations::optimizer::eval_events(kernel                fct,
+                                           const GObservation&   obs,
+                                           const GOptimizerPars& pars,
+                                           GSparseMatrix&        covar,
+                                           GVector&              gradient,
+                                           double&               value,
+                                           double&               npred,
+                                           GVector&              wrk_grad,
+                                           workspace&            wrk)
+{
+    // Get number of events
+    int nevents = obs.events()->size();
+
+    // Determine number of event ranges. Events are only split if the
+    // response can be evaluated concurrently.
+    int nranges = 1;
+    #ifdef _OPENMP
+    if (obs.response() != NULL && obs.response()->isreentrant()) {
+        nranges = (m_nthreads < nevents) ? m_nthreads : nevents;
+    }
+    #endif
+
+    // Get model cache of observation (NULL if there is none)
+    obs_cache* cache = find_cache(obs);
+
+    // If there is a single range then evaluate the kernel directly
+    if (nranges <= 1) {
+        wrk.attach(obs.events());
+        (this->*fct)(obs, pars, cache, 0, nevents, covar, gradient, value,
+                     npred, wrk_grad, wrk);
+    }
+
+    // ... otherwise distribute the event ranges over the threads
+    else {
+
+        // Get number of parameters
+        int npars = pars.npars();
+
+        // Get workspaces of all event ranges. The workspace of the caller
+        // is not used for an event range since the caller may accumulate
+        // into its curvature matrix.
+        alloc_workspaces(nranges+1);
+        std::vector<workspace*> range_wrk;
+        for (int i = 0; (int)range_wrk.size() < nranges; ++i) {
+            if (m_wrk[i] != &wrk) {
+                range_wrk.push_back(m_wrk[i]);
+            }
+        }
+
+        // Allocate accumulators and event views of all event ranges
+        std::vector<double> range_value(nranges, 0.0);
+        std::vector<double> range_npred(nranges, 0.0);
+        for (int irange = 0; irange < nranges; ++irange) {
+            range_wrk[irange]->attach(obs.events());
+        }
+
+        // Evaluate event ranges
+        #pragma omp parallel for num_threads(nranges) schedule(static,1)
+        for (int irange = 0; irange < nranges; ++irange) {
+
+            // Determine event range
+            int ibegin = int((long long)(nevents) * irange / nranges);
+            int iend   = int((long long)(nevents) * (irange+1) / nranges);
+
+            // Prepare workspace and curvature matrix for this range
+            workspace& cpy_wrk   = *range_wrk[irange];
+            cpy_wrk.resize(npars);
+            GModels&   cpy_model = cpy_wrk.sync(pars);
+            cpy_wrk.gradient     = 0.0;
+            cpy_wrk.covar->zero();
+
+            // Evaluate kernel for event range
+            (this->*fct)(obs, cpy_model, cache, ibegin, iend, *cpy_wrk.covar,
+                         cpy_wrk.gradient, range_value[irange],
+                         range_npred[irange], cpy_wrk.wrk_grad, cpy_wrk);
+
+            // Flush the stack of the curvature matrix
+            cpy_wrk.covar->stack_flush();
+
+        } // endfor: looped over event ranges
+
+        // Add accumulators in range order
+        for (int irange = 0; irange < nranges; ++irange) {
+            covar    += *(range_wrk[irange]->covar);
+            gradient += range_wrk[irange]->gradient;
+            value    += range_value[irange];
+            npred    += range_npred[irange];
+        }
+
+    } // endelse: distributed event ranges over threads
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Add dense curvature matrix to sparse curvature matrix
+ *
+ * @param[in,out] covar Sparse curvature matrix.
+ * @param[in] dense Dense curvature matrix (lower triangle, column major).
+ * @param[in] npars Number of parameters.
+ * @param[out] inx Index working array (npars elements).
+ * @param[out] values Value working array (npars elements).
+ *
+ * Adds the curvature matrix that has been accumulated in the lower triangle
+ * of a dense npars x npars array to the sparse curvature matrix. The upper
+ * triangle is obtained by symmetry, so the resulting matrix is exactly
+ * symmetric. Only the non-zero elements of each column are added.
+ ***************************************************************************/
+void GObservations::optimizer::add_dense(GSparseMatrix& covar,
+                                         const double*  dense,
+                                         const int&     npars,
+                                         int*           inx,
+                                         double*        values) const
+{
+    // Loop over columns
+    for (int col = 0; col < npars; ++col) {
+
+        // Collect non-zero elements of column
+        int num = 0;
+        for (int row = 0; row < npars; ++row) {
+            double value = (row >= col) ? dense[col*npars+row]
+                                        : dense[row*npars+col];
+            if (value != 0.0) {
+                inx[num]    = row;
+                values[num] = value;
+                num++;
+            }
+        }
+
+        // Add column to matrix
+        if (num > 0) {
+            covar.add_col(values, inx, num, col);
+        }
+
+    } // endfor: looped over columns
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Prepare model caches for an evaluation
+ *
+ * @param[in] pars Optimizer parameters.
+ *
+ * Determines the models for which a parameter value, scale or free
+ * attribute changed since the last evaluation and sizes the model caches
+ * of all observations. All caches are invalidated if the model structure
+ * changed or if the last evaluation did not complete. This method should
+ * not be called from within a parallel region.
+ ***************************************************************************/
+void GObservations::optimizer::prepare_cache(const GOptimizerPars& pars)
+{
+    // Get models. Disable caches if caching is not requested or if the
+    // parameters are not models
+    const GModels* models = dynamic_cast<const GModels*>(&pars);
+    if (!m_use_cache || models == NULL || m_this == NULL) {
+        m_cache.clear();
+        return;
+    }
+
+    // Get dimensions
+    int npars   = models->npars();
+    int nmodels = models->size();
+
+    // Invalidate all caches if the model structure or the observations
+    // changed, or if the last evaluation did not complete
+    bool reset = (m_cache_busy                             ||
+                  (int)m_cache.size()      != m_this->size() ||
+                  (int)m_changed.size()    != nmodels        ||
+                  (int)m_par_values.size() != npars);
+    if (reset) {
+        m_cache.assign(m_this->size(), obs_cache());
+        m_changed.assign(nmodels, true);
+        m_par_values.assign(npars, 0.0);
+        m_par_scales.assign(npars, 0.0);
+        m_par_free.assign(npars, false);
+    }
+
+    // Determine the models that changed and store the actual parameters
+    int ipar = 0;
+    for (int m = 0; m < nmodels; ++m) {
+        const GModel* mptr    = (*models)[m];
+        bool          changed = reset;
+        if (mptr != NULL) {
+            for (int k = 0; k < mptr->size(); ++k, ++ipar) {
+                const GModelPar& par = (*mptr)[k];
+                if (par.value()  != m_par_values[ipar] ||
+                    par.scale()  != m_par_scales[ipar] ||
+                    par.isfree() != m_par_free[ipar]) {
+                    changed            = true;
+                    m_par_values[ipar] = par.value();
+                    m_par_scales[ipar] = par.scale();
+                    m_par_free[ipar]   = par.isfree();
+                }
+            }
+        }
+        m_changed[m] = changed;
+    }
+
+    // Size the caches of all observations
+    double total = 0.0;
+    for (int i = 0; i < m_this->size(); ++i) {
+        obs_cache& cache   = m_cache[i];
+        int        nevents = m_this->m_obs[i]->events()->size();
+        double     size    = double(nevents) * double(npars+nmodels);
+
+        // Disable caching if the caches of all observations would be too
+        // large
+        if (nevents < 1 || total + size > G_CACHE_MAX) {
+            cache = obs_cache();
+            continue;
+        }
+        total += size;
+
+        // Allocate cache if its dimensions changed
+        if (!cache.enabled || cache.nevents != nevents ||
+            (int)cache.grads.size() != nevents*npars) {
+            cache.nevents = nevents;
+            cache.enabled = true;
+            cache.filled  = false;
+            cache.values.assign(nevents*nmodels, 0.0);
+            cache.grads.assign(nevents*npars, 0.0);
+            cache.npred.assign(nmodels, 0.0);
+            cache.npred_grad.assign(npars, 0.0);
+        }
+    }
+
+    // Signal that caches are being updated
+    m_cache_busy = true;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Signal completion of an evaluation to the model caches
+ *
+ * Marks the caches of all observations as holding all events, so that they
+ * can be used for models that do not change in the next evaluation.
+ ***************************************************************************/
+void GObservations::optimizer::finish_cache(void)
+{
+    // Mark caches as filled
+    if (m_cache_busy) {
+        for (int i = 0; i < (int)m_cache.size(); ++i) {
+            if (m_cache[i].enabled) {
+                m_cache[i].filled = true;
+            }
+        }
+        m_cache_busy = false;
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return model cache of an observation
+ *
+ * @param[in] obs Observation.
+ * @return Pointer to model cache (NULL if the observation is not cached).
+ *
+ * Model caches are only returned during the evaluation of the likelihood
+ * by eval().
+ ***************************************************************************/
+GObservations::optimizer::obs_cache*
+GObservations::optimizer::find_cache(const GObservation& obs)
+{
+    // Initialise result
+    obs_cache* cache = NULL;
+
+    // Search observation
+    if (m_cache_busy) {
+        for (int i = 0; i < (int)m_cache.size(); ++i) {
+            if (m_this->m_obs[i] == &obs) {
+                if (m_cache[i].enabled) {
+                    cache = &m_cache[i];
+                }
+                break;
+            }
+        }
+    }
+
+    // Return cache
+    return cache;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate model values and gradients for a block of events
+ *
+ * @param[in] obs Observation.
+ * @param[in] pars Optimizer parameters.
+ * @param[in] cache Model cache of observation (NULL if none).
+ * @param[in] ibegin Index of first event.
+ * @param[in] iend Index after last event (at most G_EVAL_BLOCK events).
+ * @param[out] values Model values (iend-ibegin elements).
+ * @param[in,out] wrk Workspace.
+ * @return Pointer to model gradients ((iend-ibegin)*npars elements).
+ *
+ * Without cache, all models are evaluated and the gradients are returned
+ * in the workspace. With cache, only the models that changed since the
+ * last evaluation are evaluated and their contributions are stored in the
+ * cache; the model values are then summed over all cached contributions
+ * and the gradients are returned in the cache. In both cases the result
+ * is identical.
+ ***************************************************************************/
+double* GObservations::optimizer::eval_model(const GObservation&   obs,
+                                             const GOptimizerPars& pars,
+                                             obs_cache*            cache,
+                                             const int&            ibegin,
+                                             const int&            iend,
+                                             double*               values,
+                                             workspace&            wrk)
+{
+    // Get models
+    const GModels& models = (const GModels&)pars;
+
+    // Without cache evaluate all models
+    if (cache == NULL) {
+        obs.model(models, ibegin, iend, values, &wrk.mgrads[0], wrk.view);
+        return &wrk.mgrads[0];
+    }
+
+    // Get dimensions
+    int     num     = iend - ibegin;
+    int     npars   = models.npars();
+    int     nevents = cache->nevents;
+    double* grads   = &cache->grads[0] + ibegin*npars;
+
+    // Update contributions of changed models
+    int igrad = 0;
+    for (int m = 0; m < models.size(); ++m) {
+        const GModel* mptr = models[m];
+        if (mptr == NULL) {
+            continue;
+        }
+        int n = mptr->size();
+        if (!cache->filled || m_changed[m]) {
+            double* mgrad = &wrk.mgrads[0];
+            obs.model(*mptr, ibegin, iend,
+                      &cache->values[m*nevents+ibegin], mgrad, wrk.view);
+            for (int i = 0; i < num; ++i) {
+                double* grad = grads + i*npars + igrad;
+                for (int k = 0; k < n; ++k) {
+                    grad[k] = mgrad[i*n+k];
+                }
+            }
+        }
+        igrad += n;
+    }
+
+    // Sum model values in model order
+    for (int i = 0; i < num; ++i) {
+        values[i] = 0.0;
+    }
+    for (int m = 0; m < models.size(); ++m) {
+        const double* mvalues = &cache->values[m*nevents+ibegin];
+        for (int i = 0; i < num; ++i) {
+            values[i] += mvalues[i];
+        }
+    }
+
+    // Return gradients
+    return grads;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate Npred and its gradient
+ *
+ * @param[in] obs Observation.
+ * @param[in] pars Optimizer parameters.
+ * @param[in] cache Model cache of observation (NULL if none).
+ * @param[out] gradient Npred gradient.
+ * @return Npred.
+ *
+ * With cache, Npred and its gradient are only computed for models that
+ * changed since the last evaluation.
+ ***************************************************************************/
+double GObservations::optimizer::eval_npred(const GObservation&   obs,
+                                            const GOptimizerPars& pars,
+                                            obs_cache*            cache,
+                                            GVector&              gradient)
+{
+    // Get models
+    const GModels& models = (const GModels&)pars;
+
+    // Without cache evaluate all models
+    if (cache == NULL) {
+        return (obs.npred(models, &gradient));
+    }
+
+    // Initialise result
+    double npred = 0.0;
+    gradient     = 0.0;
+
+    // Loop over models
+    int igrad = 0;
+    for (int m = 0; m < models.size(); ++m) {
+        const GModel* mptr = models[m];
+        if (mptr == NULL) {
+            continue;
+        }
+        int n = mptr->size();
+
+        // Update contribution of changed model
+        if (!cache->filled || m_changed[m]) {
+            GVector mgrad(n);
+            cache->npred[m] = obs.npred(*mptr, &mgrad);
+            for (int k = 0; k < n; ++k) {
+                cache->npred_grad[igrad+k] = mgrad[k];
+            }
+        }
+
+        // Add contribution
+        npred += cache->npred[m];
+        for (int k = 0; k < n; ++k) {
+            gradient[igrad+k] = cache->npred_grad[igrad+k];
+        }
+        igrad += n;
+    }
+
+    // Return Npred
+    return npred;
+}
+
+
+/***********************************************************************//**
+ * @brief Workspace void constructor
+ ***************************************************************************/
+GObservations::optimizer::workspace::workspace(void)
+{
+    // Initialise members
+    model = NULL;
+    covar = NULL;
+    view  = NULL;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Workspace destructor
+ ***************************************************************************/
+GObservations::optimizer::workspace::~workspace(void)
+{
+    // Free model copy, curvature matrix and event view
+    if (model != NULL) delete model;
+    if (covar != NULL) delete covar;
+    if (view  != NULL) delete view;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Size workspace for a given number of parameters
+ *
+ * @param[in] npars Number of parameters.
+ *
+ * Allocates the working arrays and the curvature matrix of the workspace.
+ * Memory is only allocated if the number of parameters has changed since
+ * the last call. The curvature matrix has a filling stack, and it is only
+ * set to zero by the callers before each use.
+ ***************************************************************************/
+void GObservations::optimizer::workspace::resize(const int& npars)
+{
+    // Use at least one element so that the arrays are never empty
+    int n = (npars > 0) ? npars : 1;
+
+    // Resize working arrays if required
+    if ((int)inx.size() != n) {
+        gradient = GVector(npars);
+        wrk_grad = GVector(npars);
+        inx.assign(n, 0);
+        values.assign(n, 0.0);
+        mvalues.assign(G_EVAL_BLOCK, 0.0);
+        mgrads.assign(G_EVAL_BLOCK*n, 0.0);
+        if (n <= G_DENSE_NPARS) {
+            dense.assign(n*n, 0.0);
+        }
+        else {
+            dense.clear();
+        }
+        if (covar != NULL) delete covar;
+        covar = new GSparseMatrix(n,n);
+        covar->stack_init(n,10000);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Synchronise model copy with optimizer parameters
+ *
+ * @param[in] pars Optimizer parameters.
+ * @return Model copy.
+ *
+ * Returns a copy of the models that holds the actual parameters. The models
+ * are only copied on the first call or if the model structure has changed
+ * (see matches()). Otherwise only the parameters of the existing copy are
+ * updated, which avoids a deep copy of the models for each function
+ * evaluation.
+ ***************************************************************************/
+GModels& GObservations::optimizer::workspace::sync(const GOptimizerPars& pars)
+{
+    // Get models
+    const GModels& models = (const GModels&)pars;
+
+    // Copy models if there is no copy yet or if the model structure has
+    // changed ...
+    if (model == NULL || !matches(models)) {
+        if (model != NULL) delete model;
+        model = new GModels(models);
+    }
+
+    // ... otherwise update the parameters
+    else {
+        for (int i = 0; i < models.npars(); ++i) {
+            model->par(i) = models.par(i);
+        }
+    }
+
+    // Return model copy
+    return *model;
+}
+
+
+/***********************************************************************//**
+ * @brief Check whether model copy has the structure of models
+ *
+ * @param[in] models Models.
+ * @return True if model copy has the same structure as the models.
+ *
+ * Compares the number of models, and the name, type and parameter names of
+ * each model with those of the model copy. A model container that has the
+ * same number of parameters but, for example, a replaced spectral model is
+ * hence not mistaken for the model copy.
+ ***************************************************************************/
+bool GObservations::optimizer::workspace::matches(const GModels& models) const
+{
+    // Check number of models and parameters
+    if (model->size() != models.size() || model->npars() != models.npars()) {
+        return false;
+    }
+
+    // Check name, type and parameter names of all models
+    for (int i = 0; i < models.size(); ++i) {
+        const GModel* src = models[i];
+        const GModel* cpy = (*model)[i];
+        if (src->name() != cpy->name() ||
+            src->type() != cpy->type() ||
+            src->size() != cpy->size()) {
+            return false;
+        }
+        for (int k = 0; k < src->size(); ++k) {
+            if ((*src)[k].name() != (*cpy)[k].name()) {
+                return false;
+            }
+        }
+    }
+
+    // Return
+    return true;
+}
+
+
+/***********************************************************************//**
+ * @brief Attach workspace to events
+ *
+ * @param[in] events Events container.
+ *
+ * Allocates a new event view for the events container (see
+ * GEvents::view()). The view is owned by the workspace and is used to
+ * access the events, so that several workspaces can access the same
+ * events container concurrently.
+ ***************************************************************************/
+void GObservations::optimizer::workspace::attach(const GEvents* events)
+{
+    // Free existing event view
+    if (view != NULL) delete view;
+
+    // Allocate event view
+    view = events->view();
 
     // Return
     return;
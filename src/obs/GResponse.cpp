@@ -33,6 +33,7 @@
 #include "GResponse.hpp"
 #include "GObservation.hpp"
 #include "GIntegral.hpp"
+#include "GDerivative.hpp"
 #include "GVector.hpp"
 #include "GSkyDir.hpp"
 #include "GException.hpp"
@@ -146,6 +147,22 @@ GResponse& GResponse::operator= (const GResponse& rsp)
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Signal if response may be evaluated concurrently
+ *
+ * Returns true if the response functions may be evaluated by several
+ * threads concurrently for the same observation. This is only the case if
+ * the response and the observation hold no caches that are updated when
+ * the response is evaluated. The default implementation returns false;
+ * derived classes that fulfill this requirement overload the method.
+ ***************************************************************************/
+bool GResponse::isreentrant(void) const
+{
+    // Return
+    return false;
+}
+
+
 /***********************************************************************//**
  * @brief Return value of instrument response function
  *
@@ -190,6 +207,49 @@ double GResponse::irf(const GEvent&       event,
 }
 
 
+/***********************************************************************//**
+ * @brief Return value of instrument response function and spatial
+ *        parameter gradients
+ *
+ * @param[in] event Event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ *
+ * Returns the instrument response function for a given event, source and
+ * observation (see irf()) and sets the gradients of the instrument
+ * response function with respect to all free spatial model parameters
+ * that have the hasgrad() flag set. Other spatial parameters are not
+ * touched.
+ *
+ * This base class implementation computes the gradients numerically
+ * using irf_grad(). Derived classes should overload the method if the
+ * gradients can be computed analytically.
+ ***************************************************************************/
+double GResponse::irf_gradients(const GEvent&       event,
+                                const GSource&      source,
+                                const GObservation& obs) const
+{
+    // Compute IRF value
+    double irf = this->irf(event, source, obs);
+
+    // Get non-const spatial model pointer (circumvent const correctness)
+    GModelSpatial* model = const_cast<GModelSpatial*>(source.model());
+
+    // Set gradients of free spatial parameters
+    if (model != NULL) {
+        for (int i = 0; i < model->size(); ++i) {
+            GModelPar& par = (*model)[i];
+            if (par.isfree() && par.hasgrad()) {
+                par.gradient(irf_grad(event, source, obs, i));
+            }
+        }
+    }
+
+    // Return IRF value
+    return irf;
+}
+
+
 /***********************************************************************//**
  * @brief Return value of point source instrument response function
  *
@@ -490,6 +550,88 @@ void GResponse::free_members(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Return numerical spatial parameter gradient of instrument response
+ *        function
+ *
+ * @param[in] event Event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @param[in] ipar Spatial model parameter index.
+ *
+ * Computes the derivative of the instrument response function with respect
+ * to the spatial model parameter @p ipar using the same fixed step size
+ * of 0.0002 as GObservation::model_grad(). The step size is reduced if it
+ * would violate a parameter boundary.
+ ***************************************************************************/
+double GResponse::irf_grad(const GEvent&       event,
+                           const GSource&      source,
+                           const GObservation& obs,
+                           const int&          ipar) const
+{
+    // Get non-const parameter (circumvent const correctness)
+    GModelSpatial* model = const_cast<GModelSpatial*>(source.model());
+    GModelPar&     par   = (*model)[ipar];
+
+    // Save current model parameter
+    GModelPar current = par;
+
+    // Set step size, avoiding boundary violations
+    const double step_size = 0.0002;
+    double       x         = par.value();
+    double       dx        = step_size;
+    if (par.hasmin()) {
+        double dx_min = x - par.min();
+        if (dx_min == 0.0) {
+            dx = (x != 0.0) ? step_size * x : step_size;
+            x += dx;
+        }
+        else if (dx_min < dx) {
+            dx = dx_min;
+        }
+    }
+    if (par.hasmax()) {
+        double dx_max = par.max() - x;
+        if (dx_max == 0.0) {
+            dx = (x != 0.0) ? step_size * x : step_size;
+            x -= dx;
+        }
+        else if (dx_max < dx) {
+            dx = dx_max;
+        }
+    }
+
+    // Remove any boundaries to avoid limitations
+    par.remove_range();
+
+    // Compute derivative
+    irf_func    function(this, &event, &source, &obs, &par);
+    GDerivative derivative(&function);
+    double      grad = derivative.difference(x, dx);
+
+    // Restore current model parameter
+    par = current;
+
+    // Return gradient
+    return grad;
+}
+
+
+/***********************************************************************//**
+ * @brief Kernel for numerical spatial parameter gradient
+ *
+ * @param[in] x Parameter value.
+ ***************************************************************************/
+double GResponse::irf_func::eval(double x)
+{
+    // Set parameter value
+    m_par->value(x);
+
+    // Return IRF value
+    return (m_rsp->irf(*m_event, *m_source, *m_obs));
+}
+
+
 /***********************************************************************//**
  * @brief Kernel for offset angle Npred integration
  *
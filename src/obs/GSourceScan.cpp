@@ -0,0 +1,554 @@
+/***************************************************************************
+ *                GSourceScan.cpp  -  Source scan class                    *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2012 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GSourceScan.cpp
+ * @brief Source scan class implementation
+ * @author Juergen Knoedlseder
+ */
+
+/* __ Includes ___________________________________________________________ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <vector>
+#include "GTools.hpp"
+#include "GException.hpp"
+#include "GSourceScan.hpp"
+#include "GModelSpatialPtsrc.hpp"
+
+/* __ Method name definitions ____________________________________________ */
+#define G_SOURCE                         "GSourceScan::source(GModelSky&)"
+#define G_TSMAP                     "GSourceScan::tsmap(GSkymap&, GOptimizer&)"
+#define G_TS                          "GSourceScan::ts(GSkyDir&, GOptimizer&)"
+
+/* __ Macros _____________________________________________________________ */
+
+/* __ Coding definitions _________________________________________________ */
+
+/* __ Debug definitions __________________________________________________ */
+
+
+/*==========================================================================
+ =                                                                         =
+ =                         Constructors/destructors                        =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Void constructor
+ ***************************************************************************/
+GSourceScan::GSourceScan(void)
+{
+    // Initialise members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Observation and source constructor
+ *
+ * @param[in] obs Observation container.
+ * @param[in] source Test source template.
+ ***************************************************************************/
+GSourceScan::GSourceScan(GObservations& obs, const GModelSky& source)
+{
+    // Initialise members
+    init_members();
+
+    // Set observations and test source
+    observations(obs);
+    this->source(source);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy constructor
+ *
+ * @param[in] scan Source scan.
+ ***************************************************************************/
+GSourceScan::GSourceScan(const GSourceScan& scan)
+{
+    // Initialise members
+    init_members();
+
+    // Copy members
+    copy_members(scan);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Destructor
+ ***************************************************************************/
+GSourceScan::~GSourceScan(void)
+{
+    // Free members
+    free_members();
+
+    // Return
+    return;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                               Operators                                 =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Assignment operator
+ *
+ * @param[in] scan Source scan.
+ ***************************************************************************/
+GSourceScan& GSourceScan::operator=(const GSourceScan& scan)
+{
+    // Execute only if object is not identical
+    if (this != &scan) {
+
+        // Free members
+        free_members();
+
+        // Initialise members
+        init_members();
+
+        // Copy members
+        copy_members(scan);
+
+    } // endif: object was not identical
+
+    // Return this object
+    return *this;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Public methods                              =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Clear source scan
+ ***************************************************************************/
+void GSourceScan::clear(void)
+{
+    // Free members
+    free_members();
+
+    // Initialise members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clone source scan
+ ***************************************************************************/
+GSourceScan* GSourceScan::clone(void) const
+{
+    return new GSourceScan(*this);
+}
+
+
+/***********************************************************************//**
+ * @brief Set test source template
+ *
+ * @param[in] source Test source template.
+ *
+ * @exception GException::invalid_argument
+ *            Test source has no point source spatial component.
+ *
+ * The position of the test source is set to the scan position for each
+ * fit and is kept fixed. All other free parameters of the test source are
+ * fitted.
+ ***************************************************************************/
+void GSourceScan::source(const GModelSky& source)
+{
+    // Make sure that the test source is a point source
+    if (dynamic_cast<GModelSpatialPtsrc*>(source.spatial()) == NULL) {
+        throw GException::invalid_argument(G_SOURCE,
+              "Test source needs a point source spatial component.");
+    }
+
+    // Set test source
+    if (m_source != NULL) delete m_source;
+    m_source = source.clone();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set number of threads
+ *
+ * @param[in] nthreads Number of threads (0 = all available threads).
+ ***************************************************************************/
+void GSourceScan::nthreads(const int& nthreads)
+{
+    // Set number of threads
+    m_nthreads = (nthreads > 0) ? nthreads : 0;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute test statistic map
+ *
+ * @param[in,out] map Sky map.
+ * @param[in] opt Optimizer.
+ *
+ * @exception GException::invalid_argument
+ *            No observations or no test source have been specified.
+ *
+ * Fits the test source at the centre of each pixel of the sky map and
+ * stores the test statistic in the first map. If the sky map contains more
+ * than one map, map i+1 receives the fitted value of the i-th free
+ * parameter of the test source.
+ *
+ * The models of the observation container are first fitted without the
+ * test source, and the fitted models are used as starting point for all
+ * pixels. The pixels are then distributed dynamically over the threads,
+ * each thread using its own copy of the optimizer and of the models.
+ * Since the evaluation of the likelihood modifies internal state of the
+ * observations (event access, caches of the instrument response), all
+ * threads but the first fit on their own copy of the observations. The
+ * copies are made before the pixels are distributed. Pixels for which the
+ * fit fails are set to zero and are counted by nfailed().
+ ***************************************************************************/
+void GSourceScan::tsmap(GSkymap& map, const GOptimizer& opt)
+{
+    // Check setup
+    if (m_obs == NULL || m_source == NULL) {
+        throw GException::invalid_argument(G_TSMAP,
+              "Observations and test source need to be set.");
+    }
+
+    // Fit models without test source
+    fit_null(opt);
+
+    // Initialise number of failed fits
+    int npix    = map.npix();
+    int nmaps   = map.nmaps();
+    int nfailed = 0;
+
+    // Compute pixel directions beforehand since the sky map projection
+    // is not guaranteed to be thread safe
+    std::vector<GSkyDir> dirs(npix);
+    for (int pix = 0; pix < npix; ++pix) {
+        dirs[pix] = map.pix2dir(pix);
+    }
+
+    // Set number of threads. No more threads than pixels are used.
+    #ifdef _OPENMP
+    int nthreads = (m_nthreads > 0) ? m_nthreads : omp_get_max_threads();
+    #else
+    int nthreads = 1;
+    #endif
+    if (nthreads > npix) {
+        nthreads = (npix > 0) ? npix : 1;
+    }
+
+    // Allocate observation copies for all threads but the first
+    std::vector<GObservations*> wrk_obs(nthreads, m_obs);
+    for (int i = 1; i < nthreads; ++i) {
+        wrk_obs[i] = m_obs->clone();
+    }
+
+    // Distribute pixels over the threads
+    #pragma omp parallel num_threads(nthreads) reduction(+:nfailed)
+    {
+        // Get observations of this thread
+        #ifdef _OPENMP
+        GObservations* obs = wrk_obs[omp_get_thread_num()];
+        #else
+        GObservations* obs = wrk_obs[0];
+        #endif
+
+        // Allocate optimizer copy for this thread
+        GOptimizer* wrk_opt = opt.clone();
+
+        // Loop over pixels
+        #pragma omp for schedule(dynamic)
+        for (int pix = 0; pix < npix; ++pix) {
+
+            // Initialise result
+            for (int k = 0; k < nmaps; ++k) {
+                map(pix, k) = 0.0;
+            }
+
+            // Fit test source. Exceptions must not leave the parallel
+            // region, hence failed fits are only counted.
+            try {
+
+                // Fit test source
+                GModels models = m_null;
+                double  value  = fit_source(obs, dirs[pix], *wrk_opt,
+                                            models);
+
+                // Store test statistic
+                map(pix, 0) = 2.0 * (m_null_value - value);
+
+                // Store free parameters of test source
+                const GModel* src = models[models.size()-1];
+                for (int i = 0, k = 1; i < src->size() && k < nmaps; ++i) {
+                    if ((*src)[i].isfree()) {
+                        map(pix, k++) = (*src)[i].real_value();
+                    }
+                }
+
+            }
+            catch (std::exception& e) {
+                nfailed++;
+            }
+
+        } // endfor: looped over pixels
+
+        // Free optimizer copy
+        delete wrk_opt;
+
+    } // end pragma omp parallel
+
+    // Free observation copies
+    for (int i = 1; i < nthreads; ++i) {
+        delete wrk_obs[i];
+    }
+
+    // Store number of failed fits
+    m_nfailed = nfailed;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute test statistic for one position
+ *
+ * @param[in] dir Test source position.
+ * @param[in] opt Optimizer.
+ * @return Test statistic.
+ *
+ * @exception GException::invalid_argument
+ *            No observations or no test source have been specified.
+ ***************************************************************************/
+double GSourceScan::ts(const GSkyDir& dir, const GOptimizer& opt)
+{
+    // Check setup
+    if (m_obs == NULL || m_source == NULL) {
+        throw GException::invalid_argument(G_TS,
+              "Observations and test source need to be set.");
+    }
+
+    // Fit models without test source
+    fit_null(opt);
+
+    // Fit test source
+    GOptimizer* wrk_opt = opt.clone();
+    GModels     models  = m_null;
+    double      value;
+    try {
+        value = fit_source(m_obs, dir, *wrk_opt, models);
+    }
+    catch (...) {
+        delete wrk_opt;
+        throw;
+    }
+    delete wrk_opt;
+
+    // Return test statistic
+    return (2.0 * (m_null_value - value));
+}
+
+
+/***********************************************************************//**
+ * @brief Print source scan information
+ ***************************************************************************/
+std::string GSourceScan::print(void) const
+{
+    // Initialise result string
+    std::string result;
+
+    // Append header
+    result.append("=== GSourceScan ===\n");
+    result.append(parformat("Number of observations"));
+    result.append((m_obs != NULL) ? str(m_obs->size()) : "0");
+    result.append("\n"+parformat("Number of threads"));
+    result.append((m_nthreads > 0) ? str(m_nthreads) : "all");
+    result.append("\n"+parformat("Null hypothesis value")+str(m_null_value));
+    result.append("\n"+parformat("Number of failed fits")+str(m_nfailed));
+
+    // Append test source
+    if (m_source != NULL) {
+        result.append("\n"+m_source->print());
+    }
+
+    // Return result
+    return result;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Private methods                             =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Initialise class members
+ ***************************************************************************/
+void GSourceScan::init_members(void)
+{
+    // Initialise members
+    m_obs        = NULL;
+    m_source     = NULL;
+    m_null.clear();
+    m_null_value = 0.0;
+    m_nthreads   = 0;
+    m_nfailed    = 0;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy class members
+ *
+ * @param[in] scan Source scan.
+ ***************************************************************************/
+void GSourceScan::copy_members(const GSourceScan& scan)
+{
+    // Copy members
+    m_obs        = scan.m_obs;
+    m_null       = scan.m_null;
+    m_null_value = scan.m_null_value;
+    m_nthreads   = scan.m_nthreads;
+    m_nfailed    = scan.m_nfailed;
+
+    // Clone test source
+    m_source = (scan.m_source != NULL) ? scan.m_source->clone() : NULL;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Delete class members
+ ***************************************************************************/
+void GSourceScan::free_members(void)
+{
+    // Free test source
+    if (m_source != NULL) delete m_source;
+
+    // Signal free pointers
+    m_source = NULL;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Fit models without test source
+ *
+ * @param[in] opt Optimizer.
+ *
+ * Fits the models of the observation container without modifying them,
+ * and stores the fitted models and the function value.
+ ***************************************************************************/
+void GSourceScan::fit_null(const GOptimizer& opt)
+{
+    // Fit models
+    GOptimizer*              wrk_opt = opt.clone();
+    GObservations::optimizer fct(m_obs);
+    GModels*                 fitted  = &((*wrk_opt)(fct, m_obs->models()));
+
+    // Store result
+    m_null       = *fitted;
+    m_null_value = wrk_opt->value();
+
+    // Free memory
+    delete fitted;
+    delete wrk_opt;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Fit test source at a given position
+ *
+ * @param[in] obs Observations.
+ * @param[in] dir Test source position.
+ * @param[in] opt Optimizer.
+ * @param[in,out] models Models without test source on input, fitted models
+ *                       including test source on output.
+ * @return Function value of the fit.
+ *
+ * The test source is appended as last model. This method may be called
+ * from several threads at once, provided that each thread passes its own
+ * observations.
+ ***************************************************************************/
+double GSourceScan::fit_source(GObservations* obs, const GSkyDir& dir,
+                               GOptimizer& opt, GModels& models) const
+{
+    // Set test source position and fix the spatial parameters
+    GModelSky*          source = m_source->clone();
+    GModelSpatialPtsrc* ptsrc  = static_cast<GModelSpatialPtsrc*>(source->spatial());
+    ptsrc->dir(dir);
+    for (int i = 0; i < ptsrc->size(); ++i) {
+        (*ptsrc)[i].fix();
+    }
+
+    // Append test source
+    models.append(*source);
+    delete source;
+
+    // Fit models. The optimizer function is local to the call.
+    GObservations::optimizer fct(obs);
+    GModels*                 fitted = &(opt(fct, models));
+
+    // Store result
+    models = *fitted;
+    delete fitted;
+
+    // Return function value
+    return (opt.value());
+}
@@ -126,6 +126,23 @@ GOptimizerFunction& GOptimizerFunction::operator= (const GOptimizerFunction& fct
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Clone optimizer function
+ *
+ * @return NULL.
+ *
+ * Returns a copy of the function that can be evaluated concurrently with
+ * the function itself. This default implementation returns NULL, which
+ * signals that the function does not support concurrent evaluation.
+ * Derived classes that support it should overload this method.
+ ***************************************************************************/
+GOptimizerFunction* GOptimizerFunction::clone(void) const
+{
+    // Signal that cloning is not supported
+    return NULL;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -137,6 +154,9 @@ GOptimizerFunction& GOptimizerFunction::operator= (const GOptimizerFunction& fct
  ***************************************************************************/
 void GOptimizerFunction::init_members(void)
 {
+    // Initialise members
+    m_curvature = true;
+
     // Return
     return;
 }
@@ -149,6 +169,9 @@ void GOptimizerFunction::init_members(void)
  ***************************************************************************/
 void GOptimizerFunction::copy_members(const GOptimizerFunction& fct)
 {
+    // Copy members
+    m_curvature = fct.m_curvature;
+
     // Return
     return;
 }
@@ -0,0 +1,735 @@
+/***************************************************************************
+ *              GOptimizerLBFGS.cpp - L-BFGS optimizer class               *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2012 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GOptimizerLBFGS.cpp
+ * @brief L-BFGS optimizer class implementation
+ * @author Juergen Knoedlseder
+ */
+
+/* __ Includes ___________________________________________________________ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <cmath>
+#include "GOptimizerLBFGS.hpp"
+#include "GSparseMatrix.hpp"
+#include "GTools.hpp"
+#include "GException.hpp"
+
+/* __ Method name definitions ____________________________________________ */
+
+/* __ Macros _____________________________________________________________ */
+
+/* __ Coding definitions _________________________________________________ */
+#define G_LBFGS_ARMIJO 1.0e-4 //!< Sufficient decrease parameter of line search
+
+/* __ Debug definitions __________________________________________________ */
+//#define G_DEBUG_OPT            //!< Define to debug optimize() method
+
+
+/*==========================================================================
+ =                                                                         =
+ =                        Constructors/destructors                         =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Void constructor
+ ***************************************************************************/
+GOptimizerLBFGS::GOptimizerLBFGS(void) : GOptimizer()
+{
+    // Initialise private members for clean destruction
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Constructor with logger
+ *
+ * @param[in] log Logger to use in optimizer.
+ ***************************************************************************/
+GOptimizerLBFGS::GOptimizerLBFGS(GLog& log) : GOptimizer()
+{
+    // Initialise private members for clean destruction
+    init_members();
+
+    // Set pointer to logger
+    m_logger = &log;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy constructor
+ *
+ * @param[in] opt Optimizer from which the instance should be built.
+ ***************************************************************************/
+GOptimizerLBFGS::GOptimizerLBFGS(const GOptimizerLBFGS& opt) : GOptimizer(opt)
+{
+    // Initialise private members for clean destruction
+    init_members();
+
+    // Copy members
+    copy_members(opt);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Destructor
+ ***************************************************************************/
+GOptimizerLBFGS::~GOptimizerLBFGS(void)
+{
+    // Free members
+    free_members();
+
+    // Return
+    return;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                               Operators                                 =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Assignment operator
+ *
+ * @param[in] opt Optimizer to be assigned.
+ ***************************************************************************/
+GOptimizerLBFGS& GOptimizerLBFGS::operator= (const GOptimizerLBFGS& opt)
+{
+    // Execute only if object is not identical
+    if (this != &opt) {
+
+        // Copy base class members
+        this->GOptimizer::operator=(opt);
+
+        // Free members
+        free_members();
+
+        // Initialise private members for clean destruction
+        init_members();
+
+        // Copy members
+        copy_members(opt);
+
+    } // endif: object was not identical
+
+    // Return
+    return *this;
+}
+
+
+/***********************************************************************//**
+ * @brief Optimization operator
+ *
+ * @param[in] fct Optimization function.
+ * @param[in] p Parameters to be optimised.
+ ***************************************************************************/
+GOptimizerPars& GOptimizerLBFGS::operator()(GOptimizerFunction& fct,
+                                            GOptimizerPars&     p)
+{
+    // Initalise output parameters with input parameters
+    GOptimizerPars* pars = new GOptimizerPars(p);
+
+    // Perform L-BFGS optimization
+    optimize(&fct, pars);
+
+    // Return
+    return *pars;
+}
+
+
+/***********************************************************************//**
+ * @brief Optimization operator
+ *
+ * @param[in] fct Optimization function.
+ * @param[in] m Model parameters to be optimised.
+ ***************************************************************************/
+GModels& GOptimizerLBFGS::operator() (GOptimizerFunction& fct, GModels& m)
+{
+    // Initalise output parameters with input parameters
+    GModels* models = new GModels(m);
+
+    // Perform L-BFGS optimization
+    optimize(&fct, models);
+
+    // Return
+    return *models;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Public methods                              =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Clear object
+ *
+ * This method properly resets the object to an initial state.
+ ***************************************************************************/
+void GOptimizerLBFGS::clear(void)
+{
+    // Free class members (base and derived classes, derived class first)
+    free_members();
+    this->GOptimizer::free_members();
+
+    // Initialise members
+    this->GOptimizer::init_members();
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clone object
+***************************************************************************/
+GOptimizerLBFGS* GOptimizerLBFGS::clone(void) const
+{
+    return new GOptimizerLBFGS(*this);
+}
+
+
+/***********************************************************************//**
+ * @brief Print optimizer information
+ ***************************************************************************/
+std::string GOptimizerLBFGS::print(void) const
+{
+    // Initialise result string
+    std::string result;
+
+    // Append header
+    result.append("=== GOptimizerLBFGS ===");
+    result.append("\n"+parformat("Optimized function value")+str(m_value));
+    result.append("\n"+parformat("Absolute precision")+str(m_eps));
+
+    // Append status
+    result.append("\n"+parformat("Optimization status"));
+    switch (m_status) {
+    case G_LBFGS_CONVERGED:
+        result.append("converged");
+        break;
+    case G_LBFGS_STALLED:
+        result.append("stalled");
+        break;
+    case G_LBFGS_SINGULAR:
+        result.append("singular curvature matrix encountered");
+        break;
+    case G_LBFGS_NOT_POSTIVE_DEFINITE:
+        result.append("curvature matrix not positive definite");
+        break;
+    case G_LBFGS_BAD_ERRORS:
+        result.append("errors are inaccurate");
+        break;
+    default:
+        result.append("unknown");
+        break;
+    }
+
+    // Append further information
+    result.append("\n"+parformat("Number of parameters")+str(m_npars));
+    result.append("\n"+parformat("Number of free parameters")+str(m_nfree));
+    result.append("\n"+parformat("Number of iterations")+str(m_iter));
+    result.append("\n"+parformat("Number of stored corrections")+str(m_memory));
+
+    // Return result
+    return result;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Private methods                             =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Initialise class members
+ ***************************************************************************/
+void GOptimizerLBFGS::init_members(void)
+{
+    // Initialise optimizer parameters
+    m_npars          = 0;
+    m_nfree          = 0;
+    m_memory         = 10;
+    m_eps            = 1.0e-6;
+    m_max_iter       = 1000;
+    m_max_trials     = 30;
+    m_compute_errors = true;
+
+    // Initialise correction history
+    m_s.clear();
+    m_y.clear();
+    m_rho.clear();
+
+    // Initialise optimizer values
+    m_value  = 0.0;
+    m_status = 0;
+    m_iter   = 0;
+
+    // Initialise pointer to logger
+    m_logger = NULL;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy class members
+ *
+ * @param[in] opt GOptimizerLBFGS members to be copied.
+ ***************************************************************************/
+void GOptimizerLBFGS::copy_members(const GOptimizerLBFGS& opt)
+{
+    // Copy attributes
+    m_npars          = opt.m_npars;
+    m_nfree          = opt.m_nfree;
+    m_memory         = opt.m_memory;
+    m_eps            = opt.m_eps;
+    m_max_iter       = opt.m_max_iter;
+    m_max_trials     = opt.m_max_trials;
+    m_compute_errors = opt.m_compute_errors;
+    m_s              = opt.m_s;
+    m_y              = opt.m_y;
+    m_rho            = opt.m_rho;
+    m_value          = opt.m_value;
+    m_status         = opt.m_status;
+    m_iter           = opt.m_iter;
+    m_logger         = opt.m_logger;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Delete class members
+ ***************************************************************************/
+void GOptimizerLBFGS::free_members(void)
+{
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform L-BFGS optimization
+ *
+ * @param[in] fct Optimization function.
+ * @param[in] pars Function parameters.
+ *
+ * Minimises the function using search directions from the L-BFGS two-loop
+ * recursion and a backtracking line search. The curvature matrix of the
+ * optimizer function is switched off during the iterations and restored
+ * to its initial setting at the end. Iterations stop if the function
+ * decrease is smaller than eps(), if no free parameter can be moved, or if
+ * the line search fails to decrease the function (stalled).
+ ***************************************************************************/
+void GOptimizerLBFGS::optimize(GOptimizerFunction* fct, GOptimizerPars* pars)
+{
+    // Single loop for common exit point
+    do {
+
+        // Fall through if pointers are not valid
+        if (fct == NULL || pars == NULL)
+            continue;
+
+        // Set number of parameters. Fall through if there are no parameters
+        // to optimize
+        m_npars = pars->npars();
+        m_nfree = pars->nfree();
+        if (m_nfree < 1)
+            continue;
+
+        // Initialise optimization
+        m_status = G_LBFGS_CONVERGED;
+        m_s.clear();
+        m_y.clear();
+        m_rho.clear();
+
+        // Switch off curvature matrix computation
+        bool curvature = fct->curvature();
+        fct->curvature(false);
+
+        // Perform iterations and compute parameter uncertainties. The
+        // curvature matrix computation is also restored if an evaluation
+        // throws an exception.
+        try {
+            iterate(fct, pars);
+            if (m_compute_errors) {
+                errors(fct, pars);
+            }
+        }
+        catch (std::exception &e) {
+            fct->curvature(curvature);
+            throw;
+        }
+
+        // Restore curvature matrix computation
+        fct->curvature(curvature);
+
+    } while (0); // endwhile: main loop
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform L-BFGS iterations
+ *
+ * @param[in] fct Optimization function.
+ * @param[in] pars Function parameters.
+ *
+ * Evaluates the function at the initial parameters and iterates until
+ * convergence, until no free parameter can be moved, until the line
+ * search stalls, or until the maximum number of iterations is reached.
+ ***************************************************************************/
+void GOptimizerLBFGS::iterate(GOptimizerFunction* fct, GOptimizerPars* pars)
+{
+    // Initial evaluation
+    fct->eval(*pars);
+    m_value      = *(fct->value());
+    GVector grad = *(fct->gradient());
+
+    // Optionally write initial iteration into logger
+    if (m_logger != NULL) {
+        *m_logger << "Initial iteration: ";
+        *m_logger << "func=" << m_value << std::endl;
+    }
+
+    // Iterative fitting
+    for (m_iter = 1; m_iter <= m_max_iter; ++m_iter) {
+
+        // Determine the parameters that may be moved. Free parameters
+        // that sit at a boundary with a gradient pointing outside the
+        // valid range are excluded.
+        std::vector<bool> active(m_npars, false);
+        int               nactive = 0;
+        for (int ipar = 0; ipar < m_npars; ++ipar) {
+            const GModelPar& par = pars->par(ipar);
+            if (!par.isfree())
+                continue;
+            if (par.hasmin() && par.value() <= par.min() && grad[ipar] > 0.0)
+                continue;
+            if (par.hasmax() && par.value() >= par.max() && grad[ipar] < 0.0)
+                continue;
+            active[ipar] = true;
+            nactive++;
+        }
+
+        // Stop if no parameter can be moved
+        if (nactive < 1)
+            break;
+
+        // Compute search direction. If it is not a descent direction
+        // then reset the correction history and use steepest descent
+        GVector dir   = direction(grad, active);
+        double  slope = grad * dir;
+        if (!(slope < 0.0) && !m_s.empty()) {
+            m_s.clear();
+            m_y.clear();
+            m_rho.clear();
+            dir   = direction(grad, active);
+            slope = grad * dir;
+        }
+
+        // Stop if there is no descent direction (zero gradient)
+        if (!(slope < 0.0))
+            break;
+
+        // Save parameter values and function value
+        GVector save_pars(m_npars);
+        for (int ipar = 0; ipar < m_npars; ++ipar)
+            save_pars[ipar] = pars->par(ipar).value();
+        double value_old = m_value;
+
+        // Perform line search. Stop if the function could not be
+        // decreased
+        GVector new_grad(m_npars);
+        double  step = line_search(fct, pars, grad, dir, new_grad);
+        if (step <= 0.0) {
+            m_status = G_LBFGS_STALLED;
+            if (m_logger != NULL) {
+                *m_logger << "GOptimizerLBFGS::iterate: "
+                          << "Line search failed to decrease function."
+                          << std::endl;
+            }
+            break;
+        }
+
+        // Store correction pair if it has positive curvature, keeping
+        // only the last m_memory pairs
+        GVector s(m_npars);
+        for (int ipar = 0; ipar < m_npars; ++ipar)
+            s[ipar] = pars->par(ipar).value() - save_pars[ipar];
+        GVector y  = new_grad - grad;
+        double  sy = s * y;
+        if (sy > 0.0 && m_memory > 0) {
+            if ((int)m_s.size() >= m_memory) {
+                m_s.erase(m_s.begin());
+                m_y.erase(m_y.begin());
+                m_rho.erase(m_rho.begin());
+            }
+            m_s.push_back(s);
+            m_y.push_back(y);
+            m_rho.push_back(1.0 / sy);
+        }
+
+        // Update gradient
+        grad = new_grad;
+
+        // Compute function improvement (>0 means decrease)
+        double delta = value_old - m_value;
+
+        // Optionally write iteration results into logger
+        if (m_logger != NULL) {
+            *m_logger << "Iteration " << m_iter << ": ";
+            *m_logger << "func=" << m_value << ", ";
+            *m_logger << "step=" << step << ", ";
+            *m_logger << "delta=" << delta << std::endl;
+        }
+        #if defined(G_DEBUG_OPT)
+        std::cout << "Iteration " << m_iter << ": func="
+                  << m_value << ", step=" << step
+                  << ", delta=" << delta << std::endl;
+        #endif
+
+        // Stop if convergence was reached
+        if (delta < m_eps)
+            break;
+
+    } // endfor: iterations
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute search direction
+ *
+ * @param[in] grad Function gradient.
+ * @param[in] active Parameters that may be moved.
+ *
+ * Computes the search direction -H*grad, where H is the L-BFGS
+ * approximation of the inverse curvature matrix obtained from the stored
+ * correction pairs using the two-loop recursion. The initial matrix is a
+ * scaled unit matrix; without correction pairs the scaling is chosen so
+ * that the step has unit length. Components of parameters that may not be
+ * moved are set to zero.
+ ***************************************************************************/
+GVector GOptimizerLBFGS::direction(const GVector&           grad,
+                                   const std::vector<bool>& active) const
+{
+    // Initialise projected gradient
+    GVector q(m_npars);
+    for (int ipar = 0; ipar < m_npars; ++ipar) {
+        if (active[ipar])
+            q[ipar] = grad[ipar];
+    }
+
+    // First loop (from newest to oldest correction)
+    int                 k = m_s.size();
+    std::vector<double> alpha(k, 0.0);
+    for (int i = k-1; i >= 0; --i) {
+        alpha[i] = m_rho[i] * (m_s[i] * q);
+        q.axpy(-alpha[i], m_y[i]);
+    }
+
+    // Scale by initial inverse curvature
+    double gamma = 1.0;
+    if (k > 0) {
+        double yy = m_y[k-1] * m_y[k-1];
+        if (yy > 0.0)
+            gamma = 1.0 / (m_rho[k-1] * yy);
+    }
+    else {
+        double norm_q = norm(q);
+        if (norm_q > 0.0)
+            gamma = 1.0 / norm_q;
+    }
+    q *= gamma;
+
+    // Second loop (from oldest to newest correction)
+    for (int i = 0; i < k; ++i) {
+        double beta = m_rho[i] * (m_y[i] * q);
+        q.axpy(alpha[i] - beta, m_s[i]);
+    }
+
+    // Set search direction
+    GVector dir(m_npars);
+    for (int ipar = 0; ipar < m_npars; ++ipar) {
+        if (active[ipar])
+            dir[ipar] = -q[ipar];
+    }
+
+    // Return search direction
+    return dir;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform backtracking line search
+ *
+ * @param[in] fct Optimization function.
+ * @param[in] pars Function parameters.
+ * @param[in] grad Function gradient at actual parameters.
+ * @param[in] dir Search direction.
+ * @param[out] new_grad Function gradient at new parameters.
+ * @return Accepted step (0 if the line search failed).
+ *
+ * Starting from a unit step, the step is halved until the function value
+ * decreases sufficiently (Armijo condition). Trial parameters are clipped
+ * to their valid range. If no acceptable step is found within
+ * max_trials() trials the parameters are restored and 0 is returned.
+ ***************************************************************************/
+double GOptimizerLBFGS::line_search(GOptimizerFunction* fct,
+                                    GOptimizerPars*     pars,
+                                    const GVector&      grad,
+                                    const GVector&      dir,
+                                    GVector&            new_grad)
+{
+    // Save parameter values
+    GVector start(m_npars);
+    for (int ipar = 0; ipar < m_npars; ++ipar)
+        start[ipar] = pars->par(ipar).value();
+
+    // Loop over trial steps
+    double step = 1.0;
+    for (int trial = 0; trial < m_max_trials; ++trial, step *= 0.5) {
+
+        // Set trial parameters and compute the directional derivative of
+        // the (clipped) step
+        double slope = 0.0;
+        for (int ipar = 0; ipar < m_npars; ++ipar) {
+            if (dir[ipar] != 0.0) {
+                GModelPar& par = pars->par(ipar);
+                double     p   = start[ipar] + step * dir[ipar];
+                if (par.hasmin() && p < par.min())
+                    p = par.min();
+                if (par.hasmax() && p > par.max())
+                    p = par.max();
+                par.value(p);
+                slope += grad[ipar] * (p - start[ipar]);
+            }
+        }
+
+        // Skip evaluation if the step does not descend
+        if (!(slope < 0.0))
+            continue;
+
+        // Evaluate function at trial parameters
+        fct->eval(*pars);
+        double value = *(fct->value());
+
+        // Accept step if the function decreased sufficiently
+        if (value <= m_value + G_LBFGS_ARMIJO * slope) {
+            m_value  = value;
+            new_grad = *(fct->gradient());
+            return step;
+        }
+
+    } // endfor: looped over trial steps
+
+    // Restore parameter values
+    for (int ipar = 0; ipar < m_npars; ++ipar)
+        pars->par(ipar).value(start[ipar]);
+
+    // Signal failure
+    return 0.0;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute parameter uncertainties
+ *
+ * @param[in] fct Optimizer function.
+ * @param[in] pars Function parameters.
+ *
+ * Evaluates the function once with curvature matrix and computes the
+ * parameter uncertainties from the diagonal elements of the covariance
+ * matrix.
+ ***************************************************************************/
+void GOptimizerLBFGS::errors(GOptimizerFunction* fct, GOptimizerPars* pars)
+{
+    // Evaluate function with curvature matrix
+    fct->curvature(true);
+    fct->eval(*pars);
+    m_value = *(fct->value());
+
+    // Fetch sparse matrix pointer. We have to do this after the eval()
+    // method since eval() will allocate new memory for the covariance
+    // matrix!
+    GSparseMatrix* covar = fct->covar();
+
+    // Solve: covar * X = unit
+    try {
+        covar->cholesky_decompose(true);
+        GVector unit(m_npars);
+        for (int ipar = 0; ipar < m_npars; ++ipar) {
+            unit[ipar] = 1.0;
+            GVector x  = covar->cholesky_solver(unit, true);
+            if (x[ipar] >= 0.0) {
+                pars->par(ipar).error(std::sqrt(x[ipar]));
+            }
+            else {
+                pars->par(ipar).error(0.0);
+                m_status = G_LBFGS_BAD_ERRORS;
+            }
+            unit[ipar] = 0.0;
+        }
+    }
+    catch (GException::matrix_zero &e) {
+        m_status = G_LBFGS_SINGULAR;
+        if (m_logger != NULL) {
+            *m_logger << "GOptimizerLBFGS::errors: "
+                      << "All curvature matrix elements are zero."
+                      << std::endl;
+        }
+    }
+    catch (GException::matrix_not_pos_definite &e) {
+        m_status = G_LBFGS_NOT_POSTIVE_DEFINITE;
+        if (m_logger != NULL) {
+            *m_logger << "GOptimizerLBFGS::errors: "
+                      << "Curvature matrix not positive definite."
+                      << std::endl;
+        }
+    }
+
+    // Return
+    return;
+}
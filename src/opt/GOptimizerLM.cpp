@@ -28,15 +28,27 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <cmath>
 #include "GOptimizerLM.hpp"
 #include "GTools.hpp"
 #include "GException.hpp"
 
 /* __ Method name definitions ____________________________________________ */
+#define G_ERROR_LOWER                       "GOptimizerLM::error_lower(int&)"
+#define G_ERROR_UPPER                       "GOptimizerLM::error_upper(int&)"
+#define G_PROFILE_ERRORS  "GOptimizerLM::profile_errors(GOptimizerFunction*,"\
+                                                         " GOptimizerPars*)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_LM_DENSE_NPARS    50 //!< Maximum number of parameters for dense solver
+#define G_LM_PARALLEL_NPARS 100 //!< Minimum number of parameters for parallel errors
+#define G_LM_PROFILE_ITER   20 //!< Maximum number of profile error iterations
+#define G_LM_PROFILE_EPS    1.0e-3 //!< Precision of profile function increase
 
 /* __ Debug definitions __________________________________________________ */
 //#define G_DEBUG_OPT            //!< Define to debug optimize() method
@@ -267,6 +279,58 @@ std::string GOptimizerLM::print(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return lower profile-likelihood error
+ *
+ * @param[in] ipar Parameter index [0,...,npars-1].
+ *
+ * @exception GException::out_of_range
+ *            Parameter index is out of range.
+ *
+ * Returns the distance below the best fit value at which the function,
+ * minimised over all other parameters, has increased by 0.5. Zero is
+ * returned for parameters that were not selected using profile() or
+ * for which the profile error could not be determined.
+ ***************************************************************************/
+double GOptimizerLM::error_lower(const int& ipar) const
+{
+    // Raise exception if index is out of range
+    if (ipar < 0 || ipar >= (int)m_error_lower.size()) {
+        throw GException::out_of_range(G_ERROR_LOWER, ipar, 0,
+                                       (int)m_error_lower.size()-1);
+    }
+
+    // Return lower error
+    return m_error_lower[ipar];
+}
+
+
+/***********************************************************************//**
+ * @brief Return upper profile-likelihood error
+ *
+ * @param[in] ipar Parameter index [0,...,npars-1].
+ *
+ * @exception GException::out_of_range
+ *            Parameter index is out of range.
+ *
+ * Returns the distance above the best fit value at which the function,
+ * minimised over all other parameters, has increased by 0.5. Zero is
+ * returned for parameters that were not selected using profile() or
+ * for which the profile error could not be determined.
+ ***************************************************************************/
+double GOptimizerLM::error_upper(const int& ipar) const
+{
+    // Raise exception if index is out of range
+    if (ipar < 0 || ipar >= (int)m_error_upper.size()) {
+        throw GException::out_of_range(G_ERROR_UPPER, ipar, 0,
+                                       (int)m_error_upper.size()-1);
+    }
+
+    // Return upper error
+    return m_error_upper[ipar];
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -289,6 +353,7 @@ void GOptimizerLM::init_members(void)
     m_max_stall    = 10;
     m_max_hit      = 3; //!< Maximum successive boundary hits before freeze
     m_step_adjust  = true;
+    m_lambda_trials = 1;
     //m_diag_load    = 1.0e-100;
 
     // Initialise bookkeeping arrays
@@ -307,6 +372,19 @@ void GOptimizerLM::init_members(void)
     // Initialise pointer to logger
     m_logger = NULL;
 
+    // Initialise sparse curvature factorisation
+    m_factor      = GSparseMatrix();
+    m_covar_valid = false;
+
+    // Initialise trial functions and parameters
+    m_trial_fct.clear();
+    m_trial_pars.clear();
+
+    // Initialise profile errors
+    m_profile.clear();
+    m_error_lower.clear();
+    m_error_upper.clear();
+
     // Return
     return;
 }
@@ -327,6 +405,7 @@ void GOptimizerLM::copy_members(const GOptimizerLM& opt)
     m_max_iter     = opt.m_max_iter;
     m_max_stall    = opt.m_max_stall;
     m_step_adjust  = opt.m_step_adjust;
+    m_lambda_trials = opt.m_lambda_trials;
     //m_diag_load    = opt.m_diag_load;
     m_hit_boundary = opt.m_hit_boundary;
     m_hit_minimum  = opt.m_hit_minimum;
@@ -338,6 +417,16 @@ void GOptimizerLM::copy_members(const GOptimizerLM& opt)
     m_status       = opt.m_status;
     m_iter         = opt.m_iter;
     m_logger       = opt.m_logger;
+    m_factor       = opt.m_factor;
+    m_covar_valid  = opt.m_covar_valid;
+    m_profile      = opt.m_profile;
+    m_error_lower  = opt.m_error_lower;
+    m_error_upper  = opt.m_error_upper;
+
+    // Trial functions and parameters are not copied since they only exist
+    // during an optimization
+    m_trial_fct.clear();
+    m_trial_pars.clear();
 
     // Return
     return;
@@ -349,6 +438,9 @@ void GOptimizerLM::copy_members(const GOptimizerLM& opt)
  ***************************************************************************/
 void GOptimizerLM::free_members(void)
 {
+    // Free trial functions and parameters
+    free_trials();
+
     // Return
     return;
 }
@@ -399,31 +491,16 @@ void GOptimizerLM::optimize(GOptimizerFunction* fct, GOptimizerPars* pars)
             m_par_remove.push_back(false);
         }
 
+        // Allocate trial functions and parameters for speculative lambda
+        // trials
+        alloc_trials(fct, pars);
+
         // Initial evaluation
         fct->eval(*pars);
+        m_covar_valid = true;
 
-        // If a free parameter has a zero diagonal element in the curvature
-        // matrix then remove this parameter definitely from the fit as it
-        // otherwise will block the fit. The problem appears in the unbinned
-        // fitting where parameter gradients may be zero (due to the truncation
-        // of the PSF), but the Npred gradient is not zero. In principle we
-        // could use the Npred gradient for fitting (I guess), but I still
-        // have to figure out how ... (the diagonal loading was not so
-        // successful as it faked early convergence)
-        for (int ipar = 0; ipar < m_npars; ++ipar) {
-            if (pars->par(ipar).isfree()) {
-                if ((*fct->covar())(ipar,ipar) == 0.0) {
-                    //(*fct->covar())(ipar,ipar) = m_diag_load;
-                    if (m_logger != NULL) {
-                        *m_logger << "  Parameter \"" << pars->par(ipar).name();
-                        *m_logger << "\" has zero covariance.";
-                        *m_logger << " Fix parameter." << std::endl;
-                    }
-                    m_par_remove[ipar] = true;
-                    pars->par(ipar).fix();
-                }
-            }
-        }
+        // Remove parameters with zero curvature from the fit
+        remove_zero_curvature(fct, pars);
 
         // Save parameters
         m_value = *(fct->value());
@@ -451,7 +528,12 @@ void GOptimizerLM::optimize(GOptimizerFunction* fct, GOptimizerPars* pars)
         for (m_iter = 1; m_iter <= m_max_iter; ++m_iter) {
 
             // Perform one iteration
-            iteration(fct, pars);
+            if (m_trial_fct.empty()) {
+                iteration(fct, pars);
+            }
+            else {
+                iteration_trials(fct, pars);
+            }
 
             // Compute function improvement (>0 means decrease)
             double delta = value_old - m_value;
@@ -466,7 +548,7 @@ void GOptimizerLM::optimize(GOptimizerFunction* fct, GOptimizerPars* pars)
                         grad_max  = grad;
                         grad_imax = ipar;
                     }
-                    if (grad == 0.0) {
+                    if (grad == 0.0 && m_logger != NULL) {
                         *m_logger << "Parameter " << ipar;
                         *m_logger << " (" << pars->par(ipar).name() << ")";
                         *m_logger << " has a zero gradient." << std::endl;
@@ -566,8 +648,14 @@ void GOptimizerLM::optimize(GOptimizerFunction* fct, GOptimizerPars* pars)
 
         } // endfor: iterations
 
+        // Free trial functions and parameters
+        free_trials();
+
         // Compute parameter uncertainties
         errors(fct, pars);
+
+        // Compute profile-likelihood errors of selected parameters
+        profile_errors(fct, pars);
         
         // Free now all temporarily frozen parameters so that the resulting
         // model has the same attributes as the initial model
@@ -626,6 +714,10 @@ void GOptimizerLM::iteration(GOptimizerFunction* fct, GOptimizerPars* pars)
         for (int ipar = 0; ipar < m_npars; ++ipar)
             save_pars[ipar] = pars->par(ipar).value();
 
+        // Signal that the curvature matrix will be modified. It only
+        // corresponds again to the parameters after the next evaluation.
+        m_covar_valid = false;
+
         // Setup matrix and vector for covariance computation
         for (int ipar = 0; ipar < m_npars; ++ipar) {
             (*covar)(ipar,ipar) *= (1.0 + m_lambda);
@@ -648,10 +740,21 @@ void GOptimizerLM::iteration(GOptimizerFunction* fct, GOptimizerPars* pars)
         std::cout << std::endl;
         #endif
 
-        // Solve: covar * X = grad. Handle matrix problems
+        // Solve: covar * X = grad. For a small number of parameters a
+        // dense Cholesky decomposition is used. Otherwise the symbolic
+        // analysis of the last sparse factorisation is reused as long as
+        // the sparsity pattern does not change. Handle matrix problems
         try {
-            covar->cholesky_decompose(1);
-            *grad = covar->cholesky_solver(*grad);
+            if (m_npars <= G_LM_DENSE_NPARS) {
+                GSymMatrix dense = dense_covar(*covar);
+                dense.cholesky_decompose(true);
+                *grad = dense.cholesky_solver(*grad, true);
+            }
+            else {
+                covar->cholesky_decompose(m_factor, true);
+                m_factor.cholesky_symbolic(*covar);
+                *grad = covar->cholesky_solver(*grad);
+            }
         }
         catch (GException::matrix_zero &e) {
             m_status = G_LM_SINGULAR;
@@ -679,108 +782,14 @@ void GOptimizerLM::iteration(GOptimizerFunction* fct, GOptimizerPars* pars)
         double step = step_size(grad, pars);
 
         // Derive new parameter vector
-        for (int ipar = 0; ipar < m_npars; ++ipar) {
-
-            // Consider only free parameters
-            if (pars->par(ipar).isfree()) {
-
-                // Get actual parameter value and limits
-                double p     = pars->par(ipar).value();
-                double p_min = pars->par(ipar).min();
-                double p_max = pars->par(ipar).max();
-
-                // Compute new parameter value
-                p += (*grad)[ipar] * step;
-
-                // Debug option: dump new parameter value
-                #if defined(G_DEBUG_ITER)
-                std::cout << "Trial ";
-                std::cout << pars->par(ipar).name() << " = ";
-                std::cout << p << std::endl;
-                #endif
-
-                // Constrain parameter to within the valid range
-                if (pars->par(ipar).hasmin() && p < p_min) {
-                    if (m_hit_minimum[ipar] >= m_max_hit) {
-                        if (m_logger != NULL) {
-                            *m_logger << "  Parameter \"" << pars->par(ipar).name();
-                            *m_logger << "\" hits minimum " << p_min << " more than ";
-                            *m_logger << m_max_hit << " times.";
-                            *m_logger << " Fix parameter at minimum for now." << std::endl;
-                        }
-                        m_par_freeze[ipar] = true;
-                        pars->par(ipar).fix();
-                    }
-                    else {
-                        if (m_logger != NULL) {
-                            *m_logger << "  Parameter \"" << pars->par(ipar).name();
-                            *m_logger << "\" hits minimum: ";
-                            *m_logger << p << " < " << p_min;
-                            *m_logger << " (" << m_hit_minimum[ipar]+1 << ")" << std::endl;
-                        }
-                    }
-                    m_hit_minimum[ipar]++;
-                    p = p_min;
-                }
-                else if (pars->par(ipar).hasmax() && p > p_max) {
-                    if (m_hit_maximum[ipar] >= m_max_hit) {
-                        if (m_logger != NULL) {
-                            *m_logger << "  Parameter \"" << pars->par(ipar).name();
-                            *m_logger << "\" hits maximum " << p_max << " more than ";
-                            *m_logger << m_max_hit << " times.";
-                            *m_logger << " Fix parameter at maximum for now." << std::endl;
-                        }
-                        m_par_freeze[ipar] = true;
-                        pars->par(ipar).fix();
-                    }
-                    else {
-                        if (m_logger != NULL) {
-                            *m_logger << "  Parameter \"" << pars->par(ipar).name();
-                            *m_logger << "\" hits maximum: ";
-                            *m_logger << p << " > " << p_max;
-                            *m_logger << " (" << m_hit_maximum[ipar]+1 << ")" << std::endl;
-                        }
-                    }
-                    m_hit_maximum[ipar]++;
-                    p = p_max;
-                }
-                else {
-                    m_hit_minimum[ipar] = 0;
-                    m_hit_maximum[ipar] = 0;
-                }
-
-                // Set new parameter value
-                pars->par(ipar).value(p);
-
-            } // endif: Parameter was free
-
-        } // endfor: computed new parameter vector
+        update_pars(*grad, step, pars);
 
         // Evaluate function at new parameters
         fct->eval(*pars);
+        m_covar_valid = true;
 
-        // If a free parameter has a zero diagonal element in the curvature
-        // matrix then remove this parameter definitely from the fit as it
-        // otherwise will block the fit. The problem appears in the unbinned
-        // fitting where parameter gradients may be zero (due to the truncation
-        // of the PSF), but the Npred gradient is not zero. In principle we
-        // could use the Npred gradient for fitting (I guess), but I still
-        // have to figure out how ... (the diagonal loading was not so
-        // successful as it faked early convergence)
-        for (int ipar = 0; ipar < m_npars; ++ipar) {
-            if (pars->par(ipar).isfree()) {
-                if ((*fct->covar())(ipar,ipar) == 0.0) {
-                    //(*fct->covar())(ipar,ipar) = m_diag_load;
-                    if (m_logger != NULL) {
-                        *m_logger << "  Parameter \"" << pars->par(ipar).name();
-                        *m_logger << "\" has zero covariance.";
-                        *m_logger << " Fix parameter." << std::endl;
-                    }
-                    m_par_remove[ipar] = true;
-                    pars->par(ipar).fix();
-                }
-            }
-        }
+        // Remove parameters with zero curvature from the fit
+        remove_zero_curvature(fct, pars);
 
         // Fetch new pointers since eval will allocate new memory
         grad  = fct->gradient();
@@ -826,10 +835,11 @@ void GOptimizerLM::iteration(GOptimizerFunction* fct, GOptimizerPars* pars)
         // and increase lamdba. Restore also the best statistics value that was
         // reached so far, the gradient vector and the curve matrix.
         else {
-            m_lambda *= m_lambda_inc;
-            m_value   = save_value;
-            *grad     = save_grad;
-            *covar    = save_covar;
+            m_lambda     *= m_lambda_inc;
+            m_value       = save_value;
+            *grad         = save_grad;
+            *covar        = save_covar;
+            m_covar_valid = false;
             for (int ipar = 0; ipar < m_npars; ++ipar)
                 pars->par(ipar).value(save_pars[ipar]);
         }
@@ -842,6 +852,543 @@ void GOptimizerLM::iteration(GOptimizerFunction* fct, GOptimizerPars* pars)
 }
 
 
+/***********************************************************************//**
+ * @brief Perform one LM iteration with speculative lambda trials
+ *
+ * @param[in] fct Optimizer function.
+ * @param[in] pars Function parameters.
+ *
+ * This method performs one LM iteration trying several damping values at
+ * once. Trial k uses lambda*lambda_inc^k, i.e. the damping values that
+ * the serial iteration would try in turn after k rejected steps. The
+ * trial steps are solved and the trial parameters are evaluated
+ * concurrently. The first trial is evaluated using the optimizer function
+ * and parameters themselves, all other trials on their own function and
+ * parameter copies, without computing the curvature matrix.
+ *
+ * If the first trial is accepted, the result is identical to that of
+ * iteration(). Otherwise, the trial with the lowest function value is
+ * accepted if it improves the function, which requires one more function
+ * evaluation to obtain the curvature matrix at the new parameters. If no
+ * trial improves the function, the parameters are restored and lambda is
+ * increased beyond the largest trial value.
+ ***************************************************************************/
+void GOptimizerLM::iteration_trials(GOptimizerFunction* fct,
+                                    GOptimizerPars*     pars)
+{
+    // Single loop for common exit point
+    do {
+
+        // Fall through if pointers are not valid
+        if (fct == NULL || pars == NULL)
+            continue;
+
+        // Get number of trials
+        int ntrials = m_trial_fct.size() + 1;
+
+        // Save function value, gradient and covariance matrix
+        double         save_value = m_value;
+        GVector        save_grad  = GVector(*fct->gradient());
+        GSparseMatrix  save_covar = GSparseMatrix(*fct->covar());
+
+        // Save parameter values in vector
+        GVector save_pars(m_npars);
+        for (int ipar = 0; ipar < m_npars; ++ipar)
+            save_pars[ipar] = pars->par(ipar).value();
+
+        // Set damping values of trials
+        std::vector<double> lambda(ntrials, m_lambda);
+        for (int k = 1; k < ntrials; ++k) {
+            lambda[k] = lambda[k-1] * m_lambda_inc;
+        }
+
+        // Solve for the steps of all trials. Exceptions must not leave the
+        // parallel region, hence the status of each trial is recorded
+        // (-1 = unexpected exception).
+        std::vector<GVector> steps(ntrials);
+        std::vector<int>     status(ntrials, G_LM_CONVERGED);
+        GSparseMatrix        factor;
+        #pragma omp parallel for num_threads(ntrials) schedule(static,1)
+        for (int k = 0; k < ntrials; ++k) {
+            try {
+                steps[k] = damped_step(save_covar, save_grad, lambda[k],
+                                       (k == 0) ? &factor : NULL);
+            }
+            catch (GException::matrix_zero &e) {
+                status[k] = G_LM_SINGULAR;
+            }
+            catch (GException::matrix_not_pos_definite &e) {
+                status[k] = G_LM_NOT_POSTIVE_DEFINITE;
+            }
+            catch (std::exception &e) {
+                status[k] = -1;
+            }
+        }
+
+        // Handle matrix problems of the first trial as iteration() does.
+        // Unexpected exceptions are thrown again by repeating the solution.
+        if (status[0] == -1) {
+            damped_step(save_covar, save_grad, lambda[0], NULL);
+        }
+        else if (status[0] != G_LM_CONVERGED) {
+            m_status = status[0];
+            if (m_logger != NULL) {
+                *m_logger << "GOptimizerLM::iteration_trials: ";
+                if (m_status == G_LM_SINGULAR) {
+                    *m_logger << "All curvature matrix elements are zero.";
+                }
+                else {
+                    *m_logger << "Curvature matrix not positive definite.";
+                }
+                *m_logger << std::endl;
+            }
+            continue;
+        }
+
+        // Keep the symbolic analysis of the first trial
+        if (m_npars > G_LM_DENSE_NPARS) {
+            m_factor = factor;
+        }
+
+        // Determine step size of the first trial. This does the bookkeeping
+        // of boundary hits, which is then used by all other trials.
+        double step0 = step_size(&steps[0], pars);
+
+        // Set parameters of all trials but the first. The step sizes are
+        // determined without modifying the boundary hit bookkeeping, and
+        // parameters are only constrained to their valid range.
+        for (int k = 1; k < ntrials; ++k) {
+            if (status[k] == G_LM_CONVERGED) {
+                double          step  = trial_step_size(steps[k], *pars);
+                GOptimizerPars* trial = m_trial_pars[k-1];
+                for (int ipar = 0; ipar < m_npars; ++ipar) {
+                    trial->par(ipar) = pars->par(ipar);
+                    if (trial->par(ipar).isfree()) {
+                        double p = trial->par(ipar).value() +
+                                   steps[k][ipar] * step;
+                        if (trial->par(ipar).hasmin() &&
+                            p < trial->par(ipar).min()) {
+                            p = trial->par(ipar).min();
+                        }
+                        else if (trial->par(ipar).hasmax() &&
+                                 p > trial->par(ipar).max()) {
+                            p = trial->par(ipar).max();
+                        }
+                        trial->par(ipar).value(p);
+                    }
+                }
+            }
+        }
+
+        // Set parameters of first trial
+        update_pars(steps[0], step0, pars);
+
+        // Evaluate all trials
+        std::vector<double> values(ntrials, 0.0);
+        std::vector<int>    evaluated(ntrials, 0);
+        #pragma omp parallel for num_threads(ntrials) schedule(static,1)
+        for (int k = 0; k < ntrials; ++k) {
+            if (status[k] == G_LM_CONVERGED) {
+                try {
+                    if (k == 0) {
+                        fct->eval(*pars);
+                        values[k] = *(fct->value());
+                    }
+                    else {
+                        m_trial_fct[k-1]->eval(*m_trial_pars[k-1]);
+                        values[k] = *(m_trial_fct[k-1]->value());
+                    }
+                    evaluated[k] = 1;
+                }
+                catch (std::exception &e) {
+                    ;
+                }
+            }
+        }
+
+        // If the evaluation of the first trial failed then evaluate it
+        // again so that an exception is thrown outside the parallel region
+        if (!evaluated[0]) {
+            fct->eval(*pars);
+        }
+        m_covar_valid = true;
+
+        // Remove parameters with zero curvature from the fit
+        remove_zero_curvature(fct, pars);
+
+        // Retrieve new function value
+        m_value = *(fct->value());
+
+        // Determine how many parameters have changed
+        int par_change = 0;
+        for (int ipar = 0; ipar < m_npars; ++ipar) {
+            if (pars->par(ipar).value() != save_pars[ipar])
+                par_change++;
+        }
+
+        // If the function has decreased then accept the first trial and
+        // decrease lambda ...
+        double delta = save_value - m_value;
+        if (delta > 0.0)
+            m_lambda *= m_lambda_dec;
+
+        // ... if function is identical then accept the first trial. If the
+        // parameters have changed then increase lambda, otherwise decrease
+        // lambda
+        else if (delta == 0.0) {
+            if (par_change)
+                m_lambda *= m_lambda_inc;
+            else
+                m_lambda *= m_lambda_dec;
+        }
+
+        // ... otherwise search the best trial that improves the function
+        else {
+
+            // Search best trial
+            int    best       = -1;
+            double best_value = save_value;
+            for (int k = 1; k < ntrials; ++k) {
+                if (evaluated[k] && values[k] < best_value) {
+                    best       = k;
+                    best_value = values[k];
+                }
+            }
+
+            // If a trial improves the function then accept it, evaluate the
+            // function including curvature at the new parameters, and
+            // decrease lambda with respect to the accepted trial
+            if (best > 0) {
+                for (int ipar = 0; ipar < m_npars; ++ipar) {
+                    pars->par(ipar).value(m_trial_pars[best-1]->par(ipar).value());
+                }
+                fct->eval(*pars);
+                m_covar_valid = true;
+                remove_zero_curvature(fct, pars);
+                m_value  = *(fct->value());
+                m_lambda = lambda[best] * m_lambda_dec;
+            }
+
+            // ... otherwise use old parameters and increase lambda beyond
+            // the largest trial value. Restore also the best statistics
+            // value that was reached so far, the gradient vector and the
+            // curvature matrix.
+            else {
+                m_lambda         = lambda[ntrials-1] * m_lambda_inc;
+                m_value          = save_value;
+                *fct->gradient() = save_grad;
+                *fct->covar()    = save_covar;
+                m_covar_valid    = false;
+                for (int ipar = 0; ipar < m_npars; ++ipar)
+                    pars->par(ipar).value(save_pars[ipar]);
+            }
+
+        } // endelse: first trial was rejected
+
+    } while (0); // endwhile: main loop
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Solve for a damped LM step
+ *
+ * @param[in] covar Curvature matrix.
+ * @param[in] grad Function gradient.
+ * @param[in] lambda Damping value.
+ * @param[out] factor Symbolic analysis of sparse factorisation (optional).
+ * @return LM step direction.
+ *
+ * Solves (covar + lambda * diag(covar)) * X = -grad without modifying the
+ * curvature matrix, which allows solving for several damping values
+ * concurrently. Since the damping changes the matrix, each damping value
+ * needs its own numerical factorisation, but the symbolic analysis of the
+ * last sparse factorisation is shared. If @p factor is not NULL, the
+ * symbolic analysis of the sparse factorisation is returned in it.
+ ***************************************************************************/
+GVector GOptimizerLM::damped_step(const GSparseMatrix& covar,
+                                  const GVector&       grad,
+                                  const double&        lambda,
+                                  GSparseMatrix*       factor) const
+{
+    // Setup damped matrix and vector
+    GSparseMatrix damped(covar);
+    GVector       rhs(m_npars);
+    for (int ipar = 0; ipar < m_npars; ++ipar) {
+        damped(ipar,ipar) *= (1.0 + lambda);
+        rhs[ipar]          = -grad[ipar];
+    }
+
+    // Solve using a dense Cholesky decomposition for a small number of
+    // parameters ...
+    if (m_npars <= G_LM_DENSE_NPARS) {
+        GSymMatrix dense = dense_covar(damped);
+        dense.cholesky_decompose(true);
+        return (dense.cholesky_solver(rhs, true));
+    }
+
+    // ... otherwise use a sparse decomposition
+    damped.cholesky_decompose(m_factor, true);
+    if (factor != NULL) {
+        factor->cholesky_symbolic(damped);
+    }
+    return (damped.cholesky_solver(rhs));
+}
+
+
+/***********************************************************************//**
+ * @brief Allocate trial functions and parameters
+ *
+ * @param[in] fct Optimizer function.
+ * @param[in] pars Function parameters.
+ *
+ * Allocates lambda_trials()-1 copies of the optimizer function and of the
+ * parameters for speculative lambda trials. The function copies do not
+ * compute the curvature matrix. Nothing is allocated if only a single
+ * trial is requested, if OpenMP is not available, or if the optimizer
+ * function cannot be cloned, in which case the iterations are done
+ * serially.
+ ***************************************************************************/
+void GOptimizerLM::alloc_trials(GOptimizerFunction* fct, GOptimizerPars* pars)
+{
+    // Free existing trials
+    free_trials();
+
+    // Allocate trials
+    #ifdef _OPENMP
+    for (int k = 1; k < m_lambda_trials; ++k) {
+        GOptimizerFunction* trial = fct->clone();
+        if (trial == NULL) {
+            free_trials();
+            break;
+        }
+        trial->curvature(false);
+        m_trial_fct.push_back(trial);
+        m_trial_pars.push_back(pars->clone());
+    }
+    #endif
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Free trial functions and parameters
+ ***************************************************************************/
+void GOptimizerLM::free_trials(void)
+{
+    // Free trial functions
+    for (int k = 0; k < (int)m_trial_fct.size(); ++k) {
+        if (m_trial_fct[k] != NULL) delete m_trial_fct[k];
+    }
+    m_trial_fct.clear();
+
+    // Free trial parameters
+    for (int k = 0; k < (int)m_trial_pars.size(); ++k) {
+        if (m_trial_pars[k] != NULL) delete m_trial_pars[k];
+    }
+    m_trial_pars.clear();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Update parameters along a LM step
+ *
+ * @param[in] dir Step direction.
+ * @param[in] step Step size.
+ * @param[in,out] pars Function parameters.
+ *
+ * Moves all free parameters along the step direction and constrains them
+ * to their valid range. Parameters that hit a boundary more than
+ * m_max_hit successive times are frozen at the boundary.
+ ***************************************************************************/
+void GOptimizerLM::update_pars(const GVector& dir, const double& step,
+                               GOptimizerPars* pars)
+{
+    // Loop over all parameters
+    for (int ipar = 0; ipar < m_npars; ++ipar) {
+
+        // Consider only free parameters
+        if (pars->par(ipar).isfree()) {
+
+            // Get actual parameter value and limits
+            double p     = pars->par(ipar).value();
+            double p_min = pars->par(ipar).min();
+            double p_max = pars->par(ipar).max();
+
+            // Compute new parameter value
+            p += dir[ipar] * step;
+
+            // Debug option: dump new parameter value
+            #if defined(G_DEBUG_ITER)
+            std::cout << "Trial ";
+            std::cout << pars->par(ipar).name() << " = ";
+            std::cout << p << std::endl;
+            #endif
+
+            // Constrain parameter to within the valid range
+            if (pars->par(ipar).hasmin() && p < p_min) {
+                if (m_hit_minimum[ipar] >= m_max_hit) {
+                    if (m_logger != NULL) {
+                        *m_logger << "  Parameter \"" << pars->par(ipar).name();
+                        *m_logger << "\" hits minimum " << p_min << " more than ";
+                        *m_logger << m_max_hit << " times.";
+                        *m_logger << " Fix parameter at minimum for now." << std::endl;
+                    }
+                    m_par_freeze[ipar] = true;
+                    pars->par(ipar).fix();
+                }
+                else {
+                    if (m_logger != NULL) {
+                        *m_logger << "  Parameter \"" << pars->par(ipar).name();
+                        *m_logger << "\" hits minimum: ";
+                        *m_logger << p << " < " << p_min;
+                        *m_logger << " (" << m_hit_minimum[ipar]+1 << ")" << std::endl;
+                    }
+                }
+                m_hit_minimum[ipar]++;
+                p = p_min;
+            }
+            else if (pars->par(ipar).hasmax() && p > p_max) {
+                if (m_hit_maximum[ipar] >= m_max_hit) {
+                    if (m_logger != NULL) {
+                        *m_logger << "  Parameter \"" << pars->par(ipar).name();
+                        *m_logger << "\" hits maximum " << p_max << " more than ";
+                        *m_logger << m_max_hit << " times.";
+                        *m_logger << " Fix parameter at maximum for now." << std::endl;
+                    }
+                    m_par_freeze[ipar] = true;
+                    pars->par(ipar).fix();
+                }
+                else {
+                    if (m_logger != NULL) {
+                        *m_logger << "  Parameter \"" << pars->par(ipar).name();
+                        *m_logger << "\" hits maximum: ";
+                        *m_logger << p << " > " << p_max;
+                        *m_logger << " (" << m_hit_maximum[ipar]+1 << ")" << std::endl;
+                    }
+                }
+                m_hit_maximum[ipar]++;
+                p = p_max;
+            }
+            else {
+                m_hit_minimum[ipar] = 0;
+                m_hit_maximum[ipar] = 0;
+            }
+
+            // Set new parameter value
+            pars->par(ipar).value(p);
+
+        } // endif: Parameter was free
+
+    } // endfor: looped over parameters
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Remove parameters with zero curvature from the fit
+ *
+ * @param[in] fct Optimizer function.
+ * @param[in] pars Function parameters.
+ ***************************************************************************/
+void GOptimizerLM::remove_zero_curvature(GOptimizerFunction* fct,
+                                         GOptimizerPars*     pars)
+{
+    // If a free parameter has a zero diagonal element in the curvature
+    // matrix then remove this parameter definitely from the fit as it
+    // otherwise will block the fit. The problem appears in the unbinned
+    // fitting where parameter gradients may be zero (due to the truncation
+    // of the PSF), but the Npred gradient is not zero. In principle we
+    // could use the Npred gradient for fitting (I guess), but I still
+    // have to figure out how ... (the diagonal loading was not so
+    // successful as it faked early convergence)
+    for (int ipar = 0; ipar < m_npars; ++ipar) {
+        if (pars->par(ipar).isfree()) {
+            if ((*fct->covar())(ipar,ipar) == 0.0) {
+                //(*fct->covar())(ipar,ipar) = m_diag_load;
+                if (m_logger != NULL) {
+                    *m_logger << "  Parameter \"" << pars->par(ipar).name();
+                    *m_logger << "\" has zero covariance.";
+                    *m_logger << " Fix parameter." << std::endl;
+                }
+                m_par_remove[ipar] = true;
+                m_covar_valid      = false;
+                pars->par(ipar).fix();
+            }
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return LM step size of a lambda trial
+ *
+ * @param[in] grad Step direction of trial.
+ * @param[in] pars Function parameters.
+ *
+ * Determines the LM step size like step_size(), using the boundary hits
+ * of the last call of step_size(), but without modifying them and without
+ * logging. The method can hence be used for the trials that are computed
+ * in addition to the first trial.
+ ***************************************************************************/
+double GOptimizerLM::trial_step_size(const GVector&        grad,
+                                     const GOptimizerPars& pars) const
+{
+    // Initialise step size
+    double step = 1.0;
+
+    // Check if we should reduce the step size
+    if (m_step_adjust) {
+
+        // Loop over all parameters that do not drive the step already
+        for (int ipar = 0; ipar < pars.npars(); ++ipar) {
+
+            // Skip parameters that drive the step
+            if (m_hit_boundary[ipar]) {
+                continue;
+            }
+
+            // Get parameter attributes
+            double p     = pars.par(ipar).value();
+            double delta = grad[ipar];
+
+            // Reduce step size if a parameter minimum requires it
+            if (pars.par(ipar).hasmin() && delta < 0.0) {
+                double step_min = (pars.par(ipar).min() - p)/delta;
+                if (step_min > 0.0 && step_min < step) {
+                    step = step_min;
+                }
+            }
+
+            // Reduce step size if a parameter maximum requires it
+            if (pars.par(ipar).hasmax() && delta > 0.0) {
+                double step_max = (pars.par(ipar).max() - p)/delta;
+                if (step_max > 0.0 && step_max < step) {
+                    step = step_max;
+                }
+            }
+
+        } // endfor: looped over all parameters
+
+    } // endif: automatic step size adjustment requested
+
+    // Return step size
+    return step;
+}
+
+
 /***********************************************************************//**
  * @brief Return LM step size
  *
@@ -937,6 +1484,63 @@ double GOptimizerLM::step_size(GVector* grad, GOptimizerPars* pars)
 }
 
 
+/***********************************************************************//**
+ * @brief Convert sparse curvature matrix into dense symmetric matrix
+ *
+ * @param[in] covar Sparse curvature matrix.
+ * @return Dense symmetric curvature matrix.
+ *
+ * Builds a dense symmetric matrix from the lower triangle of the sparse
+ * curvature matrix. The upper triangle is not checked for symmetry since
+ * rounding may differ between both triangles.
+ ***************************************************************************/
+GSymMatrix GOptimizerLM::dense_covar(const GSparseMatrix& covar) const
+{
+    // Allocate dense matrix
+    GSymMatrix dense(covar.rows(), covar.cols());
+
+    // Fill lower triangle column by column
+    for (int col = 0; col < covar.cols(); ++col) {
+        GVector column = covar.extract_col(col);
+        for (int row = col; row < covar.rows(); ++row) {
+            dense(row,col) = column[row];
+        }
+    }
+
+    // Return dense matrix
+    return dense;
+}
+
+
+/***********************************************************************//**
+ * @brief Return diagonal element of inverse curvature matrix
+ *
+ * @param[in] dense Cholesky decomposed dense curvature matrix.
+ * @param[in] covar Cholesky decomposed sparse curvature matrix.
+ * @param[in] use_dense Use dense curvature matrix?
+ * @param[in] ipar Parameter index.
+ *
+ * Solves the Cholesky decomposed curvature matrix for the unit vector of
+ * parameter @p ipar and returns the element @p ipar of the solution, which
+ * is the diagonal element of the covariance matrix. The method only reads
+ * the decomposed matrices and may be called concurrently.
+ ***************************************************************************/
+double GOptimizerLM::unit_solve(GSymMatrix* dense, GSparseMatrix* covar,
+                                const bool& use_dense, const int& ipar) const
+{
+    // Set unit vector
+    GVector unit(covar->cols());
+    unit[ipar] = 1.0;
+
+    // Solve for unit vector
+    GVector x = (use_dense) ? dense->cholesky_solver(unit, true)
+                            : covar->cholesky_solver(unit, true);
+
+    // Return diagonal element
+    return x[ipar];
+}
+
+
 /***********************************************************************//**
  * @brief Compute parameter uncertainties
  *
@@ -945,6 +1549,16 @@ double GOptimizerLM::step_size(GVector* grad, GOptimizerPars* pars)
  *
  * Compute parameter uncertainties from the diagonal elements of the
  * covariance matrix.
+ *
+ * The function is only re-evaluated if the state of the optimizer function
+ * does not correspond to the actual parameters, i.e. if the last trial step
+ * was rejected or if parameters were fixed after the last evaluation.
+ * Otherwise the curvature matrix of the last evaluation is used.
+ *
+ * The diagonal elements of the covariance matrix are obtained by solving
+ * the Cholesky decomposed curvature matrix for all unit vectors. As these
+ * solutions are independent, they are computed in parallel for large
+ * numbers of parameters.
  ***************************************************************************/
 void GOptimizerLM::errors(GOptimizerFunction* fct, GOptimizerPars* pars)
 {
@@ -954,16 +1568,20 @@ void GOptimizerLM::errors(GOptimizerFunction* fct, GOptimizerPars* pars)
         // Get number of parameters
         int npars = pars->npars();
 
-        // Perform final parameter evaluation
-        fct->eval(*pars);
+        // Perform final parameter evaluation if the curvature matrix of
+        // the last evaluation does not correspond to the actual parameters
+        if (!m_covar_valid) {
+            fct->eval(*pars);
+            m_value = *(fct->value());
+        }
 
         // Fetch sparse matrix pointer. We have to do this after the eval()
         // method since eval() will allocate new memory for the covariance
         // matrix!
         GSparseMatrix* covar = fct->covar();
 
-        // Save best fitting value
-        m_value = *(fct->value());
+        // Signal that the curvature matrix will be modified
+        m_covar_valid = false;
 
         // Save covariance matrix
         GSparseMatrix save_covar = GSparseMatrix(*covar);
@@ -971,24 +1589,59 @@ void GOptimizerLM::errors(GOptimizerFunction* fct, GOptimizerPars* pars)
         // Signal no diagonal element loading
         bool diag_loaded = false;
 
+        // Use dense Cholesky decomposition for a small number of parameters
+        bool       use_dense = (npars <= G_LM_DENSE_NPARS);
+        GSymMatrix dense;
+
         // Loop over error computation (maximum 2 turns)
         for (int i = 0; i < 2; ++i) {
 
             // Solve: covar * X = unit
             try {
-                covar->cholesky_decompose(1);
-                GVector unit(npars);
+                if (use_dense) {
+                    dense = dense_covar(*covar);
+                    dense.cholesky_decompose(true);
+                }
+                else {
+                    covar->cholesky_decompose(m_factor, true);
+                }
+
+                // Compute diagonal elements of covariance matrix. The first
+                // unit vector is solved serially so that matrix exceptions
+                // are thrown from here. The remaining solutions are
+                // independent and are computed in parallel. Should any of
+                // them fail, they are recomputed serially to throw the
+                // exception
+                GVector diag(npars);
+                if (npars > 0) {
+                    diag[0] = unit_solve(&dense, covar, use_dense, 0);
+                }
+                bool failed = false;
+                #pragma omp parallel for if(npars >= G_LM_PARALLEL_NPARS) schedule(dynamic)
+                for (int ipar = 1; ipar < npars; ++ipar) {
+                    try {
+                        diag[ipar] = unit_solve(&dense, covar, use_dense, ipar);
+                    }
+                    catch (...) {
+                        #pragma omp critical(GOptimizerLM_errors)
+                        failed = true;
+                    }
+                }
+                if (failed) {
+                    for (int ipar = 1; ipar < npars; ++ipar) {
+                        diag[ipar] = unit_solve(&dense, covar, use_dense, ipar);
+                    }
+                }
+
+                // Set parameter errors
                 for (int ipar = 0; ipar < npars; ++ipar) {
-                    unit[ipar] = 1.0;
-                    GVector x  = covar->cholesky_solver(unit,1);
-                    if (x[ipar] >= 0.0) {
-                        pars->par(ipar).error(sqrt(x[ipar]));
+                    if (diag[ipar] >= 0.0) {
+                        pars->par(ipar).error(sqrt(diag[ipar]));
                     }
                     else {
                         pars->par(ipar).error(0.0);
                         m_status = G_LM_BAD_ERRORS;
                     }
-                    unit[ipar] = 0.0;
                 }
             }
             catch (GException::matrix_zero &e) {
@@ -1053,3 +1706,286 @@ void GOptimizerLM::errors(GOptimizerFunction* fct, GOptimizerPars* pars)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Compute profile-likelihood errors
+ *
+ * @param[in] fct Optimizer function.
+ * @param[in] pars Function parameters.
+ *
+ * @exception GException::out_of_range
+ *            Index of a parameter selected by profile() is out of range.
+ *
+ * Computes lower and upper profile-likelihood errors for all free
+ * parameters that have been selected using profile(). Each of these
+ * errors is determined by a sequence of fits in which the parameter is
+ * fixed and all other parameters are refitted (see profile_error()).
+ *
+ * The errors are independent and are distributed over the available
+ * threads. Each thread refits its own clone of the optimizer function and
+ * of the parameters, the first thread uses the optimizer function itself.
+ * If the optimizer function cannot be cloned, or if OpenMP is not
+ * available, the errors are computed serially. Errors for which the
+ * computation failed in parallel are recomputed serially so that the
+ * exception is thrown outside the parallel region. On return, the
+ * optimizer function is evaluated again for the best fit parameters.
+ ***************************************************************************/
+void GOptimizerLM::profile_errors(GOptimizerFunction* fct,
+                                  GOptimizerPars*     pars)
+{
+    // Continue only if pointers are valid
+    if (fct != NULL && pars != NULL) {
+
+        // Initialise profile errors
+        int npars = pars->npars();
+        m_error_lower.assign(npars, 0.0);
+        m_error_upper.assign(npars, 0.0);
+
+        // Collect selected free parameters
+        std::vector<int> ipars;
+        for (int i = 0; i < (int)m_profile.size(); ++i) {
+            int ipar = m_profile[i];
+            if (ipar < 0 || ipar >= npars) {
+                throw GException::out_of_range(G_PROFILE_ERRORS, ipar, 0,
+                                               npars-1);
+            }
+            if (pars->par(ipar).isfree()) {
+                ipars.push_back(ipar);
+            }
+        }
+
+        // Continue only if there are errors to compute. Even (odd) tasks
+        // compute the lower (upper) errors
+        int ntasks = 2 * ipars.size();
+        if (ntasks > 0) {
+
+            // Determine number of threads
+            int nthreads = 1;
+            #ifdef _OPENMP
+            nthreads = (omp_get_max_threads() < ntasks)
+                       ? omp_get_max_threads() : ntasks;
+            #endif
+
+            // Allocate function clones for all but the first thread and
+            // parameter copies for all threads
+            free_trials();
+            for (int k = 1; k < nthreads; ++k) {
+                GOptimizerFunction* clone = fct->clone();
+                if (clone == NULL) {
+                    free_trials();
+                    nthreads = 1;
+                    break;
+                }
+                m_trial_fct.push_back(clone);
+            }
+            for (int k = 0; k < nthreads; ++k) {
+                m_trial_pars.push_back(pars->clone());
+            }
+
+            // Compute errors
+            std::vector<double> errors(ntasks, 0.0);
+            std::vector<int>    evaluated(ntasks, 0);
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+            for (int k = 0; k < ntasks; ++k) {
+                int thread = 0;
+                #ifdef _OPENMP
+                thread = omp_get_thread_num();
+                #endif
+                GOptimizerFunction* f = (thread == 0) ? fct
+                                                      : m_trial_fct[thread-1];
+                double sign = (k % 2 == 0) ? -1.0 : 1.0;
+                try {
+                    errors[k]    = profile_error(f, m_trial_pars[thread],
+                                                 *pars, ipars[k/2], sign);
+                    evaluated[k] = 1;
+                }
+                catch (std::exception &e) {
+                    ;
+                }
+            }
+
+            // Recompute failed errors serially to throw the exception
+            for (int k = 0; k < ntasks; ++k) {
+                if (!evaluated[k]) {
+                    double sign = (k % 2 == 0) ? -1.0 : 1.0;
+                    errors[k] = profile_error(fct, m_trial_pars[0], *pars,
+                                              ipars[k/2], sign);
+                }
+            }
+
+            // Free function clones and parameter copies
+            free_trials();
+
+            // Restore optimizer function state for best fit parameters
+            fct->eval(*pars);
+
+            // Set profile errors. Negative errors signal that the profile
+            // iterations did not converge
+            for (int k = 0; k < ntasks; ++k) {
+                int ipar = ipars[k/2];
+                if (errors[k] < 0.0) {
+                    m_status  = G_LM_BAD_ERRORS;
+                    errors[k] = 0.0;
+                    if (m_logger != NULL) {
+                        *m_logger << "Profile error of parameter \""
+                                  << pars->par(ipar).name()
+                                  << "\" did not converge." << std::endl;
+                    }
+                }
+                if (k % 2 == 0) {
+                    m_error_lower[ipar] = errors[k];
+                }
+                else {
+                    m_error_upper[ipar] = errors[k];
+                }
+            }
+
+        } // endif: there were errors to compute
+
+    } // endif: pointers were valid
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute profile-likelihood error of one parameter
+ *
+ * @param[in] fct Optimizer function.
+ * @param[in] pars Work copy of function parameters.
+ * @param[in] best Best fit parameters.
+ * @param[in] ipar Parameter index.
+ * @param[in] sign Direction of error (-1 = lower, +1 = upper).
+ * @return Profile error (negative if the iterations did not converge).
+ *
+ * Determines the distance from the best fit value at which the profiled
+ * function increases by 0.5 with respect to the best fit function value.
+ * Starting from the curvature error, the distance is iteratively rescaled
+ * assuming that the profile is parabolic around the best fit, until the
+ * increase matches 0.5 within G_LM_PROFILE_EPS. If the parameter boundary
+ * is reached before the function increased by 0.5, the distance to the
+ * boundary is returned.
+ ***************************************************************************/
+double GOptimizerLM::profile_error(GOptimizerFunction*   fct,
+                                   GOptimizerPars*       pars,
+                                   const GOptimizerPars& best,
+                                   const int&            ipar,
+                                   const double&         sign) const
+{
+    // Get best fit parameter
+    const GModelPar& par    = best.par(ipar);
+    double           value0 = par.value();
+
+    // Start from the curvature error
+    double error = par.error();
+    if (error <= 0.0) {
+        error = (value0 != 0.0) ? 0.1 * std::abs(value0) : 1.0;
+    }
+
+    // Initialise result as not converged
+    double result = -1.0;
+
+    // Iterate
+    for (int iter = 0; iter < G_LM_PROFILE_ITER; ++iter) {
+
+        // Set parameter value, limited to the parameter boundary
+        double value = value0 + sign * error;
+        bool   limit = false;
+        if (sign < 0.0 && par.hasmin() && value <= par.min()) {
+            value = par.min();
+            limit = true;
+        }
+        else if (sign > 0.0 && par.hasmax() && value >= par.max()) {
+            value = par.max();
+            limit = true;
+        }
+        error = std::abs(value - value0);
+
+        // If the best fit value is at the boundary then the error is zero
+        if (error <= 0.0) {
+            result = 0.0;
+            break;
+        }
+
+        // Compute increase of profiled function
+        double delta = profile_value(fct, pars, best, ipar, value) - m_value;
+
+        // Stop if the increase is matched or if the boundary is reached
+        if (std::abs(delta - 0.5) < G_LM_PROFILE_EPS ||
+            (limit && delta < 0.5)) {
+            result = error;
+            break;
+        }
+
+        // Rescale error assuming a parabolic profile
+        error *= (delta > 0.0) ? std::sqrt(0.5 / delta) : 2.0;
+
+    } // endfor: iterations
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute profiled function value
+ *
+ * @param[in] fct Optimizer function.
+ * @param[in] pars Work copy of function parameters.
+ * @param[in] best Best fit parameters.
+ * @param[in] ipar Parameter index.
+ * @param[in] value Parameter value.
+ * @return Function value minimised over all other parameters.
+ *
+ * Resets the work copy of the parameters to the best fit, fixes the
+ * parameter @p ipar at @p value and minimises the function over all
+ * remaining free parameters using a LM optimizer with the settings of
+ * this optimizer.
+ ***************************************************************************/
+double GOptimizerLM::profile_value(GOptimizerFunction*   fct,
+                                   GOptimizerPars*       pars,
+                                   const GOptimizerPars& best,
+                                   const int&            ipar,
+                                   const double&         value) const
+{
+    // Reset parameters to best fit
+    for (int i = 0; i < pars->npars(); ++i) {
+        pars->par(i).value(best.par(i).value());
+        if (best.par(i).isfree()) {
+            pars->par(i).free();
+        }
+        else {
+            pars->par(i).fix();
+        }
+    }
+
+    // Fix profiled parameter
+    pars->par(ipar).value(value);
+    pars->par(ipar).fix();
+
+    // Evaluate the function if no parameter is left to be fitted ...
+    double result = 0.0;
+    if (pars->nfree() < 1) {
+        fct->eval(*pars);
+        result = *(fct->value());
+    }
+
+    // ... otherwise minimise the function over the free parameters
+    else {
+        GOptimizerLM opt;
+        opt.m_lambda_start = m_lambda_start;
+        opt.m_lambda_inc   = m_lambda_inc;
+        opt.m_lambda_dec   = m_lambda_dec;
+        opt.m_eps          = m_eps;
+        opt.m_max_iter     = m_max_iter;
+        opt.m_max_stall    = m_max_stall;
+        opt.m_max_hit      = m_max_hit;
+        opt.optimize(fct, pars);
+        result = opt.m_value;
+    }
+
+    // Return result
+    return result;
+}
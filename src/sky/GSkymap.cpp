@@ -51,6 +51,8 @@
 #define G_DIR2PIX                                 "GSkymap::dir2pix(GSkyDir)"
 #define G_XY2DIR                                 "GSkymap::xy2dir(GSkyPixel)"
 #define G_DIR2XY                                   "GSkymap::dir2xy(GSkyDir)"
+#define G_XY2DIR_VECTOR             "GSkymap::xy2dir(std::vector<GSkyPixel>)"
+#define G_DIR2XY_VECTOR               "GSkymap::dir2xy(std::vector<GSkyDir>)"
 #define G_OMEGA1                                        "GSkymap::omega(int)"
 #define G_OMEGA2                                  "GSkymap::omega(GSkyPixel)"
 #define G_SET_WCS "GSkymap::set_wcs(std::string,std::string,double,double," \
@@ -859,6 +861,88 @@ GSkyPixel GSkymap::dir2xy(const GSkyDir& dir) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of pixels
+ *
+ * @param[in] pixels Sky map pixels.
+ *
+ * @exception GException::wcs
+ *            No valid WCS found.
+ *
+ * Returns sky directions for a vector of sky map pixels. For sky maps with
+ * a 2D pixel indexation scheme all pixels are transformed by a single call
+ * to the WCS, which is considerably faster than calling xy2dir() for each
+ * pixel. For 1D schemes the pixels are transformed one by one.
+ ***************************************************************************/
+std::vector<GSkyDir> GSkymap::xy2dir(const std::vector<GSkyPixel>& pixels) const
+{
+    // Throw error if WCS is not valid
+    if (m_wcs == NULL) {
+        throw GException::wcs(G_XY2DIR_VECTOR, "No valid WCS found.");
+    }
+
+    // Initialise sky directions
+    std::vector<GSkyDir> dirs;
+
+    // Determine sky directions from pixels. Use 2D version if sky map is
+    // 2D, otherwise use 1D version.
+    if (m_num_x == 0) {
+        int num = pixels.size();
+        dirs.reserve(num);
+        for (int i = 0; i < num; ++i) {
+            dirs.push_back(m_wcs->pix2dir(xy2pix(pixels[i])));
+        }
+    }
+    else {
+        dirs = m_wcs->xy2dir(pixels);
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky map pixels for sky directions
+ *
+ * @param[in] dirs Sky directions.
+ *
+ * @exception GException::wcs
+ *            No valid WCS found.
+ *
+ * Returns sky map pixels for a vector of sky directions. For sky maps with
+ * a 2D pixel indexation scheme all sky directions are transformed by a
+ * single call to the WCS. For 1D schemes the sky directions are transformed
+ * one by one.
+ ***************************************************************************/
+std::vector<GSkyPixel> GSkymap::dir2xy(const std::vector<GSkyDir>& dirs) const
+{
+    // Throw error if WCS is not valid
+    if (m_wcs == NULL) {
+        throw GException::wcs(G_DIR2XY_VECTOR, "No valid WCS found.");
+    }
+
+    // Initialise sky pixels
+    std::vector<GSkyPixel> pixels;
+
+    // Determine sky pixels from sky directions. Use 2D version if sky map
+    // is 2D, otherwise use 1D version.
+    if (m_num_x == 0) {
+        int num = dirs.size();
+        pixels.reserve(num);
+        for (int i = 0; i < num; ++i) {
+            pixels.push_back(pix2xy(m_wcs->dir2pix(dirs[i])));
+        }
+    }
+    else {
+        pixels = m_wcs->dir2xy(dirs);
+    }
+
+    // Return sky pixels
+    return pixels;
+}
+
+
 /***********************************************************************//**
  * @brief Returns solid angle of pixel
  *
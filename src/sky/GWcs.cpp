@@ -214,6 +214,60 @@ void GWcs::coordsys(const std::string& coordsys)
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of pixels
+ *
+ * @param[in] pixels Sky pixels.
+ *
+ * Returns the sky directions for a vector of sky pixels. This default
+ * implementation simply calls the xy2dir(const GSkyPixel&) method for each
+ * pixel. Derived classes may overload the method to transform all pixels
+ * in a single pass.
+ ***************************************************************************/
+std::vector<GSkyDir> GWcs::xy2dir(const std::vector<GSkyPixel>& pixels) const
+{
+    // Allocate sky directions
+    std::vector<GSkyDir> dirs;
+    dirs.reserve(pixels.size());
+
+    // Transform pixels
+    int num = pixels.size();
+    for (int i = 0; i < num; ++i) {
+        dirs.push_back(xy2dir(pixels[i]));
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky pixels of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ *
+ * Returns the sky pixels for a vector of sky directions. This default
+ * implementation simply calls the dir2xy(const GSkyDir&) method for each
+ * sky direction. Derived classes may overload the method to transform all
+ * sky directions in a single pass.
+ ***************************************************************************/
+std::vector<GSkyPixel> GWcs::dir2xy(const std::vector<GSkyDir>& dirs) const
+{
+    // Allocate sky pixels
+    std::vector<GSkyPixel> pixels;
+    pixels.reserve(dirs.size());
+
+    // Transform sky directions
+    int num = dirs.size();
+    for (int i = 0; i < num; ++i) {
+        pixels.push_back(dir2xy(dirs[i]));
+    }
+
+    // Return sky pixels
+    return pixels;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Protected methods                            =
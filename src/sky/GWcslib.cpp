@@ -475,18 +475,43 @@ double GWcslib::omega(const int& pix) const
  ***************************************************************************/
 double GWcslib::omega(const GSkyPixel& pix) const
 {
+    // Allocate memory for transformation
+    double pixcrd[12];
+    double imgcrd[12];
+    double phi[6];
+    double theta[6];
+    double world[12];
+    int    stat[6];
+
+    // Set the 6 points. We have to add 1.0 here as the WCS pixel reference
+    // (CRPIX) starts from one while GSkyPixel starts from 0.
+    double x = pix.x() + 1.0;
+    double y = pix.y() + 1.0;
+    pixcrd[0]  = x - 0.5; pixcrd[1]  = y - 0.5;
+    pixcrd[2]  = x + 0.5; pixcrd[3]  = y - 0.5;
+    pixcrd[4]  = x + 0.5; pixcrd[5]  = y + 0.5;
+    pixcrd[6]  = x - 0.5; pixcrd[7]  = y + 0.5;
+    pixcrd[8]  = x;       pixcrd[9]  = y - 0.5;
+    pixcrd[10] = x;       pixcrd[11] = y + 0.5;
+
+    // Transform all 6 points in a single pass
+    wcs_p2s(6, 2, pixcrd, imgcrd, phi, theta, world, stat);
+
     // Get the sky directions of the 6 points
-    GSkyDir dir1 = xy2dir(GSkyPixel(pix.x()-0.5, pix.y()-0.5));
-    GSkyDir dir2 = xy2dir(GSkyPixel(pix.x()+0.5, pix.y()-0.5));
-    GSkyDir dir3 = xy2dir(GSkyPixel(pix.x()+0.5, pix.y()+0.5));
-    GSkyDir dir4 = xy2dir(GSkyPixel(pix.x()-0.5, pix.y()+0.5));
-    GSkyDir dir5 = xy2dir(GSkyPixel(pix.x(), pix.y()-0.5));
-    GSkyDir dir6 = xy2dir(GSkyPixel(pix.x(), pix.y()+0.5));
+    GSkyDir dir[6];
+    for (int i = 0; i < 6; ++i) {
+        if (m_coordsys == 0) {
+            dir[i].radec_deg(world[2*i], world[2*i+1]);
+        }
+        else {
+            dir[i].lb_deg(world[2*i], world[2*i+1]);
+        }
+    }
 
     // Compute distances between sky directions
-    double a = dir1.dist(dir2);
-    double b = dir3.dist(dir4);
-    double h = dir5.dist(dir6);
+    double a = dir[0].dist(dir[1]);
+    double b = dir[2].dist(dir[3]);
+    double h = dir[4].dist(dir[5]);
 
     // Compute solid angle
     double omega = 0.5*(h*(a+b));
@@ -642,6 +667,129 @@ GSkyPixel GWcslib::dir2xy(const GSkyDir& dir) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of pixels
+ *
+ * @param[in] pixels Sky pixels.
+ *
+ * Transforms all sky pixels into sky directions using a single call to
+ * the pixel-to-world transformation. Compared to calling xy2dir() for each
+ * pixel, this avoids the per-call setup and allows the linear, projection
+ * and spherical transformation loops to run over contiguous arrays.
+ *
+ * Note that pixel indices start from 0.
+ ***************************************************************************/
+std::vector<GSkyDir> GWcslib::xy2dir(const std::vector<GSkyPixel>& pixels) const
+{
+    // Get number of pixels
+    int num = pixels.size();
+
+    // Allocate sky directions
+    std::vector<GSkyDir> dirs(num);
+
+    // Continue only if there are pixels
+    if (num > 0) {
+
+        // Allocate memory for transformation
+        std::vector<double> pixcrd(2*num);
+        std::vector<double> imgcrd(2*num);
+        std::vector<double> phi(num);
+        std::vector<double> theta(num);
+        std::vector<double> world(2*num);
+        std::vector<int>    stat(num);
+
+        // Set sky pixels. We have to add 1.0 here as the WCS pixel
+        // reference (CRPIX) starts from one while GSkyPixel starts from 0.
+        for (int i = 0; i < num; ++i) {
+            pixcrd[2*i]   = pixels[i].x() + 1.0;
+            pixcrd[2*i+1] = pixels[i].y() + 1.0;
+        }
+
+        // Transform pixel-to-world coordinates
+        wcs_p2s(num, 2, &pixcrd[0], &imgcrd[0], &phi[0], &theta[0],
+                &world[0], &stat[0]);
+
+        // Set sky directions
+        if (m_coordsys == 0) {
+            for (int i = 0; i < num; ++i) {
+                dirs[i].radec_deg(world[2*i], world[2*i+1]);
+            }
+        }
+        else {
+            for (int i = 0; i < num; ++i) {
+                dirs[i].lb_deg(world[2*i], world[2*i+1]);
+            }
+        }
+
+    } // endif: there were pixels
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky pixels of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ *
+ * Transforms all sky directions into sky pixels using a single call to
+ * the world-to-pixel transformation.
+ *
+ * Note that GSkyPixel indices start from 0 while the WCS pixel reference
+ * starts from 1.
+ ***************************************************************************/
+std::vector<GSkyPixel> GWcslib::dir2xy(const std::vector<GSkyDir>& dirs) const
+{
+    // Get number of sky directions
+    int num = dirs.size();
+
+    // Allocate sky pixels
+    std::vector<GSkyPixel> pixels;
+    pixels.reserve(num);
+
+    // Continue only if there are sky directions
+    if (num > 0) {
+
+        // Allocate memory for transformation
+        std::vector<double> pixcrd(2*num);
+        std::vector<double> imgcrd(2*num);
+        std::vector<double> phi(num);
+        std::vector<double> theta(num);
+        std::vector<double> world(2*num);
+        std::vector<int>    stat(num);
+
+        // Set world coordinates
+        if (m_coordsys == 0) {
+            for (int i = 0; i < num; ++i) {
+                world[2*i]   = dirs[i].ra_deg();
+                world[2*i+1] = dirs[i].dec_deg();
+            }
+        }
+        else {
+            for (int i = 0; i < num; ++i) {
+                world[2*i]   = dirs[i].l_deg();
+                world[2*i+1] = dirs[i].b_deg();
+            }
+        }
+
+        // Transform world-to-pixel coordinates
+        wcs_s2p(num, 2, &world[0], &phi[0], &theta[0], &imgcrd[0],
+                &pixcrd[0], &stat[0]);
+
+        // Set sky pixels. We have to subtract 1 here as GSkyPixel starts
+        // from zero while the WCS reference (CRPIX) starts from one.
+        for (int i = 0; i < num; ++i) {
+            pixels.push_back(GSkyPixel(pixcrd[2*i]-1.0, pixcrd[2*i+1]-1.0));
+        }
+
+    } // endif: there were sky directions
+
+    // Return sky pixels
+    return pixels;
+}
+
+
 /***********************************************************************//**
  * @brief Set World Coordinate System parameters
  *
@@ -1939,6 +2087,20 @@ void GWcslib::sph_x2s(int nphi, int ntheta, int spt, int sll,
 {
     // Set tolerance
     const double tol = 1.0e-5;
+
+    // Copy Euler angles into local variables. As the output arrays are
+    // written through pointers, the compiler could otherwise not keep the
+    // angles in registers within the loops
+    const double euler0 = m_euler[0];
+    const double euler1 = m_euler[1];
+    const double euler2 = m_euler[2];
+    const double euler3 = m_euler[3];
+    const double euler4 = m_euler[4];
+
+    // Set sign of celestial longitude range. Longitudes are normalised to
+    // [0,360] for a non-negative reference longitude and to [-360,0]
+    // otherwise
+    const double lng_sign = (euler0 >= 0.0) ? 1.0 : -1.0;
     
     // Set value replication length mphi,mtheta
     int mphi;
@@ -1954,7 +2116,7 @@ void GWcslib::sph_x2s(int nphi, int ntheta, int spt, int sll,
     }
 
     // Check for a simple change in origin of longitude
-    if (m_euler[4] == 0.0) {
+    if (euler4 == 0.0) {
         
         // Initialise pointers
         double*       lngp   = lng;
@@ -1963,36 +2125,30 @@ void GWcslib::sph_x2s(int nphi, int ntheta, int spt, int sll,
         const double* thetap = theta;
             
         // Case A: ...
-        if (m_euler[1] == 0.0) {
+        if (euler1 == 0.0) {
         
             // ...
-            double dlng = fmod(m_euler[0] + 180.0 - m_euler[2], 360.0);
+            double dlng = fmod(euler0 + 180.0 - euler2, 360.0);
 
             // ...
             for (int itheta = 0; itheta < ntheta; ++itheta, phip += spt, thetap += spt) {
                 for (int iphi = 0; iphi < mphi; ++iphi, lngp += sll, latp += sll) {
 
                     // Shift longitude
-                    *lngp = *phip + dlng;
-                    *latp = *thetap;
+                    double clng = *phip + dlng;
+                    *latp       = *thetap;
 
                     // Normalize the celestial longitude
-                    if (m_euler[0] >= 0.0) {
-                        if (*lngp < 0.0) {
-                            *lngp += 360.0;
-                        }
-                    } 
-                    else {
-                        if (*lngp > 0.0) {
-                            *lngp -= 360.0;
-                        }
+                    if (lng_sign * clng < 0.0) {
+                        clng += lng_sign * 360.0;
                     }
-                    if (*lngp > 360.0) {
-                        *lngp -= 360.0;
+                    if (clng > 360.0) {
+                        clng -= 360.0;
                     }
-                    else if (*lngp < -360.0) {
-                        *lngp += 360.0;
+                    else if (clng < -360.0) {
+                        clng += 360.0;
                     }
+                    *lngp = clng;
                         
                 } // endfor: looped over phi
             } // endfor: looped over theta
@@ -2003,33 +2159,27 @@ void GWcslib::sph_x2s(int nphi, int ntheta, int spt, int sll,
         else {
             
             // ...
-            double dlng = fmod(m_euler[0] + m_euler[2], 360.0);
+            double dlng = fmod(euler0 + euler2, 360.0);
 
             // ...
             for (int itheta = 0; itheta < ntheta; ++itheta, phip += spt, thetap += spt) {
                 for (int iphi = 0; iphi < mphi; ++iphi, lngp += sll, latp += sll) {
 
                     // Shift longitude and inverte latitude
-                    *lngp = dlng - *phip;
-                    *latp = -(*thetap);
+                    double clng = dlng - *phip;
+                    *latp       = -(*thetap);
 
                     // Normalize the celestial longitude
-                    if (m_euler[0] >= 0.0) {
-                        if (*lngp < 0.0) {
-                            *lngp += 360.0;
-                        }
+                    if (lng_sign * clng < 0.0) {
+                        clng += lng_sign * 360.0;
                     }
-                    else {
-                        if (*lngp > 0.0) {
-                            *lngp -= 360.0;
-                        }
+                    if (clng > 360.0) {
+                        clng -= 360.0;
                     }
-                    if (*lngp > 360.0) {
-                        *lngp -= 360.0;
-                    }
-                    else if (*lngp < -360.0) {
-                        *lngp += 360.0;
+                    else if (clng < -360.0) {
+                        clng += 360.0;
                     }
+                    *lngp = clng;
                         
                 } // endfor: looped over phi
             } // endfor: looped over theta
@@ -2045,7 +2195,7 @@ void GWcslib::sph_x2s(int nphi, int ntheta, int spt, int sll,
         int           rowoff = 0;
         int           rowlen = nphi*sll;
         for (int iphi = 0; iphi < nphi; ++iphi, rowoff += sll, phip += spt) {
-            double  dphi = *phip - m_euler[2];
+            double  dphi = *phip - euler2;
             double* lngp = lng + rowoff;
             for (int itheta = 0; itheta < mtheta; ++itheta, lngp += rowlen) {
                 *lngp = dphi;
@@ -2064,10 +2214,10 @@ void GWcslib::sph_x2s(int nphi, int ntheta, int spt, int sll,
             sincosd(*thetap, &sinthe, &costhe);
             
             // ...
-            double costhe3 = costhe * m_euler[3];
-            double costhe4 = costhe * m_euler[4];
-            double sinthe3 = sinthe * m_euler[3];
-            double sinthe4 = sinthe * m_euler[4];
+            double costhe3 = costhe * euler3;
+            double costhe4 = costhe * euler4;
+            double sinthe3 = sinthe * euler3;
+            double sinthe4 = sinthe * euler4;
 
             // Loop over Phi
             for (int iphi = 0; iphi < mphi; ++iphi, lngp += sll, latp += sll) {
@@ -2084,7 +2234,7 @@ void GWcslib::sph_x2s(int nphi, int ntheta, int spt, int sll,
                 
                 // Rearrange longitude formula to reduce roundoff errors
                 if (std::abs(x) < tol) {
-                    x = -cosd(*thetap + m_euler[1]) + costhe3*(1.0 - cosphi);
+                    x = -cosd(*thetap + euler1) + costhe3*(1.0 - cosphi);
                 }
 
                 // Compute longitude shift
@@ -2093,34 +2243,28 @@ void GWcslib::sph_x2s(int nphi, int ntheta, int spt, int sll,
                     dlng = atan2d(y, x);
                 }
                 else {
-                    dlng = (m_euler[1] < 90.0) ? dphi + 180.0 : -dphi;
+                    dlng = (euler1 < 90.0) ? dphi + 180.0 : -dphi;
                 }
                 
                 // Set celestial longitude
-                *lngp = m_euler[0] + dlng;
+                double clng = euler0 + dlng;
 
                 // Normalize the celestial longitude
-                if (m_euler[0] >= 0.0) {
-                    if (*lngp < 0.0) {
-                        *lngp += 360.0;
-                    }
+                if (lng_sign * clng < 0.0) {
+                    clng += lng_sign * 360.0;
                 }
-                else {
-                    if (*lngp > 0.0) {
-                        *lngp -= 360.0;
-                    }
+                if (clng > 360.0) {
+                    clng -= 360.0;
                 }
-                if (*lngp > 360.0) {
-                    *lngp -= 360.0;
-                }
-                else if (*lngp < -360.0) {
-                    *lngp += 360.0;
+                else if (clng < -360.0) {
+                    clng += 360.0;
                 }
+                *lngp = clng;
 
                 // Compute the celestial latitude. First handle the case
                 // of longitude shifts by 180 deg 
                 if (fmod(dphi,180.0) == 0.0) {
-                    *latp = *thetap + cosphi*m_euler[1];
+                    *latp = *thetap + cosphi*euler1;
                     if (*latp >  90.0) *latp =  180.0 - *latp;
                     if (*latp < -90.0) *latp = -180.0 - *latp;
                 }
@@ -2175,6 +2319,15 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
     // Set tolerance
     const double tol = 1.0e-5;
 
+    // Copy Euler angles into local variables. As the output arrays are
+    // written through pointers, the compiler could otherwise not keep the
+    // angles in registers within the loops
+    const double euler0 = m_euler[0];
+    const double euler1 = m_euler[1];
+    const double euler2 = m_euler[2];
+    const double euler3 = m_euler[3];
+    const double euler4 = m_euler[4];
+
     // Set value replication length mlng,mlat
     int mlng;
     int mlat;
@@ -2189,7 +2342,7 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
     }
 
     // Check for a simple change in origin of longitude
-    if (m_euler[4] == 0.0) {
+    if (euler4 == 0.0) {
         
         // Initialise pointers
         const double* lngp   = lng;
@@ -2198,10 +2351,10 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
         double*       thetap = theta;
 
         // Case A: ...
-        if (m_euler[1] == 0.0) {
+        if (euler1 == 0.0) {
         
             // Compute longitude shift
-            double dphi = fmod(m_euler[2] - 180.0 - m_euler[0], 360.0);
+            double dphi = fmod(euler2 - 180.0 - euler0, 360.0);
 
             // Apply longitude shift
             for (int ilat = 0; ilat < nlat; ++ilat, lngp += sll, latp += sll) {
@@ -2228,7 +2381,7 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
         else {
             
             // Compute longitude shift
-            double dphi = fmod(m_euler[2] + m_euler[0], 360.0);
+            double dphi = fmod(euler2 + euler0, 360.0);
 
             // Apply longitude shift
             for (int ilat = 0; ilat < nlat; ++ilat, lngp += sll, latp += sll) {
@@ -2261,7 +2414,7 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
         int           rowoff = 0;
         int           rowlen = nlng * spt;
         for (int ilng = 0; ilng < nlng; ++ilng, rowoff += spt, lngp += sll) {
-            double  dlng   = *lngp - m_euler[0];
+            double  dlng   = *lngp - euler0;
             double* phip   = phi + rowoff;
             double* thetap = theta;
             for (int ilat = 0; ilat < mlat; ++ilat, phip += rowlen) {
@@ -2279,10 +2432,10 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
             double sinlat;
             double coslat;
             sincosd(*latp, &sinlat, &coslat);
-            double coslat3 = coslat*m_euler[3];
-            double coslat4 = coslat*m_euler[4];
-            double sinlat3 = sinlat*m_euler[3];
-            double sinlat4 = sinlat*m_euler[4];
+            double coslat3 = coslat*euler3;
+            double coslat4 = coslat*euler4;
+            double sinlat3 = sinlat*euler3;
+            double sinlat4 = sinlat*euler4;
 
             // Loop over longitudes
             for (int ilng = 0; ilng < mlng; ++ilng, phip += spt, thetap += spt) {
@@ -2299,7 +2452,7 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
                 
                 // Rearrange formula to reduce roundoff errors
                 if (std::abs(x) < tol) {
-                    x = -cosd(*latp+m_euler[1]) + coslat3*(1.0 - coslng);
+                    x = -cosd(*latp+euler1) + coslat3*(1.0 - coslng);
                 }
 
                 // Compute Phi shift
@@ -2308,7 +2461,7 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
                     dphi = atan2d(y, x);
                 } 
                 else { // Change of origin of longitude
-                    if (m_euler[1] < 90.0) {
+                    if (euler1 < 90.0) {
                         dphi =  dlng - 180.0;
                     }
                     else {
@@ -2317,7 +2470,7 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
                 }
                 
                 // Set Phi
-                *phip = fmod(m_euler[2] + dphi, 360.0);
+                *phip = fmod(euler2 + dphi, 360.0);
 
                 // Normalize the native longitude
                 if (*phip > 180.0) {
@@ -2330,7 +2483,7 @@ void GWcslib::sph_s2x(int nlng, int nlat, int sll, int spt,
                 // Compute the native latitude. First handle the case
                 // of longitude shifts by 180 deg
                 if (fmod(dlng, 180.0) == 0.0) {
-                    *thetap = *latp + coslng*m_euler[1];
+                    *thetap = *latp + coslng*euler1;
                     if (*thetap >  90.0) *thetap =  180.0 - *thetap;
                     if (*thetap < -90.0) *thetap = -180.0 - *thetap;
                 }
@@ -236,9 +236,6 @@ const double& GNodeArray::operator[](const int& index) const
     }
     #endif
 
-    // Signal that setup needs to be called
-    m_need_setup = false;
-
     // Return node
     return m_node[index];
 }
@@ -406,12 +403,15 @@ double GNodeArray::interpolate(const double& value,
                                           vector.size());
     }
     
-    // Set interpolation value (circumvent const correctness)
-    set_value(value);
+    // Get indices and weighting factors for interpolation
+    int    inx_left;
+    int    inx_right;
+    double wgt_left;
+    double wgt_right;
+    set_value(value, inx_left, inx_right, wgt_left, wgt_right);
 
     // Interpolate
-    double y = vector[inx_left()]  * wgt_left() +
-               vector[inx_right()] * wgt_right();
+    double y = vector[inx_left] * wgt_left + vector[inx_right] * wgt_right;
 
     // Return
     return y;
@@ -427,12 +427,57 @@ double GNodeArray::interpolate(const double& value,
  *            At least two nodes are required for setting up the factors
  *
  * Set the indices that bound the specified value and the corresponding
- * weighting factors for linear interpolation. If the array has a linear
- * form (i.e. the nodes are equidistant), an analytic formula is used to
- * determine the boundary indices. If the nodes are not equidistant the
- * boundary indices are searched by bisection.
+ * weighting factors for linear interpolation. The indices and weighting
+ * factors are stored in the node array and can be recovered using
+ * inx_left(), inx_right(), wgt_left() and wgt_right().
+ *
+ * As the method modifies the node array it should not be called by several
+ * threads on the same node array. Use the set_value() method that returns
+ * indices and weighting factors to the caller instead.
  ***************************************************************************/
 void GNodeArray::set_value(const double& value) const
+{
+    // Update cache if required
+    if (m_need_setup) {
+        setup();
+    }
+
+    // Set indices and weighting factors
+    set_value(value, m_inx_left, m_inx_right, m_wgt_left, m_wgt_right);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return indices and weighting factors for interpolation
+ *
+ * @param[in] value Value for which the interpolation should be done.
+ * @param[out] inx_left Index of left node.
+ * @param[out] inx_right Index of right node.
+ * @param[out] wgt_left Weight for left node.
+ * @param[out] wgt_right Weight for right node.
+ *
+ * @exception GException::not_enough_nodes
+ *            At least two nodes are required for setting up the factors
+ *
+ * Determines the indices that bound the specified value and the
+ * corresponding weighting factors for linear interpolation. If the array
+ * has a linear form (i.e. the nodes are equidistant), an analytic formula
+ * is used to determine the boundary indices. If the nodes are not
+ * equidistant the boundary indices are searched by bisection.
+ *
+ * The method does not modify the node array, hence it may be called
+ * concurrently by several threads on the same node array. The node
+ * distances that are used by the method are set up by all methods that
+ * set the nodes.
+ ***************************************************************************/
+void GNodeArray::set_value(const double& value,
+                           int&          inx_left,
+                           int&          inx_right,
+                           double&       wgt_left,
+                           double&       wgt_right) const
 {
     // Get number of nodes
     int nodes = m_node.size();
@@ -442,20 +487,15 @@ void GNodeArray::set_value(const double& value) const
         throw GException::not_enough_nodes(G_SET_VALUE, nodes);
     }
 
-    // Update cache if required
-    if (m_need_setup) {
-        setup();
-    }
-    
     // If array is linear then get left index from analytic formula
     if (m_is_linear) {
 
         // Set left index
-        m_inx_left = int(m_linear_slope * value + m_linear_offset);
+        inx_left = int(m_linear_slope * value + m_linear_offset);
         
         // Keep index in valid range
-        if (m_inx_left < 0)             m_inx_left = 0;
-        else if (m_inx_left >= nodes-1) m_inx_left = nodes - 2;
+        if (inx_left < 0)             inx_left = 0;
+        else if (inx_left >= nodes-1) inx_left = nodes - 2;
 
     } // endif: array is linear
 
@@ -464,12 +504,12 @@ void GNodeArray::set_value(const double& value) const
     
         // Set left index if value is before first node
         if (value < m_node[0]) {
-            m_inx_left = 0;
+            inx_left = 0;
         }
 
         // Set left index if value is after last node
         else if (value >  m_node[nodes-1]) {
-            m_inx_left = nodes - 2;
+            inx_left = nodes - 2;
         }
 
         // Set left index by bisection
@@ -485,16 +525,16 @@ void GNodeArray::set_value(const double& value) const
                     low = mid;
                 }
             }
-            m_inx_left = low;
+            inx_left = low;
         } // endelse: did bisection
     }
 
     // Set right index
-    m_inx_right = m_inx_left + 1;
+    inx_right = inx_left + 1;
 
     // Set weighting factors
-    m_wgt_right = (value - m_node[m_inx_left]) / m_step[m_inx_left];
-    m_wgt_left  = 1.0 - m_wgt_right;
+    wgt_right = (value - m_node[inx_left]) / m_step[inx_left];
+    wgt_left  = 1.0 - wgt_right;
 
     // Return
     return;
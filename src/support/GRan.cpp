@@ -197,6 +197,33 @@ void GRan::seed(unsigned long long int seed)
 }
 
 
+/***********************************************************************//**
+ * @brief Return independent random number stream
+ *
+ * @param[in] index Stream index.
+ * @return Random number generator for the stream.
+ *
+ * Returns a random number generator whose seed is derived from the seed of
+ * this generator and from the stream index using the SplitMix64 mixing
+ * function, so that streams with neighbouring indices are uncorrelated.
+ * The stream only depends on the seed and the index, and not on the
+ * state of this generator. Work that is split into chunks may hence use
+ * stream(i) for chunk i to produce results that do not depend on how the
+ * chunks are distributed over threads.
+ ***************************************************************************/
+GRan GRan::stream(const unsigned long long int& index) const
+{
+    // Derive seed of stream
+    unsigned long long int z = m_seed + (index + 1) * 11400714819323198485ULL;
+    z = (z ^ (z >> 30)) * 13787848793156543929ULL;
+    z = (z ^ (z >> 27)) * 10723151780598845931ULL;
+    z = z ^ (z >> 31);
+
+    // Return stream
+    return (GRan(z));
+}
+
+
 /***********************************************************************//**
  * @brief Return 32-bit random unsigned integer
  *
@@ -361,6 +388,175 @@ double GRan::chisq2(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Fill array with uniform deviates in range 0 to 1
+ *
+ * @param[out] values Array of random values.
+ * @param[in] number Number of random values.
+ *
+ * Fills an array with uniform random values. Value i is drawn from stream
+ * i modulo G_RAN_LANES (see split()). The streams are kept in local arrays
+ * and updated in lock step, which allows the compiler to vectorise the
+ * generator.
+ ***************************************************************************/
+void GRan::uniform(double* values, const int& number)
+{
+    // Continue only if there are values to draw
+    if (number > 0) {
+
+        // Split generator into streams
+        GRan lanes[G_RAN_LANES];
+        split(lanes);
+
+        // Copy stream states into local arrays
+        unsigned long long int u[G_RAN_LANES];
+        unsigned long long int v[G_RAN_LANES];
+        unsigned long long int w[G_RAN_LANES];
+        for (int k = 0; k < G_RAN_LANES; ++k) {
+            u[k] = lanes[k].m_u;
+            v[k] = lanes[k].m_v;
+            w[k] = lanes[k].m_w;
+        }
+
+        // Draw values for all streams at once (same algorithm as int64())
+        int nfull = number - number % G_RAN_LANES;
+        for (int i = 0; i < nfull; i += G_RAN_LANES) {
+            for (int k = 0; k < G_RAN_LANES; ++k) {
+                u[k]  = u[k] * 2862933555777941757LL + 7046029254386353087LL;
+                v[k] ^= v[k] >> 17;
+                v[k] ^= v[k] << 31;
+                v[k] ^= v[k] >> 8;
+                w[k]  = 4294957665U * (w[k] & 0xffffffff) + (w[k] >> 32);
+                unsigned long long int x = u[k] ^ (u[k] << 21);
+                x ^= x >> 35;
+                x ^= x << 4;
+                values[i+k] = 5.42101086242752217e-20 * ((x + v[k]) ^ w[k]);
+            }
+        }
+
+        // Draw remaining values from the streams
+        for (int k = 0; nfull + k < number; ++k) {
+            lanes[k].m_u = u[k];
+            lanes[k].m_v = v[k];
+            lanes[k].m_w = w[k];
+            values[nfull+k] = lanes[k].uniform();
+        }
+
+    } // endif: there were values to draw
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Fill array with exponential deviates
+ *
+ * @param[in] lambda Mean rate.
+ * @param[out] values Array of random values.
+ * @param[in] number Number of random values.
+ *
+ * Fills an array with exponential deviates from the probability
+ * distribution
+ * \f[p(x) = \lambda \exp( -\lambda x )\f]
+ * (see exp(const double&)).
+ ***************************************************************************/
+void GRan::exp(const double& lambda, double* values, const int& number)
+{
+    // Get uniform deviates
+    uniform(values, number);
+
+    // Transform uniform deviates, replacing the rare zero deviates
+    for (int i = 0; i < number; ++i) {
+        double x = values[i];
+        while (x == 0.0) {
+            x = uniform();
+        }
+        values[i] = -std::log(x) / lambda;
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Fill array with normal deviates
+ *
+ * @param[out] values Array of random values.
+ * @param[in] number Number of random values.
+ *
+ * Fills an array with deviates from the normal distribution with zero mean
+ * and unit variance, using the Box-Muller transform of pairs of uniform
+ * deviates.
+ ***************************************************************************/
+void GRan::normal(double* values, const int& number)
+{
+    // Get uniform deviates
+    uniform(values, number);
+
+    // Transform pairs of uniform deviates. The radius uses 1-x, which
+    // vanishes only for the rare deviates x=1 that are replaced.
+    int npairs = number / 2;
+    for (int i = 0; i < 2*npairs; i += 2) {
+        double x = values[i];
+        while (x == 1.0) {
+            x = uniform();
+        }
+        double r     = std::sqrt(-2.0 * std::log(1.0 - x));
+        double phi   = twopi * values[i+1];
+        values[i]   = r * std::cos(phi);
+        values[i+1] = r * std::sin(phi);
+    }
+
+    // Transform last deviate if the number of values is odd
+    if (number > 2*npairs) {
+        double x = values[number-1];
+        while (x == 1.0) {
+            x = uniform();
+        }
+        double r = std::sqrt(-2.0 * std::log(1.0 - x));
+        values[number-1] = r * std::cos(twopi * uniform());
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Fill array with Poisson deviates
+ *
+ * @param[in] lambda Array of expectation values.
+ * @param[out] values Array of random values.
+ * @param[in] number Number of random values.
+ *
+ * Fills an array with Poisson deviates for an array of expectation values
+ * (see poisson(const double&)). Value i is drawn from stream i modulo
+ * G_RAN_LANES (see split()). Since the number of uniform deviates that are
+ * needed for a Poisson deviate varies, the deviates are drawn one by one.
+ ***************************************************************************/
+void GRan::poisson(const double* lambda, double* values, const int& number)
+{
+    // Continue only if there are values to draw
+    if (number > 0) {
+
+        // Split generator into streams
+        GRan lanes[G_RAN_LANES];
+        split(lanes);
+
+        // Draw values
+        for (int i = 0; i < number; ++i) {
+            values[i] = lanes[i % G_RAN_LANES].poisson(lambda[i]);
+        }
+
+    } // endif: there were values to draw
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print class information
  ***************************************************************************/
@@ -444,3 +640,27 @@ void GRan::free_members(void)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Split generator into streams for filling arrays
+ *
+ * @param[out] lanes Array of G_RAN_LANES random number generators.
+ *
+ * Draws one value from the generator and uses it as the seed of a
+ * generator from which the G_RAN_LANES streams are derived using
+ * stream(). Successive calls hence produce different streams.
+ ***************************************************************************/
+void GRan::split(GRan* lanes)
+{
+    // Derive generator for streams
+    GRan base(int64());
+
+    // Set streams
+    for (int k = 0; k < G_RAN_LANES; ++k) {
+        lanes[k] = base.stream(k);
+    }
+
+    // Return
+    return;
+}
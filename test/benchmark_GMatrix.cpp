@@ -0,0 +1,173 @@
+/***************************************************************************
+ *          benchmark_GMatrix.cpp  -  Benchmark matrix operations          *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2012 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file benchmark_GMatrix.cpp
+ * @brief Benchmark of matrix multiplication and Cholesky decomposition
+ * @author Juergen Knoedlseder
+ *
+ * Compares the blocked matrix multiplication and Cholesky decomposition of
+ * GMatrix and GSymMatrix against straightforward reference loops. The
+ * program is not run by "make check"; build it using
+ * "make benchmark_GMatrix" in the test directory.
+ */
+
+/* __ Includes ___________________________________________________________ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+#include "GammaLib.hpp"
+
+/* __ OpenMP section _____________________________________________________ */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+/***********************************************************************//**
+ * @brief Return wall clock time in seconds
+ ***************************************************************************/
+double wall_time(void)
+{
+    #ifdef _OPENMP
+    return omp_get_wtime();
+    #else
+    return double(clock()) / double(CLOCKS_PER_SEC);
+    #endif
+}
+
+
+/***********************************************************************//**
+ * @brief Reference matrix multiplication
+ *
+ * @param[in] a Left hand side matrix.
+ * @param[in] b Right hand side matrix.
+ ***************************************************************************/
+GMatrix reference_product(const GMatrix& a, const GMatrix& b)
+{
+    GMatrix result(a.rows(), b.cols());
+    for (int row = 0; row < a.rows(); ++row) {
+        for (int col = 0; col < b.cols(); ++col) {
+            double sum = 0.0;
+            for (int i = 0; i < a.cols(); ++i) {
+                sum += a(row,i) * b(i,col);
+            }
+            result(row,col) = sum;
+        }
+    }
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Reference Cholesky decomposition
+ *
+ * @param[in,out] m Matrix (replaced by lower triangle of decomposition).
+ ***************************************************************************/
+void reference_cholesky(GMatrix& m)
+{
+    int n = m.rows();
+    for (int row = 0; row < n; ++row) {
+        double diag = 0.0;
+        for (int col = row; col < n; ++col) {
+            double sum = m(col,row);
+            for (int k = 0; k < row; ++k) {
+                sum -= m(row,k) * m(col,k);
+            }
+            if (row == col) {
+                m(row,row) = std::sqrt(sum);
+                diag       = 1.0 / m(row,row);
+            }
+            else {
+                m(col,row) = sum * diag;
+            }
+        }
+    }
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Main benchmark program
+ ***************************************************************************/
+int main(void)
+{
+    // Header
+    std::printf("%6s %14s %14s %14s %14s %10s\n", "n",
+                "mul ref [s]", "mul [s]", "chol ref [s]", "chol [s]",
+                "max diff");
+
+    // Loop over matrix sizes
+    int sizes[] = {100, 200, 400, 800};
+    for (int i = 0; i < 4; ++i) {
+
+        // Set matrices
+        int        n = sizes[i];
+        GMatrix    a(n, n);
+        GSymMatrix s(n, n);
+        for (int row = 0; row < n; ++row) {
+            for (int col = 0; col < n; ++col) {
+                a(row,col) = std::sin(0.1*row + 0.37*col);
+            }
+            for (int col = row; col < n; ++col) {
+                s(row,col) = std::cos(0.01*(row+col)) / (1.0 + col - row);
+            }
+            s(row,row) += n;
+        }
+
+        // Time multiplications
+        double  t0  = wall_time();
+        GMatrix ref = reference_product(a, a);
+        double  t1  = wall_time();
+        GMatrix mul = a * a;
+        double  t2  = wall_time();
+
+        // Time Cholesky decompositions
+        GMatrix    ref_chol = GMatrix(s);
+        GSymMatrix chol     = s;
+        double     t3       = wall_time();
+        reference_cholesky(ref_chol);
+        double     t4       = wall_time();
+        chol.cholesky_decompose(false);
+        double     t5       = wall_time();
+
+        // Determine maximum difference to reference
+        double diff = (abs(mul - ref)).max();
+        for (int row = 0; row < n; ++row) {
+            for (int col = 0; col <= row; ++col) {
+                double d = std::abs(chol(row,col) - ref_chol(row,col));
+                if (d > diff) {
+                    diff = d;
+                }
+            }
+        }
+
+        // Print result
+        std::printf("%6d %14.4f %14.4f %14.4f %14.4f %10.2e\n", n,
+                    t1-t0, t2-t1, t4-t3, t5-t4, diff);
+
+    } // endfor: looped over matrix sizes
+
+    // Return
+    return 0;
+}
@@ -298,6 +298,7 @@ void TestGFits::set(void)
     append(static_cast<pfunction>(&TestGFits::test_bintable_ulong), "Test bintable ulong");
     append(static_cast<pfunction>(&TestGFits::test_bintable_long), "Test bintable long");
     append(static_cast<pfunction>(&TestGFits::test_bintable_longlong), "Test bintable longlong");
+    append(static_cast<pfunction>(&TestGFits::test_bintable_paging), "Test bintable paging");
 
     // Return
     return;
@@ -1181,6 +1182,99 @@ void TestGFits::test_bintable_longlong(void)
 }
 
 
+/***************************************************************************
+ * @brief Test paged loading of FITS binary table columns
+ ***************************************************************************/
+void TestGFits::test_bintable_paging(void)
+{
+    // Set filename
+    std::string filename = "test_bintable_paging.fits";
+
+    // Remove FITS file
+    std::string cmd = "rm -rf "+ filename;
+    int rc = system(cmd.c_str());
+    test_value(rc, 0, "Remove FITS file \""+filename+"\"");
+
+    // Set number of rows and vector columns
+    int nrows = 100;
+    int nvec  = 3;
+
+    // Set columns
+    GFitsTableDoubleCol col1("DOUBLE", nrows);
+    GFitsTableDoubleCol col2("DOUBLE10", nrows, nvec);
+    for (int i = 0; i < nrows; ++i) {
+        col1(i) = double(i)*1.5;
+        for (int j = 0; j < nvec; ++j) {
+            col2(i,j) = double(i)*2.3 + double(j)*11.7;
+        }
+    }
+
+    // Write tables
+    TEST_WRITE_TABLES;
+
+    // Read columns back in pages
+    test_try("Read paged columns");
+    try {
+        GFits          fits(filename);
+        GFitsTableCol& page1 = (*fits.table(1))["DOUBLE"];
+        GFitsTableCol& page2 = (*fits.table(1))["DOUBLE10"];
+        page1.page(7);
+        page2.page(10);
+
+        // Access rows in forward direction
+        for (int i = 0; i < nrows; ++i) {
+            test_value(page1.real(i), double(i)*1.5, 1.0e-10,
+                       "Test forward access of row "+str(i));
+        }
+
+        // Access rows in backward direction
+        for (int i = nrows-1; i >= 0; --i) {
+            for (int j = 0; j < nvec; ++j) {
+                test_value(page2.real(i,j), double(i)*2.3 + double(j)*11.7,
+                           1.0e-10, "Test backward access of row "+str(i)+
+                           " and element "+str(j));
+            }
+        }
+
+        // Access rows alternately in the last (short) page and in other
+        // pages, so that pages of different size are loaded
+        int rows[] = {99, 0, 98, 45, 96, 71, 13};
+        for (int k = 0; k < 7; ++k) {
+            int i = rows[k];
+            test_value(page1.real(i), double(i)*1.5, 1.0e-10,
+                       "Test alternate access of row "+str(i));
+        }
+
+        // Change page size and access rows again
+        page1.page(30);
+        for (int k = 0; k < 7; ++k) {
+            int i = rows[k];
+            test_value(page1.real(i), double(i)*1.5, 1.0e-10,
+                       "Test access of row "+str(i)+" after page change");
+            test_value(page1.integer(i), int(double(i)*1.5), 1.0e-10,
+                       "Test integer access of row "+str(i));
+        }
+
+        // Copying a paged column loads the entire column
+        GFitsTableDoubleCol copy = static_cast<GFitsTableDoubleCol&>(page2);
+        for (int i = 0; i < nrows; ++i) {
+            for (int j = 0; j < nvec; ++j) {
+                test_value(copy(i,j), double(i)*2.3 + double(j)*11.7, 1.0e-10,
+                           "Test copy of row "+str(i)+" and element "+str(j));
+            }
+        }
+        fits.close();
+        test_try_success();
+    }
+    catch(std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
+
 /***************************************************************************
  * @brief Test unsigned long FITS binary table
  ***************************************************************************/
@@ -242,6 +242,7 @@ void TestGMatrix::set(void)
     append(static_cast<pfunction>(&TestGMatrix::matrix_arithmetics), "Test matrix arithmetics");
     append(static_cast<pfunction>(&TestGMatrix::matrix_functions), "Test matrix functions");
     append(static_cast<pfunction>(&TestGMatrix::matrix_compare), "Test matrix comparisons");
+    append(static_cast<pfunction>(&TestGMatrix::matrix_large), "Test large matrix operations");
     //append(static_cast<pfunction>(&TestGMatrix::matrix_cholesky), "Test matrix Cholesky decomposition");
     append(static_cast<pfunction>(&TestGMatrix::matrix_print), "Test matrix printing");
 
@@ -797,6 +798,88 @@ void TestGMatrix::matrix_cholesky(void)
 }
 */
 
+/***************************************************************************
+ * @brief Test large matrix operations
+ *
+ * Checks the blocked matrix multiplication, matrix*vector multiplication
+ * and transposition on matrices that span several blocks against a
+ * straightforward computation.
+ ***************************************************************************/
+void TestGMatrix::matrix_large(void)
+{
+    // Set matrix dimensions
+    int nrows  = 150;
+    int ninner = 130;
+    int ncols  = 170;
+
+    // Set matrices and vector
+    GMatrix a(nrows, ninner);
+    GMatrix b(ninner, ncols);
+    GVector v(ninner);
+    for (int row = 0; row < nrows; ++row) {
+        for (int col = 0; col < ninner; ++col) {
+            a(row,col) = std::sin(0.1*row + 0.37*col);
+        }
+    }
+    for (int row = 0; row < ninner; ++row) {
+        v[row] = std::cos(0.3*row);
+        for (int col = 0; col < ncols; ++col) {
+            b(row,col) = std::cos(0.23*row - 0.11*col);
+        }
+    }
+
+    // Test matrix multiplication
+    GMatrix product = a * b;
+    double  res     = 0.0;
+    for (int row = 0; row < nrows; ++row) {
+        for (int col = 0; col < ncols; ++col) {
+            double sum = 0.0;
+            for (int i = 0; i < ninner; ++i) {
+                sum += a(row,i) * b(i,col);
+            }
+            double diff = std::abs(product(row,col) - sum);
+            if (diff > res) {
+                res = diff;
+            }
+        }
+    }
+    test_value(product.rows(), nrows, "Test number of rows of product");
+    test_value(product.cols(), ncols, "Test number of columns of product");
+    test_value(res, 0.0, 1.0e-12, "Test large matrix multiplication");
+
+    // Test matrix*vector multiplication
+    GVector av = a * v;
+    res        = 0.0;
+    for (int row = 0; row < nrows; ++row) {
+        double sum = 0.0;
+        for (int col = 0; col < ninner; ++col) {
+            sum += a(row,col) * v[col];
+        }
+        double diff = std::abs(av[row] - sum);
+        if (diff > res) {
+            res = diff;
+        }
+    }
+    test_value(res, 0.0, 1.0e-12, "Test large matrix*vector multiplication");
+
+    // Test transposition
+    GMatrix at = transpose(a);
+    bool    ok = (at.rows() == ninner && at.cols() == nrows);
+    for (int row = 0; row < nrows && ok; ++row) {
+        for (int col = 0; col < ninner; ++col) {
+            if (at(col,row) != a(row,col)) {
+                ok = false;
+                break;
+            }
+        }
+    }
+    test_assert(ok, "Test large matrix transposition");
+
+    // Return
+    return;
+}
+
+
 /***************************************************************************
  * @brief Test matrix printing
  ***************************************************************************/
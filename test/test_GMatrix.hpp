@@ -56,6 +56,7 @@ public:
     void         matrix_arithmetics(void);
     void         matrix_functions(void);
     void         matrix_compare(void);
+    void         matrix_large(void);
     //void         matrix_cholesky(void);
     void         matrix_print(void);
 
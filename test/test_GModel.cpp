@@ -32,6 +32,7 @@
 #include <ostream>
 #include <stdexcept>
 #include <stdlib.h>
+#include <cmath>
 #include "test_GModel.hpp"
 
 /***********************************************************************//**
@@ -52,7 +53,9 @@ void TestGModel::set(void)
     add_test(static_cast<pfunction>(&TestGModel::test_model),"Test model handling");
     add_test(static_cast<pfunction>(&TestGModel::test_models),"Test models");
     add_test(static_cast<pfunction>(&TestGModel::test_spectral_model),"Test spectral model");
+    add_test(static_cast<pfunction>(&TestGModel::test_spectral_mc),"Test spectral model MC");
     add_test(static_cast<pfunction>(&TestGModel::test_spacial_model),"Test spacial model");
+    add_test(static_cast<pfunction>(&TestGModel::test_spatial_mc),"Test spatial model MC");
 
     return;
 }
@@ -230,6 +233,132 @@ void TestGModel::test_spectral_model(void)
     return;
 }
 
+/***********************************************************************//**
+ * @brief Test spectral model Monte Carlo sampling
+ *
+ * Test that the Monte Carlo cache of a node function gives the same
+ * energies when alternating between energy intervals, and after changing
+ * a node value, as models that are only used for a single interval.
+ * Furthermore test that energies drawn in one call equal single draws
+ * for all spectral models.
+ ***************************************************************************/
+void TestGModel::test_spectral_mc(void)
+{
+    // Load node function
+    GModels     models(m_xml_model_point_nodes);
+    GModelSky*  sky = dynamic_cast<GModelSky*>(models[0]);
+    test_assert(sky != NULL, "Sky model");
+    if (sky == NULL) {
+        return;
+    }
+    GModelSpectral* model = sky->spectral();
+
+    // Set energy intervals, including an interval that extends beyond
+    // the nodes
+    GEnergy emin[3];
+    GEnergy emax[3];
+    emin[0].MeV(1.0);
+    emax[0].MeV(3.0);
+    emin[1].MeV(3.0);
+    emax[1].MeV(10.0);
+    emin[2].MeV(0.5);
+    emax[2].MeV(20.0);
+
+    // Loop over passes
+    GRan ran1(1234);
+    GRan ran2(1234);
+    for (int k = 0; k < 2; ++k) {
+
+        // Change node value in the second pass
+        if (k == 1) {
+            (*model)[3].value(0.2);
+        }
+
+        // Set reference models that are each used for a single interval
+        GModels refs[3];
+        for (int ieng = 0; ieng < 3; ++ieng) {
+            refs[ieng].load(m_xml_model_point_nodes);
+            GModelSky* ref = dynamic_cast<GModelSky*>(refs[ieng][0]);
+            (*ref->spectral())[3].value((*model)[3].value());
+        }
+
+        // Draw energies alternating between energy intervals
+        for (int i = 0; i < 300; ++i) {
+            int        ieng   = i % 3;
+            GModelSky* ref    = dynamic_cast<GModelSky*>(refs[ieng][0]);
+            GEnergy    energy = model->mc(emin[ieng], emax[ieng], ran1);
+            GEnergy    expect = ref->spectral()->mc(emin[ieng], emax[ieng], ran2);
+            test_assert(energy >= emin[ieng] && energy <= emax[ieng],
+                        "Energy within interval");
+            test_value(energy.MeV(), expect.MeV(), 1.0e-10, "Cached energy");
+        }
+
+    } // endfor: looped over passes
+
+    // Check that energies drawn in one call equal single draws
+    GRan                 ran3(5678);
+    GRan                 ran4(5678);
+    std::vector<GEnergy> energies;
+    model->mc(100, emin[2], emax[2], ran3, energies);
+    test_value((int)energies.size(), 100, "Number of energies");
+    for (int i = 0; i < (int)energies.size(); ++i) {
+        GEnergy expect = model->mc(emin[2], emax[2], ran4);
+        test_value(energies[i].MeV(), expect.MeV(), 1.0e-10, "Batch energy");
+    }
+
+    // Check that the batch method is accessible from spectral models
+    // that only implement single draws, and that it gives the same
+    // energies as single draws
+    GModelSpectralPlaw   plaw(1.0, -2.0);
+    GModelSpectralPlaw2  plaw2(1.0, -2.5);
+    std::vector<GEnergy> batch[2];
+    GRan                 ran5(4321);
+    GRan                 ran6(4321);
+    plaw.mc(100, emin[2], emax[2], ran5, batch[0]);
+    plaw2.mc(100, emin[2], emax[2], ran6, batch[1]);
+    GModelSpectral* spectra[2] = {&plaw, &plaw2};
+    for (int k = 0; k < 2; ++k) {
+        GRan ran(4321);
+        test_value((int)batch[k].size(), 100, "Number of energies");
+        for (int i = 0; i < (int)batch[k].size(); ++i) {
+            GEnergy expect = spectra[k]->mc(emin[2], emax[2], ran);
+            test_value(batch[k][i].MeV(), expect.MeV(), 1.0e-10,
+                       "Batch energy of "+spectra[k]->type());
+        }
+    }
+
+    // Check that the batch method forwards exceptions of spectral models
+    // that do not support Monte Carlo sampling
+    GModelSpectralConst   constant;
+    GModelSpectralExpPlaw eplaw(1.0, -2.0, 10.0);
+    test_try("Batch energies of constant spectral model");
+    try {
+        constant.mc(10, emin[2], emax[2], ran5, energies);
+        test_try_failure("Exception expected for constant spectral model.");
+    }
+    catch (GException::feature_not_implemented &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+    test_try("Batch energies of exponentially cut off power law");
+    try {
+        eplaw.mc(10, emin[2], emax[2], ran5, energies);
+        test_try_failure("Exception expected for exponentially cut off power law.");
+    }
+    catch (GException::feature_not_implemented &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test spacial model
  ***************************************************************************/
@@ -239,6 +368,113 @@ void TestGModel::test_spacial_model(void)
     return;
 }
 
+/***********************************************************************//**
+ * @brief Test spatial model Monte Carlo sampling
+ *
+ * Test that the sky map pixels that are drawn from the alias table of a
+ * spatial map model are distributed according to the pixel fluxes of the
+ * map. Pixels without flux should never be drawn. Furthermore test that
+ * sky directions drawn in one call equal single draws for all spatial
+ * models.
+ ***************************************************************************/
+void TestGModel::test_spatial_mc(void)
+{
+    // Create small sky map with some empty pixels and save it
+    GSkymap map("CAR", "CEL", 83.63, 22.01, -0.5, 0.5, 5, 4);
+    for (int i = 0; i < map.npix(); ++i) {
+        map(i) = double(i * (i % 3));
+    }
+    map.save("test_model_spatial_map.fits", true);
+
+    // Compute expected fraction of events in each pixel
+    std::vector<double> fraction;
+    double              sum = 0.0;
+    for (int i = 0; i < map.npix(); ++i) {
+        double flux = map(i) * map.omega(i);
+        fraction.push_back(flux);
+        sum += flux;
+    }
+    for (int i = 0; i < map.npix(); ++i) {
+        fraction[i] /= sum;
+    }
+
+    // Draw sky directions from spatial map model
+    const int            number = 100000;
+    GModelSpatialMap     model("test_model_spatial_map.fits");
+    GRan                 ran(1234);
+    std::vector<GSkyDir> dirs;
+    model.mc(number, ran, dirs);
+    test_value((int)dirs.size(), number, "Number of sky directions");
+
+    // Build histogram of drawn sky map pixels
+    std::vector<int> counts(map.npix(), 0);
+    for (int i = 0; i < (int)dirs.size(); ++i) {
+        int ipix = map.dir2pix(dirs[i]);
+        if (ipix >= 0 && ipix < map.npix()) {
+            counts[ipix]++;
+        }
+    }
+
+    // Compare histogram to expected number of events. We allow for
+    // 5 standard deviations and a few events that fall on pixel borders.
+    for (int i = 0; i < map.npix(); ++i) {
+        double expect = number * fraction[i];
+        double sigma  = std::sqrt(expect * (1.0 - fraction[i]));
+        test_value(double(counts[i]), expect, 5.0*sigma + 10.0,
+                   "Number of events in pixel "+str(i));
+    }
+
+    // Check that the batch method is accessible from spatial models that
+    // only implement single draws, and that it gives the same sky
+    // directions as single draws
+    GSkyDir centre;
+    centre.radec_deg(83.63, 22.01);
+    GModelSpatialPtsrc   ptsrc(centre);
+    GModelRadialDisk     disk(centre, 0.5);
+    GModelRadialGauss    gauss(centre, 0.3);
+    GModelRadialShell    shell(centre, 0.5, 0.1);
+    std::vector<GSkyDir> batch[5];
+    GRan                 ran1(4321);
+    GRan                 ran2(4321);
+    GRan                 ran3(4321);
+    GRan                 ran4(4321);
+    GRan                 ran5(4321);
+    model.mc(100, ran1, batch[0]);
+    ptsrc.mc(100, ran2, batch[1]);
+    disk.mc(100, ran3, batch[2]);
+    gauss.mc(100, ran4, batch[3]);
+    shell.mc(100, ran5, batch[4]);
+    GModelSpatial* spatials[5] = {&model, &ptsrc, &disk, &gauss, &shell};
+    for (int k = 0; k < 5; ++k) {
+        GRan ran(4321);
+        test_value((int)batch[k].size(), 100, "Number of sky directions");
+        for (int i = 0; i < (int)batch[k].size(); ++i) {
+            GSkyDir expect = spatials[k]->mc(ran);
+            test_value(batch[k][i].dist_deg(expect), 0.0, 1.0e-10,
+                       "Batch sky direction of "+spatials[k]->type());
+        }
+    }
+
+    // Check that the batch method forwards exceptions of spatial models
+    // that do not support Monte Carlo sampling
+    GModelSpatialConst constant;
+    test_try("Batch sky directions of constant spatial model");
+    try {
+        constant.mc(10, ran1, dirs);
+        test_try_failure("Exception expected for constant spatial model.");
+    }
+    catch (GException::feature_not_implemented &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test models.
  ***************************************************************************/
@@ -40,7 +40,9 @@ class TestGModel : public GTestSuite
         void test_model(void);
         void test_models(void);
         void test_spectral_model(void);
+        void test_spectral_mc(void);
         void test_spacial_model(void);
+        void test_spatial_mc(void);
     // Private attributes
     private:
         std::string m_xml_file;
@@ -46,6 +46,8 @@ void TestGNumerics::set(void)
     //Unbinned
     add_test(static_cast<pfunction>(&TestGNumerics::test_integral),"Test GIntegral");
     add_test(static_cast<pfunction>(&TestGNumerics::test_romberg_integration),"Test Romberg integration");
+    add_test(static_cast<pfunction>(&TestGNumerics::test_gauss_kronrod_integration),"Test Gauss-Kronrod integration");
+    add_test(static_cast<pfunction>(&TestGNumerics::test_gauss_legendre_integration),"Test Gauss-Legendre integration");
     return;
 }
 
@@ -81,6 +83,51 @@ void TestGNumerics::test_romberg_integration(void)
 }
 
 
+
+/***********************************************************************//**
+ * @brief Test adaptive Gauss-Kronrod integration.
+ ***************************************************************************/
+void TestGNumerics::test_gauss_kronrod_integration(void)
+{
+    Gauss     integrand(m_sigma);
+    GIntegral integral(&integrand);
+    double    result = integral.gauss_kronrod(-10.0*m_sigma, 10.0*m_sigma);
+    test_value(result,1.0,1.0e-6,"","Gaussian integral is not 1.0 (integral="+str(result)+")");
+
+    result = integral.gauss_kronrod(-m_sigma, m_sigma);
+    test_value(result,0.68268948130801355,1.0e-6,"","Gaussian integral is not 0.682689 (difference="+str((result-0.68268948130801355))+")");
+
+    result = integral.gauss_kronrod(0.0, m_sigma);
+    test_value(result,0.3413447460687748,1.0e-6,"","Gaussian integral is not 0.341345 (difference="+str((result-0.3413447460687748))+")");
+
+    // Check integration method selection and evaluation counter. Each
+    // bisection adds two 21-point rules.
+    GIntegral kronrod(&integrand);
+    kronrod.eps(1.0e-2);
+    kronrod.method("GAUSS-KRONROD");
+    result = kronrod.integrate(-10.0*m_sigma, 10.0*m_sigma);
+    test_value(result,1.0,1.0e-2,"","Gaussian integral is not 1.0 (integral="+str(result)+")");
+    test_value(kronrod.calls(),21*(2*kronrod.iter()-1),"","Unexpected number of integrand evaluations (calls="+str(kronrod.calls())+")");
+}
+
+
+/***********************************************************************//**
+ * @brief Test Gauss-Legendre integration.
+ ***************************************************************************/
+void TestGNumerics::test_gauss_legendre_integration(void)
+{
+    Gauss     integrand(m_sigma);
+    GIntegral integral(&integrand);
+    integral.method("GAUSS-LEGENDRE");
+    integral.order(20);
+    double result = integral.integrate(-m_sigma, m_sigma);
+    test_value(result,0.68268948130801355,1.0e-6,"","Gaussian integral is not 0.682689 (difference="+str((result-0.68268948130801355))+")");
+    test_value(integral.calls(),20,"","Number of integrand evaluations is not 20 (calls="+str(integral.calls())+")");
+
+    result = integral.gauss_legendre(0.0, m_sigma);
+    test_value(result,0.3413447460687748,1.0e-6,"","Gaussian integral is not 0.341345 (difference="+str((result-0.3413447460687748))+")");
+}
+
 /***********************************************************************//**
  * @brief Main test function.
  ***************************************************************************/
@@ -56,6 +56,8 @@ class TestGNumerics : public GTestSuite
         virtual void set(void);
         void test_integral(void);
         void test_romberg_integration(void);
+        void test_gauss_kronrod_integration(void);
+        void test_gauss_legendre_integration(void);
 
     // Private attributes
     private:
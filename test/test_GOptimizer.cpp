@@ -29,6 +29,7 @@
 #include <config.h>
 #endif
 //#include <stdlib.h>
+#include <cmath>
 #include "test_GOptimizer.hpp"
 #include "testinst/GTestLib.hpp"
 
@@ -49,12 +50,58 @@ void TestGOptimizer::set(void){
     // Append tests
     append(static_cast<pfunction>(&TestGOptimizer::test_unbinned_optimizer), "Test unbinned optimization");
     append(static_cast<pfunction>(&TestGOptimizer::test_binned_optimizer), "Test binned optimization");
+    append(static_cast<pfunction>(&TestGOptimizer::test_model_range), "Test model evaluation for event range");
+    append(static_cast<pfunction>(&TestGOptimizer::test_event_parallel), "Test event-level parallelism");
+    append(static_cast<pfunction>(&TestGOptimizer::test_lbfgs_optimizer), "Test L-BFGS optimization");
+    append(static_cast<pfunction>(&TestGOptimizer::test_lbfgs_bounds), "Test L-BFGS optimization with boundaries");
+    append(static_cast<pfunction>(&TestGOptimizer::test_model_cache), "Test model caching");
+    append(static_cast<pfunction>(&TestGOptimizer::test_lambda_trials), "Test speculative lambda trials");
+    append(static_cast<pfunction>(&TestGOptimizer::test_profile_errors), "Test profile-likelihood errors");
 
     // Return
     return;
 }
 
 
+/***********************************************************************//**
+ * @brief Create observation container for testing
+ *
+ * @param[in] mode Testing mode (0 = unbinned, 1 = binned).
+ *
+ * Returns an observation container holding a single test observation of
+ * 1800 sec with events drawn from the test model with a fixed seed.
+ ***************************************************************************/
+GObservations TestGOptimizer::make_obs(int mode)
+{
+    // Create test model
+    GTestModelData model;
+
+    // Time interval
+    GTime tmin(0,0,   "sec");
+    GTime tmax(1800,0,"sec");
+
+    // Generate events
+    GRan ran;
+    ran.seed(0);
+    GEvents* events = (mode == UN_BINNED)
+                      ? (GEvents*)model.generateList(RATE,tmin,tmax,ran)
+                      : (GEvents*)model.generateCube(RATE,tmin,tmax,ran);
+
+    // Create observation
+    GTestObservation ob;
+    ob.events(events);
+    ob.ontime(tmax.met()-tmin.met());
+    delete events;
+
+    // Append observation to container
+    GObservations obs;
+    obs.append(ob);
+
+    // Return observation container
+    return obs;
+}
+
+
 /***********************************************************************//**
  * @brief Test optimizer
  *
@@ -131,6 +178,16 @@ GModelPar& TestGOptimizer::test_optimizer(int mode)
     //check if value is correct
     test_value(result.value(),RATE,result.error()*3); 
 
+    // Check that error corresponds to curvature at the best fit
+    GObservations::optimizer fct(&obs);
+    fct.eval(obs.models());
+    double curv = (*fct.covar())(0,0);
+    test_assert(curv > 0.0, "Check curvature at best fit");
+    if (curv > 0.0) {
+        test_value(result.error(), 1.0/std::sqrt(curv), 1.0e-10,
+                   "Check error at best fit");
+    }
+
     // Return
     return (*(obs.models()[0]))[0];
 }
@@ -162,6 +219,486 @@ void TestGOptimizer::test_binned_optimizer(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test event-level parallelism
+ *
+ * Verifies that distributing the events of a single observation over
+ * several threads gives the same likelihood, gradient and curvature as the
+ * serial evaluation, for both unbinned and binned observations.
+ ***************************************************************************/
+void TestGOptimizer::test_event_parallel(void)
+{
+    // Loop over unbinned and binned mode
+    for (int mode = UN_BINNED; mode <= BINNED; ++mode) {
+
+        // Create model
+        GTestModelData model;
+        GModels        models;
+        models.append(model);
+
+        // Create a single observation
+        GObservations obs = make_obs(mode);
+        obs.models(models);
+
+        // Set free parameter
+        (*(obs.models()[0]))[0].value(0.9*RATE);
+
+        // Evaluate likelihood serially
+        GObservations::optimizer serial(&obs);
+        serial.eval(obs.models());
+
+        // Evaluate likelihood with event-level parallelism
+        GObservations::optimizer parallel(&obs);
+        parallel.nthreads(4);
+        parallel.eval(obs.models());
+
+        // Compare results
+        test_value(*(parallel.value()), *(serial.value()), 1.0e-6,
+                   "Check likelihood value");
+        test_value(parallel.npred(), serial.npred(), 1.0e-6,
+                   "Check Npred");
+        test_value((*parallel.gradient())[0], (*serial.gradient())[0], 1.0e-6,
+                   "Check gradient");
+        test_value((*parallel.covar())(0,0), (*serial.covar())(0,0), 1.0e-6,
+                   "Check curvature");
+
+        // Fit with event-level parallelism requested on the observations
+        GObservations obs_serial   = obs;
+        GObservations obs_parallel = obs;
+        obs_parallel.nthreads(4);
+        GOptimizerLM opt_serial;
+        GOptimizerLM opt_parallel;
+        obs_serial.optimize(opt_serial);
+        obs_parallel.optimize(opt_parallel);
+
+        // Compare fit results
+        test_value(obs_parallel.nthreads(), 4, "Check number of threads");
+        test_value((*(obs_parallel.models()[0]))[0].value(),
+                   (*(obs_serial.models()[0]))[0].value(), 1.0e-6,
+                   "Check fitted parameter");
+        test_value(obs_parallel.npred(), obs_serial.npred(),
+                   1.0e-6*obs_serial.npred(), "Check fitted Npred");
+
+    } // endfor: looped over modes
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test model evaluation for a range of events
+ *
+ * Checks that the model values and gradients returned for a range of
+ * events are identical to those obtained event by event.
+ ***************************************************************************/
+void TestGOptimizer::test_model_range(void)
+{
+    // Loop over unbinned and binned mode
+    for (int mode = UN_BINNED; mode <= BINNED; ++mode) {
+
+        // Create model
+        GTestModelData model;
+        GModels        models;
+        models.append(model);
+        (*(models[0]))[0].value(0.9*RATE);
+
+        // Create observation
+        GObservations container = make_obs(mode);
+        GObservation& obs       = container[0];
+
+        // Evaluate model for a range of events
+        int                 num   = (obs.events()->size() < 100) ? obs.events()->size() : 100;
+        int                 npars = models.npars();
+        std::vector<double> values(num);
+        std::vector<double> gradients(num*npars);
+        obs.model(models, 0, num, &values[0], &gradients[0]);
+
+        // Compare to event-wise evaluation
+        GVector gradient(npars);
+        for (int i = 0; i < num; ++i) {
+            double value = obs.model(models, *((*obs.events())[i]), &gradient);
+            test_value(values[i], value, 1.0e-10, "Check model value");
+            for (int k = 0; k < npars; ++k) {
+                test_value(gradients[i*npars+k], gradient[k], 1.0e-10,
+                           "Check model gradient");
+            }
+        }
+
+    } // endfor: looped over modes
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test L-BFGS optimizer
+ *
+ * Checks that the evaluation without curvature matrix gives the same
+ * likelihood and gradient as the full evaluation, and that the L-BFGS
+ * optimizer finds the same best fit and error as the Levenberg-Marquardt
+ * optimizer, for both unbinned and binned observations.
+ ***************************************************************************/
+void TestGOptimizer::test_lbfgs_optimizer(void)
+{
+    // Loop over unbinned and binned mode
+    for (int mode = UN_BINNED; mode <= BINNED; ++mode) {
+
+        // Create model
+        GTestModelData model;
+        GModels        models;
+        models.append(model);
+        (*(models[0]))[0].value(0.9*RATE);
+
+        // Create a single observation
+        GObservations obs = make_obs(mode);
+        obs.models(models);
+
+        // Evaluate likelihood with and without curvature matrix
+        GObservations::optimizer full(&obs);
+        GObservations::optimizer nocurv(&obs);
+        nocurv.curvature(false);
+        full.eval(obs.models());
+        nocurv.eval(obs.models());
+        test_value(*(nocurv.value()), *(full.value()), 1.0e-10,
+                   "Check likelihood value without curvature");
+        test_value((*nocurv.gradient())[0], (*full.gradient())[0], 1.0e-10,
+                   "Check gradient without curvature");
+        test_value((*nocurv.covar())(0,0), 0.0, 1.0e-10,
+                   "Check empty curvature");
+
+        // Fit using Levenberg-Marquardt and L-BFGS optimizers
+        GObservations obs_lm = obs;
+        GOptimizerLM    lm;
+        GOptimizerLBFGS lbfgs;
+        obs_lm.optimize(lm);
+        obs.optimize(lbfgs);
+        GModelPar& par_lm    = (*(obs_lm.models()[0]))[0];
+        GModelPar& par_lbfgs = (*(obs.models()[0]))[0];
+
+        // Compare results
+        test_assert(lbfgs.status() == G_LBFGS_CONVERGED,
+                    "Check if L-BFGS converged");
+        test_value(par_lbfgs.value(), par_lm.value(), 0.01*par_lm.error(),
+                   "Check L-BFGS best fit");
+        test_value(par_lbfgs.error(), par_lm.error(), 1.0e-3*par_lm.error(),
+                   "Check L-BFGS error");
+        test_value(lbfgs.value(), lm.value(), 1.0e-4,
+                   "Check L-BFGS function value");
+
+    } // endfor: looped over modes
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test L-BFGS optimizer with parameter boundaries
+ *
+ * Fits a quadratic function of coupled parameters whose minimum lies
+ * outside the valid range of one parameter. Verifies that this parameter
+ * ends at its boundary, that the function is minimised with respect to all
+ * other parameters, and that the curvature setting of the function is
+ * restored if an evaluation throws an exception.
+ ***************************************************************************/
+void TestGOptimizer::test_lbfgs_bounds(void)
+{
+    // Setup parameters
+    GSkyDir            dir;
+    GModelSpatialPtsrc ptsrc(dir);
+    GModelSpectralPlaw plaw;
+    GModelPointSource  source(ptsrc, plaw);
+    GModels models;
+    models.append(source);
+    int npars = models.npars();
+    for (int i = 0; i < npars; ++i) {
+        models.par(i).remove_range();
+        models.par(i).value(0.0);
+        models.par(i).free();
+    }
+
+    // Restrict parameter 2 to values below its unconstrained minimum
+    models.par(2).value(-1.0);
+    models.par(2).max(-0.5);
+
+    // Fit function
+    TestOptimizerFunction fct(npars);
+    GOptimizerLBFGS       lbfgs;
+    lbfgs.eps(1.0e-10);
+    GModels result = lbfgs(fct, models);
+    test_assert(lbfgs.status() == G_LBFGS_CONVERGED,
+                "Check if L-BFGS converged");
+    test_assert(fct.curvature(), "Check that curvature setting is restored");
+
+    // Check that the constrained parameter is at its boundary and that the
+    // gradient points outside the valid range
+    fct.eval(result);
+    test_value(result.par(2).value(), -0.5, 1.0e-10,
+               "Check parameter at boundary");
+    test_assert((*fct.gradient())[2] < 0.0,
+                "Check gradient of parameter at boundary");
+
+    // Check that the function is minimised with respect to all other
+    // parameters
+    for (int i = 0; i < npars; ++i) {
+        if (i != 2) {
+            test_value((*fct.gradient())[i], 0.0, 1.0e-3,
+                       "Check gradient of parameter "+str(i));
+        }
+    }
+
+    // Check that the curvature setting is restored if the function throws
+    // an exception
+    fct.throws(true);
+    test_try("Check exception during L-BFGS optimization");
+    try {
+        lbfgs(fct, models);
+        test_try_failure("Exception expected from function evaluation.");
+    }
+    catch (GException::invalid_argument &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+    test_assert(fct.curvature(),
+                "Check that curvature setting is restored after exception");
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test model caching
+ *
+ * Verifies that the likelihood, gradient and curvature obtained with model
+ * caching are identical to those obtained without caching when only one
+ * of two models changes between evaluations.
+ ***************************************************************************/
+void TestGOptimizer::test_model_cache(void)
+{
+    // Loop over unbinned and binned mode
+    for (int mode = UN_BINNED; mode <= BINNED; ++mode) {
+
+        // Create two models
+        GTestModelData model;
+        GModels        models;
+        models.append(model);
+        models.append(model);
+
+        // Create a single observation
+        GObservations obs = make_obs(mode);
+        obs.models(models);
+        (*(obs.models()[0]))[0].value(0.4*RATE);
+        (*(obs.models()[1]))[0].value(0.5*RATE);
+
+        // Evaluate twice with cache, changing only the second model
+        GObservations::optimizer cached(&obs);
+        cached.eval(obs.models());
+        double first = *(cached.value());
+        cached.eval(obs.models());
+        test_value(*(cached.value()), first, 1.0e-10,
+                   "Check repeated evaluation");
+        (*(obs.models()[1]))[0].value(0.6*RATE);
+        cached.eval(obs.models());
+
+        // Evaluate without cache
+        GObservations::optimizer direct(&obs);
+        direct.cache(false);
+        direct.eval(obs.models());
+
+        // Compare results
+        test_assert(!direct.cache(), "Check that caching is disabled");
+        test_value(*(cached.value()), *(direct.value()), 1.0e-10,
+                   "Check likelihood value");
+        test_value(cached.npred(), direct.npred(), 1.0e-10,
+                   "Check Npred");
+        for (int i = 0; i < 2; ++i) {
+            test_value((*cached.gradient())[i], (*direct.gradient())[i],
+                       1.0e-10, "Check gradient");
+            for (int k = 0; k < 2; ++k) {
+                test_value((*cached.covar())(i,k), (*direct.covar())(i,k),
+                           1.0e-10, "Check curvature");
+            }
+        }
+
+    } // endfor: looped over modes
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test speculative lambda trials
+ *
+ * Verifies that a LM fit using concurrent lambda trials converges to the
+ * same result as the serial LM fit, for both unbinned and binned
+ * observations, and that functions that cannot be cloned are fitted.
+ ***************************************************************************/
+void TestGOptimizer::test_lambda_trials(void)
+{
+    // Loop over unbinned and binned mode
+    for (int mode = UN_BINNED; mode <= BINNED; ++mode) {
+
+        // Create model
+        GTestModelData model;
+        GModels        models;
+        models.append(model);
+
+        // Create a single observation
+        GObservations obs = make_obs(mode);
+
+        // Fit serially, starting far from the optimum
+        GModels start = models;
+        (*(start[0]))[0].value(0.1*RATE);
+        obs.models(start);
+        GOptimizerLM serial;
+        obs.optimize(serial);
+        double serial_value = (*(obs.models()[0]))[0].value();
+        double serial_error = (*(obs.models()[0]))[0].error();
+
+        // Fit with concurrent lambda trials
+        obs.models(start);
+        GOptimizerLM trials;
+        trials.lambda_trials(4);
+        obs.optimize(trials);
+        double trials_value = (*(obs.models()[0]))[0].value();
+
+        // Compare results
+        test_value(trials.lambda_trials(), 4, "Check number of lambda trials");
+        test_assert(trials.status() == 0, "Check convergence");
+        test_value(trials.value(), serial.value(), 1.0e-4,
+                   "Check function value");
+        test_value(trials_value, serial_value, 1.0e-4*serial_value,
+                   "Check fitted parameter");
+        test_value((*(obs.models()[0]))[0].error(), serial_error,
+                   1.0e-3*serial_error, "Check parameter error");
+
+    } // endfor: looped over modes
+
+    // Fit a function of coupled parameters with concurrent lambda trials,
+    // and a function that cannot be cloned, for which the trials fall back
+    // to serial iterations
+    GSkyDir            dir;
+    GModelSpatialPtsrc ptsrc(dir);
+    GModelSpectralPlaw plaw;
+    GModelPointSource  source(ptsrc, plaw);
+    GModels            models;
+    models.append(source);
+    int npars = models.npars();
+    for (int i = 0; i < npars; ++i) {
+        models.par(i).remove_range();
+        models.par(i).value(0.0);
+        models.par(i).free();
+    }
+    for (int cloneable = 0; cloneable < 2; ++cloneable) {
+        TestOptimizerFunction fct(npars);
+        fct.cloneable(cloneable);
+        GOptimizerLM trials;
+        trials.lambda_trials(4);
+        GModels result = trials(fct, models);
+        test_assert(trials.status() == 0, "Check convergence");
+        for (int i = 0; i < npars; ++i) {
+            test_value(result.par(i).value(), 1.0 - 0.5 * i, 1.0e-4,
+                       "Check fitted parameter "+str(i));
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test profile-likelihood errors
+ *
+ * Verifies that the profile errors of a quadratic function of coupled
+ * parameters equal the errors from the curvature matrix, both for a
+ * function that can be cloned and for one that cannot, that the profile
+ * errors of a Poisson likelihood are asymmetric, and that invalid
+ * parameter indices are rejected.
+ ***************************************************************************/
+void TestGOptimizer::test_profile_errors(void)
+{
+    // Setup models of coupled parameters
+    GSkyDir            dir;
+    GModelSpatialPtsrc ptsrc(dir);
+    GModelSpectralPlaw plaw;
+    GModelPointSource  source(ptsrc, plaw);
+    GModels            models;
+    models.append(source);
+    int npars = models.npars();
+    for (int i = 0; i < npars; ++i) {
+        models.par(i).remove_range();
+        models.par(i).value(0.0);
+        models.par(i).free();
+    }
+
+    // Compare profile errors to curvature errors for a quadratic function
+    for (int cloneable = 0; cloneable < 2; ++cloneable) {
+        TestOptimizerFunction fct(npars);
+        fct.cloneable(cloneable);
+        GOptimizerLM opt;
+        for (int i = 0; i < npars; ++i) {
+            opt.profile(i);
+        }
+        GModels result = opt(fct, models);
+        test_value(opt.nprofile(), npars, "Check number of profiled parameters");
+        test_assert(opt.status() == 0, "Check convergence");
+        test_value(opt.value(), *(fct.value()), 1.0e-10,
+                   "Check that function state corresponds to best fit");
+        for (int i = 0; i < npars; ++i) {
+            double error = result.par(i).error();
+            test_value(opt.error_lower(i), error, 1.0e-3*error,
+                       "Check lower profile error of parameter "+str(i));
+            test_value(opt.error_upper(i), error, 1.0e-3*error,
+                       "Check upper profile error of parameter "+str(i));
+        }
+    }
+
+    // Profile a Poisson likelihood, for which the lower error is smaller
+    // than the upper error
+    GTestModelData model;
+    GModels        rate;
+    rate.append(model);
+    GObservations obs = make_obs(UN_BINNED);
+    obs.models(rate);
+    GOptimizerLM opt;
+    opt.profile(0);
+    obs.optimize(opt);
+    double error = (*(obs.models()[0]))[0].error();
+    test_assert(opt.status() == 0, "Check convergence");
+    test_assert(opt.error_lower(0) < opt.error_upper(0),
+                "Check asymmetry of profile errors");
+    test_value(opt.error_lower(0), error, 0.1*error,
+               "Check lower profile error");
+    test_value(opt.error_upper(0), error, 0.1*error,
+               "Check upper profile error");
+
+    // Check that invalid parameter indices are rejected
+    test_try("Check invalid profile parameter");
+    try {
+        TestOptimizerFunction fct(npars);
+        GOptimizerLM invalid;
+        invalid.profile(npars);
+        invalid(fct, models);
+        test_try_failure("Expected GException::out_of_range exception.");
+    }
+    catch (GException::out_of_range &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
 /***************************************************************************
  * @brief Main entry point for test executable
  ***************************************************************************/
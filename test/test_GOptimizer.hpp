@@ -31,6 +31,85 @@
 #include "GammaLib.hpp"
 
 
+/***********************************************************************//**
+ * @class TestOptimizerFunction
+ *
+ * @brief Quadratic optimizer function for optimizer testing
+ *
+ * Implements f(x) = 1/2 (x-c)^T A (x-c) with a tridiagonal positive
+ * definite matrix A, so that all parameters are coupled. Gradient and
+ * curvature vanish for fixed parameters. If requested, the
+ * eval() method throws an exception, and clone() signals that the function
+ * cannot be cloned.
+ ***************************************************************************/
+class TestOptimizerFunction : public GOptimizerFunction {
+
+public:
+    // Constructors and destructors
+    explicit TestOptimizerFunction(const int& npars) : GOptimizerFunction(),
+             m_value(0.0), m_gradient(npars), m_covar(npars,npars),
+             m_centre(npars), m_throw(false), m_cloneable(true) {
+        for (int i = 0; i < npars; ++i) {
+            m_centre[i] = 1.0 - 0.5 * i;
+        }
+    }
+    virtual ~TestOptimizerFunction(void) {}
+
+    // Implemented virtual methods
+    virtual TestOptimizerFunction* clone(void) const {
+        return (m_cloneable ? new TestOptimizerFunction(*this) : NULL);
+    }
+    virtual void eval(const GOptimizerPars& pars) {
+        if (m_throw) {
+            throw GException::invalid_argument("TestOptimizerFunction::eval",
+                                               "Requested exception.");
+        }
+        int     n = m_centre.size();
+        GVector dx(n);
+        for (int i = 0; i < n; ++i) {
+            dx[i] = pars.par(i).value() - m_centre[i];
+        }
+        m_value = 0.0;
+        m_covar = GSparseMatrix(n,n);
+        for (int i = 0; i < n; ++i) {
+            m_gradient[i] = 0.0;
+            for (int k = i-1; k <= i+1; ++k) {
+                if (k >= 0 && k < n) {
+                    double a = element(i,k);
+                    m_value += 0.5 * dx[i] * a * dx[k];
+                    if (pars.par(i).isfree()) {
+                        m_gradient[i] += a * dx[k];
+                        if (curvature() && pars.par(k).isfree()) {
+                            m_covar(i,k) = a;
+                        }
+                    }
+                }
+            }
+        }
+        return;
+    }
+    virtual double*        value(void) { return &m_value; }
+    virtual GVector*       gradient(void) { return &m_gradient; }
+    virtual GSparseMatrix* covar(void) { return &m_covar; }
+
+    // Methods
+    void   throws(const bool& flag) { m_throw=flag; }
+    void   cloneable(const bool& flag) { m_cloneable=flag; }
+    double element(const int& i, const int& k) const {
+        return ((i == k) ? 2.0 : -0.8);
+    }
+
+protected:
+    // Protected members
+    double        m_value;     //!< Function value
+    GVector       m_gradient;  //!< Function gradient
+    GSparseMatrix m_covar;     //!< Curvature matrix
+    GVector       m_centre;    //!< Function minimum
+    bool          m_throw;     //!< Throw an exception in eval()
+    bool          m_cloneable; //!< Function can be cloned
+};
+
+
 /***********************************************************************//**
  * @class TestGOptimizer
  *
@@ -44,9 +123,17 @@ public:
     virtual ~TestGOptimizer(void){}
 
     // Methods
-    virtual void set(void);
-    void         test_unbinned_optimizer(void);
-    void         test_binned_optimizer(void);
-    GModelPar&   test_optimizer(int mode);
+    virtual void  set(void);
+    void          test_unbinned_optimizer(void);
+    void          test_binned_optimizer(void);
+    void          test_model_range(void);
+    void          test_event_parallel(void);
+    void          test_lbfgs_optimizer(void);
+    void          test_lbfgs_bounds(void);
+    void          test_model_cache(void);
+    void          test_lambda_trials(void);
+    void          test_profile_errors(void);
+    GModelPar&    test_optimizer(int mode);
+    GObservations make_obs(int mode);
 };
 #endif /* TEST_GOPTIMIZER_HPP */
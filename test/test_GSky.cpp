@@ -31,6 +31,7 @@
 #include <iostream>                           // cout, cerr
 #include <stdexcept>                          // std::exception
 #include <stdlib.h>
+#include <cmath>
 #include "test_GSky.hpp"
 #include "GTools.hpp"
 
@@ -226,6 +227,58 @@ double TestGSky::wcs_copy(GWcslib* wcs, int nx, int ny, double& crpix1, double&
 }
 
 
+/***********************************************************************//**
+ * @brief Test consistency of vector and single pixel transformations
+ *
+ * @param[in] nx Number of points in X
+ * @param[in] ny Number of points in Y
+ ***************************************************************************/
+double TestGSky::wcs_batch(GWcslib* wcs, int nx, int ny)
+{
+    // Set pixels
+    std::vector<GSkyPixel> pixels;
+    for (int iy = 0; iy < ny; ++iy) {
+        for (int ix = 0; ix < nx; ++ix) {
+            pixels.push_back(GSkyPixel(double(ix), double(iy)));
+        }
+    }
+
+    // Transform all pixels to world and back
+    std::vector<GSkyDir>   dirs = wcs->xy2dir(pixels);
+    std::vector<GSkyPixel> back = wcs->dir2xy(dirs);
+
+    // Initialise maximal angle and distance
+    double angle_max = 0.0;
+    double dist_max  = 0.0;
+
+    // Compare to single pixel transformations
+    int npixels = pixels.size();
+    for (int i = 0; i < npixels; ++i) {
+
+        // Compare sky directions (component-wise, as the angular distance
+        // is not precise for almost identical directions)
+        GSkyDir dir   = wcs->xy2dir(pixels[i]);
+        double  dra   = std::abs(dirs[i].ra_deg()-dir.ra_deg());
+        double  ddec  = std::abs(dirs[i].dec_deg()-dir.dec_deg());
+        double  angle = (dra > ddec) ? dra : ddec;
+        if (angle > angle_max)
+            angle_max = angle;
+
+        // Compare sky pixels
+        GSkyPixel pix  = wcs->dir2xy(dirs[i]);
+        double    dx   = back[i].x()-pix.x();
+        double    dy   = back[i].y()-pix.y();
+        double    dist = sqrt(dx*dx+dy*dy);
+        if (dist > dist_max)
+            dist_max = dist;
+
+    } // endfor: looped over pixels
+
+    // Return
+    return ((dist_max > angle_max) ? dist_max : angle_max);
+}
+
+
 /***********************************************************************//**
  * @brief Test GWcslib projections
  *
@@ -337,6 +390,34 @@ void TestGSky::test_GWcslib(void)
                 test_try_failure(e);
             }
 
+            // Test CEL vector conversion
+            test_try("Test CEL vector conversion");
+            try {
+                double tol = 0.0;
+                if ((tol = wcs_batch(cel, nx, ny)) > 1.0e-10) {
+                    throw exception_failure("CEL vector transformation tolerance 1.0e-10 exceeded: "+str(tol));
+                }
+
+                test_try_success();
+            }
+            catch (std::exception &e) {
+                test_try_failure(e);
+            }
+
+            // Test GAL vector conversion
+            test_try("Test GAL vector conversion");
+            try {
+                double tol = 0.0;
+                if ((tol = wcs_batch(gal, nx, ny)) > 1.0e-10) {
+                    throw exception_failure("GAL vector transformation tolerance 1.0e-10 exceeded: "+str(tol));
+                }
+
+                test_try_success();
+            }
+            catch (std::exception &e) {
+                test_try_failure(e);
+            }
+
             test_try_success();
         }
         catch (std::exception &e) {
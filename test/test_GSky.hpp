@@ -45,6 +45,7 @@ class TestGSky : public GTestSuite
     private:
         double wcs_forth_back_pixel(GWcslib* wcs, int nx, int ny, double& crpix1, double& crpix2);
         double wcs_copy(GWcslib* wcs, int nx, int ny, double& crpix1, double& crpix2);
+        double wcs_batch(GWcslib* wcs, int nx, int ny);
 };
 
 #endif /* TEST_GSKY_HPP */
@@ -501,6 +501,35 @@ void TestGSparseMatrix::assign_values(void)
                 "Test stack fill with tiny stack using add_col(GVector) method",
                 "Found:\n"+sparse.print()+"\nExpected:\n"+reference.print());
 
+    // Zero matrix and refill it using the same matrix stack twice, which
+    // needs to give the same matrix as a single fill
+    GSparseMatrix zeroed = initial;
+    zeroed.stack_init(100,50);
+    for (int k = 0; k < 2; ++k) {
+        zeroed.zero();
+        for (int i = 3; i < 5; ++i) {
+            column    = 0.0;
+            column[i] = 5.0;
+            zeroed.add_col(column, i);
+        }
+        for (int j = 0; j < 10; ++j) {
+            int col = int(0.8 * j + 0.5);
+            if (col > 9) col -= 10;
+            int i_min = (j < 2) ?  0 : j-2;
+            int i_max = (j > 8) ? 10 : j+2;
+            column = 0.0;
+            for (int i = i_min; i < i_max; ++i) {
+                column[i] = (i+1)*1;
+            }
+            zeroed.add_col(column, col);
+        }
+        zeroed.stack_flush();
+    }
+    zeroed.stack_destroy();
+    test_assert((zeroed == reference),
+                "Test refill of zeroed matrix using add_col(GVector) method",
+                "Found:\n"+zeroed.print()+"\nExpected:\n"+reference.print());
+
     // Insert column into 10 x 10 matrix using no matrix stack and the
     // add_col(GVector) method
     sparse = initial;
@@ -1235,6 +1264,55 @@ void TestGSparseMatrix::matrix_cholesky(void)
     res = (abs(ciz_residuals)).max();
     test_value(res, 0.0, 1.0e-15, "Test compressed matrix Cholesky inverter");
 
+    // Test Cholesky decomposition reusing the symbolic analysis of a
+    // matrix with identical sparsity pattern
+    GSparseMatrix chol_reuse = chol_test;
+    chol_reuse(0,0) = 2.0;
+    chol_reuse(1,0) = 0.5;
+    chol_reuse(0,1) = 0.5;
+    chol_reuse(3,3) = 3.0;
+    GSparseMatrix cd_reuse  = chol_reuse;
+    GSparseMatrix cd_direct = chol_reuse;
+    cd_reuse.cholesky_decompose(cd);
+    cd_direct.cholesky_decompose();
+    a0    = GVector(5);
+    for (int i = 0; i < 5; ++i) {
+        a0[i] = 1.0 + 0.5 * i;
+    }
+    s0    = cd_reuse.cholesky_solver(a0);
+    res   = max(abs(s0-cd_direct.cholesky_solver(a0)));
+    test_value(res, 0.0, 1.0e-15, "Test Cholesky decomposition with reuse - 1");
+    res   = max(abs(chol_reuse*s0-a0));
+    test_value(res, 0.0, 1.0e-14, "Test Cholesky decomposition with reuse - 2");
+
+    // Test Cholesky decomposition reusing the analysis of the same object
+    cd_reuse = chol_reuse;
+    cd_reuse.cholesky_decompose(cd_reuse);
+    s0    = cd_reuse.cholesky_solver(a0);
+    res   = max(abs(s0-cd_direct.cholesky_solver(a0)));
+    test_value(res, 0.0, 1.0e-15, "Test Cholesky decomposition with reuse - 3");
+
+    // Test Cholesky decomposition with a non-matching sparsity pattern
+    cd_reuse = chol_reuse;
+    cd_reuse(4,3) = 0.1;
+    cd_reuse(3,4) = 0.1;
+    GSparseMatrix chol_pattern = cd_reuse;
+    cd_reuse.cholesky_decompose(cd);
+    s0    = cd_reuse.cholesky_solver(a0);
+    res   = max(abs(chol_pattern*s0-a0));
+    test_value(res, 0.0, 1.0e-14, "Test Cholesky decomposition with reuse - 4");
+
+    // Test Cholesky decomposition reusing a kept symbolic analysis
+    GSparseMatrix symbolic;
+    symbolic.cholesky_symbolic(cd);
+    test_value(symbolic.rows(), cd.rows(), "Test rows of symbolic analysis");
+    test_value(symbolic.sum(), 0.0, 1.0e-15, "Test that symbolic analysis holds no elements");
+    cd_reuse = chol_reuse;
+    cd_reuse.cholesky_decompose(symbolic);
+    s0    = cd_reuse.cholesky_solver(a0);
+    res   = max(abs(s0-cd_direct.cholesky_solver(a0)));
+    test_value(res, 0.0, 1.0e-15, "Test Cholesky decomposition with reuse - 5");
+
     // Return
     return;
 }
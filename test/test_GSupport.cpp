@@ -50,6 +50,9 @@ void TestGSupport::set(void){
 
     //add tests
     add_test(static_cast<pfunction>(&TestGSupport::test_expand_env),"Test Environment variable");
+    add_test(static_cast<pfunction>(&TestGSupport::test_node_array),"Test GNodeArray");
+    add_test(static_cast<pfunction>(&TestGSupport::test_ran_stream),"Test GRan streams");
+    add_test(static_cast<pfunction>(&TestGSupport::test_ran_bulk),"Test GRan arrays");
 
     return;
 }
@@ -164,6 +167,204 @@ void TestGSupport::test_expand_env(void)
     return;
 }
 
+/***********************************************************************//**
+ * @brief Test node array interpolation
+ *
+ * Test that the node array returns the same indices and weighting factors
+ * through the caller-owned interface and through the cached interface, for
+ * linear and non-linear node arrays.
+ ***************************************************************************/
+void TestGSupport::test_node_array(void)
+{
+    // Set up linear and non-linear node arrays
+    double      lin_nodes[]    = {1.0, 2.0, 3.0, 4.0, 5.0};
+    double      nonlin_nodes[] = {1.0, 2.0, 4.0, 8.0, 16.0};
+    GNodeArray  lin(5, lin_nodes);
+    GNodeArray  nonlin(5, nonlin_nodes);
+    GNodeArray* arrays[] = {&lin, &nonlin};
+
+    // Set test values (including values outside the node range)
+    double values[] = {0.0, 1.0, 1.5, 3.2, 4.999, 7.0, 17.0};
+
+    // Loop over arrays and values
+    for (int k = 0; k < 2; ++k) {
+        for (int i = 0; i < 7; ++i) {
+
+            // Get indices and weights through the caller-owned interface
+            int    inx_left;
+            int    inx_right;
+            double wgt_left;
+            double wgt_right;
+            arrays[k]->set_value(values[i], inx_left, inx_right,
+                                 wgt_left, wgt_right);
+
+            // Get indices and weights through the cached interface
+            arrays[k]->set_value(values[i]);
+
+            // Compare
+            test_value(inx_left, arrays[k]->inx_left(), "Left index");
+            test_value(inx_right, arrays[k]->inx_right(), "Right index");
+            test_value(wgt_left, arrays[k]->wgt_left(), 1.0e-10, "Left weight");
+            test_value(wgt_right, arrays[k]->wgt_right(), 1.0e-10, "Right weight");
+
+        } // endfor: looped over values
+    } // endfor: looped over arrays
+
+    // Check interpolation of a linear function
+    std::vector<double> y;
+    for (int i = 0; i < 5; ++i) {
+        y.push_back(2.0 * nonlin_nodes[i] + 1.0);
+    }
+    test_value(nonlin.interpolate(3.0, y), 7.0, 1.0e-10, "Interpolation");
+    test_value(nonlin.interpolate(20.0, y), 41.0, 1.0e-10, "Extrapolation");
+
+    // Exit test
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test random number streams
+ *
+ * Test that random number streams only depend on the seed of the parent
+ * generator and on the stream index, and that different streams deliver
+ * different sequences.
+ ***************************************************************************/
+void TestGSupport::test_ran_stream(void)
+{
+    // Set up parent generators
+    GRan ran1(12345);
+    GRan ran2(12345);
+
+    // Advance one parent generator, which should not affect its streams
+    for (int i = 0; i < 10; ++i) {
+        ran2.uniform();
+    }
+
+    // Check that streams are reproducible
+    GRan stream1 = ran1.stream(7);
+    GRan stream2 = ran2.stream(7);
+    for (int i = 0; i < 100; ++i) {
+        test_value(stream1.uniform(), stream2.uniform(), 0.0, "Reproducible stream");
+    }
+
+    // Check that different streams differ
+    GRan stream3 = ran1.stream(0);
+    GRan stream4 = ran1.stream(1);
+    int  nsame   = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (stream3.int64() == stream4.int64()) {
+            nsame++;
+        }
+    }
+    test_value(nsame, 0, "Different streams");
+
+    // Check that a stream differs from its parent
+    GRan parent(12345);
+    GRan stream5 = parent.stream(0);
+    test_assert(parent.int64() != stream5.int64(), "Stream differs from parent");
+
+    // Exit test
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test filling arrays with random numbers
+ *
+ * Test that arrays of random numbers are reproducible and that their
+ * mean and variance agree with the expected distributions.
+ ***************************************************************************/
+void TestGSupport::test_ran_bulk(void)
+{
+    // Set number of values (not a multiple of the number of streams)
+    const int n = 100003;
+    std::vector<double> values(n);
+    std::vector<double> check(n);
+
+    // Check that arrays are reproducible and that successive calls differ
+    GRan ran1(12345);
+    GRan ran2(12345);
+    ran1.uniform(&values[0], n);
+    ran2.uniform(&check[0], n);
+    int ndiff = 0;
+    for (int i = 0; i < n; ++i) {
+        if (values[i] != check[i]) {
+            ndiff++;
+        }
+    }
+    test_value(ndiff, 0, "Reproducible uniform deviates");
+    ran2.uniform(&check[0], n);
+    test_assert(values[0] != check[0] && values[n-1] != check[n-1],
+                "Successive calls differ");
+
+    // Check uniform deviates
+    double mean = 0.0;
+    double var  = 0.0;
+    bool   in_range = true;
+    for (int i = 0; i < n; ++i) {
+        if (values[i] < 0.0 || values[i] > 1.0) {
+            in_range = false;
+        }
+        mean += values[i];
+    }
+    mean /= n;
+    for (int i = 0; i < n; ++i) {
+        var += (values[i]-mean) * (values[i]-mean);
+    }
+    var /= n;
+    test_assert(in_range, "Uniform deviates in [0,1]");
+    test_value(mean, 0.5, 0.005, "Uniform mean");
+    test_value(var, 1.0/12.0, 0.002, "Uniform variance");
+
+    // Check exponential deviates
+    ran1.exp(2.0, &values[0], n);
+    mean = 0.0;
+    for (int i = 0; i < n; ++i) {
+        mean += values[i];
+    }
+    mean /= n;
+    test_value(mean, 0.5, 0.01, "Exponential mean");
+
+    // Check normal deviates
+    ran1.normal(&values[0], n);
+    mean = 0.0;
+    var  = 0.0;
+    for (int i = 0; i < n; ++i) {
+        mean += values[i];
+        var  += values[i] * values[i];
+    }
+    mean /= n;
+    var   = var/n - mean*mean;
+    test_value(mean, 0.0, 0.01, "Normal mean");
+    test_value(var, 1.0, 0.02, "Normal variance");
+
+    // Check Poisson deviates for small and large expectation values
+    std::vector<double> lambda(n);
+    for (int i = 0; i < n; ++i) {
+        lambda[i] = (i % 2 == 0) ? 3.0 : 30.0;
+    }
+    ran1.poisson(&lambda[0], &values[0], n);
+    double mean_small = 0.0;
+    double mean_large = 0.0;
+    for (int i = 0; i < n; ++i) {
+        if (i % 2 == 0) {
+            mean_small += values[i];
+        }
+        else {
+            mean_large += values[i];
+        }
+    }
+    mean_small /= (n+1)/2;
+    mean_large /= n/2;
+    test_value(mean_small, 3.0, 0.05, "Poisson mean (small)");
+    test_value(mean_large, 30.0, 0.15, "Poisson mean (large)");
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Main test entry point
  ***************************************************************************/
@@ -36,6 +36,9 @@ class TestGSupport : public GTestSuite
         // Methods
         virtual void set(void);
         void test_expand_env(void);
+        void test_node_array(void);
+        void test_ran_stream(void);
+        void test_ran_bulk(void);
 
     // Private members
     private:
@@ -247,6 +247,7 @@ void TestGSymMatrix::set(void)
     append(static_cast<pfunction>(&TestGSymMatrix::matrix_functions), "Test matrix functions");
     append(static_cast<pfunction>(&TestGSymMatrix::matrix_compare), "Test matrix comparisons");
     append(static_cast<pfunction>(&TestGSymMatrix::matrix_cholesky), "Test matrix Cholesky decomposition");
+    append(static_cast<pfunction>(&TestGSymMatrix::matrix_cholesky_large), "Test large matrix Cholesky decomposition");
     append(static_cast<pfunction>(&TestGSymMatrix::matrix_print), "Test matrix printing");
 
     // Set members
@@ -775,6 +776,45 @@ void TestGSymMatrix::matrix_cholesky(void)
 }
 
 
+/***************************************************************************
+ * @brief Test Cholesky decomposition and inversion of a large matrix
+ *
+ * Uses a matrix that is large enough to exercise the blocked and threaded
+ * decomposition.
+ ***************************************************************************/
+void TestGSymMatrix::matrix_cholesky_large(void)
+{
+    // Set positive definite matrix
+    int        num = 300;
+    GSymMatrix matrix(num, num);
+    for (int row = 0; row < num; ++row) {
+        for (int col = row; col < num; ++col) {
+            matrix(row,col) = std::cos(0.01*(row+col)) / (1.0 + col - row);
+        }
+        matrix(row,row) += num;
+    }
+
+    // Test Cholesky decomposition
+    GSymMatrix cd       = cholesky_decompose(matrix);
+    GMatrix    cd_lower = cd.extract_lower_triangle();
+    GMatrix    product  = cd_lower * transpose(cd_lower);
+    double     res      = (abs(GMatrix(matrix) - product)).max();
+    test_value(res, 0.0, 1.0e-10, "Test large cholesky_decompose() method");
+
+    // Test Cholesky inverter
+    GSymMatrix inverse = cholesky_invert(matrix);
+    GMatrix    unit    = GMatrix(matrix) * GMatrix(inverse);
+    for (int i = 0; i < num; ++i) {
+        unit(i,i) -= 1.0;
+    }
+    res = (abs(unit)).max();
+    test_value(res, 0.0, 1.0e-10, "Test large cholesky_invert() method");
+
+    // Return
+    return;
+}
+
+
 /***************************************************************************
  * @brief Test matrix printing
  ***************************************************************************/
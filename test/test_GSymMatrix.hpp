@@ -57,6 +57,7 @@ public:
     void         matrix_functions(void);
     void         matrix_compare(void);
     void         matrix_cholesky(void);
+    void         matrix_cholesky_large(void);
     void         matrix_print(void);
 
 private:
@@ -286,6 +286,25 @@ void TestGVector::test6(void){
     // sum(GVector)
     test_value(m_test[0]+m_test[1]+m_test[2]+m_test[3]+m_test[4],sum(m_test),1e-6,"sum(GVector)");
 
+    // GVector.axpy(2.0, GVector)
+    m_result = m_test;
+    m_result.axpy(2.0, m_test);
+    for (int i = 0; i < m_num; ++i) {
+        test_value(m_result[i],m_test[i]*3.0,1e-10,"GVector.axpy(2.0, GVector)");
+    }
+
+    // Scalar product and sum of longer GVector
+    GVector test_long(11);
+    double  sum_long = 0.0;
+    double  dot_long = 0.0;
+    for (int i = 0; i < 11; ++i) {
+        test_long[i] = (i+1) * 0.5;
+        sum_long    += test_long[i];
+        dot_long    += test_long[i] * test_long[i];
+    }
+    test_value(sum(test_long),sum_long,1e-10,"sum(GVector) for 11 elements");
+    test_value(test_long * test_long,dot_long,1e-10,"GVector * GVector for 11 elements");
+
     // acos(GVector/10.0)
     test_assert(acos(m_test/10.0).print()=="(1.46057, 1.34898, 1.23449, 1.1152, 0.988432)","acos(GVector/10.0)");
 
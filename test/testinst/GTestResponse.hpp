@@ -101,6 +101,7 @@ public:
     
     virtual bool          hasedisp(void) const { return false; }
     virtual bool          hastdisp(void) const { return false; }
+    virtual bool          isreentrant(void) const { return true; }
     virtual double        irf(const GEvent&       event,
                               const GPhoton&      photon,
                               const GObservation& obs) const { return 1.0; }